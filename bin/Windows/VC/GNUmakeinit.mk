@@ -11,6 +11,12 @@
 # Flags
 ARFLAGS := /nologo
 
+# Build Options
+# Allocation check hook for --allocCheck: make QSS_ALLOC_CHECK=1
+ifdef QSS_ALLOC_CHECK
+CXXFLAGS += /DQSS_ALLOC_CHECK
+endif
+
 # Commands
 CXX := cl
 CC := cl
@@ -0,0 +1,288 @@
+// QSS Trajectory Aggregate Class
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_Aggregate_hh_INCLUDED
+#define QSS_Aggregate_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/math.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace QSS {
+
+// QSS Trajectory Aggregate Class
+//
+// Exact running integral, extrema, and time above thresholds of a piecewise cubic trajectory
+// Each segment is accumulated analytically when the next segment starts
+class Aggregate final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Real = double;
+	using Thresholds = std::vector< Real >;
+	using Times = std::vector< Time >;
+
+private: // Types
+
+	using Points = std::array< Time, 4u >; // Monotone piece end points: Start, 2 interior critical points, end
+
+public: // Creation
+
+	// Default Constructor
+	Aggregate() = default;
+
+	// Thresholds Constructor
+	explicit
+	Aggregate( Thresholds const & thresholds ) :
+	 thresholds_( thresholds ),
+	 t_above_( thresholds.size(), 0.0 )
+	{}
+
+public: // Predicate
+
+	// Started?
+	bool
+	started() const
+	{
+		return started_;
+	}
+
+public: // Property
+
+	// Start Time
+	Time
+	tB() const
+	{
+		return tB_;
+	}
+
+	// Time Accumulated Through
+	Time
+	tA() const
+	{
+		return tA_;
+	}
+
+	// Integral
+	Real
+	integral() const
+	{
+		return integral_;
+	}
+
+	// Min
+	Real
+	min() const
+	{
+		return min_;
+	}
+
+	// Max
+	Real
+	max() const
+	{
+		return max_;
+	}
+
+	// Thresholds
+	Thresholds const &
+	thresholds() const
+	{
+		return thresholds_;
+	}
+
+	// Time Above Threshold i
+	Time
+	t_above( size_type const i ) const
+	{
+		assert( i < t_above_.size() );
+		return t_above_[ i ];
+	}
+
+public: // Methods
+
+	// Update: Accumulate Current Segment Through Time t and Start New Segment with Taylor Coefficients at t
+	void
+	update(
+	 Time const t,
+	 Real const c0,
+	 Real const c1 = 0.0,
+	 Real const c2 = 0.0,
+	 Real const c3 = 0.0
+	)
+	{
+		if ( started_ ) {
+			accumulate( t );
+		} else {
+			started_ = true;
+			tB_ = tA_ = t;
+		}
+		c0_ = c0;
+		c1_ = c1;
+		c2_ = c2;
+		c3_ = c3;
+		min_ = std::min( min_, c0 );
+		max_ = std::max( max_, c0 );
+	}
+
+	// Accumulate Current Segment Through Time t
+	void
+	accumulate( Time const t )
+	{
+		assert( started_ );
+		assert( t >= tA_ );
+		Time const L( t - tA_ );
+		if ( L > 0.0 ) {
+
+			// Integral
+			integral_ += L * ( c0_ + L * ( ( 0.5 * c1_ ) + L * ( ( c2_ / 3.0 ) + L * ( 0.25 * c3_ ) ) ) );
+
+			// Monotone pieces: Split at interior critical points
+			Points d;
+			size_type nd( 0u );
+			d[ nd++ ] = 0.0;
+			if ( ( c2_ != 0.0 ) || ( c3_ != 0.0 ) ) { // Solve 3 c3 d^2 + 2 c2 d + c1 = 0
+				Real const a( 3.0 * c3_ ), b( 2.0 * c2_ ), c( c1_ );
+				if ( a == 0.0 ) {
+					add_interior( -c / b, L, d, nd );
+				} else {
+					Real const disc( ( b * b ) - ( 4.0 * a * c ) );
+					if ( disc >= 0.0 ) {
+						Real const q( -0.5 * ( b + ( b >= 0.0 ? std::sqrt( disc ) : -std::sqrt( disc ) ) ) );
+						if ( q != 0.0 ) {
+							add_interior( q / a, L, d, nd );
+							add_interior( c / q, L, d, nd );
+						}
+					}
+				}
+				if ( ( nd == 3u ) && ( d[ 2 ] < d[ 1 ] ) ) std::swap( d[ 1 ], d[ 2 ] );
+			}
+			d[ nd++ ] = L;
+
+			// Extrema
+			for ( size_type k = 1; k < nd; ++k ) {
+				Real const v( p( d[ k ] ) );
+				min_ = std::min( min_, v );
+				max_ = std::max( max_, v );
+			}
+
+			// Time above thresholds
+			for ( size_type i = 0, n = thresholds_.size(); i < n; ++i ) {
+				Real const h( thresholds_[ i ] );
+				Time above( 0.0 );
+				for ( size_type k = 1; k < nd; ++k ) {
+					Time const u( d[ k - 1 ] ), v( d[ k ] );
+					Real const fu( p( u ) - h ), fv( p( v ) - h );
+					if ( ( fu > 0.0 ) && ( fv > 0.0 ) ) {
+						above += v - u;
+					} else if ( ( fu > 0.0 ) != ( fv > 0.0 ) ) { // Crossing in monotone piece
+						Time const r( root( h, u, v, fu ) );
+						above += ( fu > 0.0 ? r - u : v - r );
+					}
+				}
+				t_above_[ i ] += above;
+			}
+
+			// Rebase segment at t
+			Real const c0( p( L ) );
+			Real const c1( c1_ + L * ( ( 2.0 * c2_ ) + L * ( 3.0 * c3_ ) ) );
+			Real const c2( c2_ + L * ( 3.0 * c3_ ) );
+			c0_ = c0;
+			c1_ = c1;
+			c2_ = c2;
+		}
+		tA_ = t;
+	}
+
+private: // Methods
+
+	// Segment Value at Offset d
+	Real
+	p( Time const d ) const
+	{
+		return c0_ + d * ( c1_ + d * ( c2_ + d * c3_ ) );
+	}
+
+	// Add Interior Point
+	static
+	void
+	add_interior( Time const d, Time const L, Points & ds, size_type & nd )
+	{
+		if ( ( 0.0 < d ) && ( d < L ) ) ds[ nd++ ] = d;
+	}
+
+	// Threshold Crossing in Monotone Piece [u,v] by Bisection
+	Time
+	root( Real const h, Time u, Time v, Real const fu ) const
+	{
+		bool const pos_u( fu > 0.0 );
+		while ( true ) {
+			Time const m( 0.5 * ( u + v ) );
+			if ( ( m <= u ) || ( m >= v ) ) return m; // Converged to double precision
+			if ( ( p( m ) - h > 0.0 ) == pos_u ) {
+				u = m;
+			} else {
+				v = m;
+			}
+		}
+	}
+
+private: // Data
+
+	bool started_{ false }; // Started?
+	Time tB_{ 0.0 }; // Start time
+	Time tA_{ 0.0 }; // Time accumulated through
+	Real c0_{ 0.0 }, c1_{ 0.0 }, c2_{ 0.0 }, c3_{ 0.0 }; // Current segment coefficients
+	Real integral_{ 0.0 }; // Integral
+	Real min_{ infinity }; // Min
+	Real max_{ neg_infinity }; // Max
+	Thresholds thresholds_; // Thresholds
+	Times t_above_; // Time above each threshold
+
+}; // Aggregate
+
+} // QSS
+
+#endif
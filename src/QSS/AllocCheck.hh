@@ -0,0 +1,131 @@
+// Heap Allocation Check
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_AllocCheck_hh_INCLUDED
+#define QSS_AllocCheck_hh_INCLUDED
+
+// C++ Headers
+#include <atomic>
+#include <cstddef>
+
+namespace QSS {
+
+// Heap Allocation Check: Counts global operator new calls while armed
+//
+// Used to verify that the steady-state simulation loop is allocation-free
+// The counting operator new replacement is in AllocCheck.hook.hh: It is linked in when QSS_ALLOC_CHECK is defined
+class AllocCheck final
+{
+
+public: // Static Predicate
+
+	// Counting operator new Linked In?
+	static
+	bool
+	hooked()
+	{
+		return hooked_.load( std::memory_order_relaxed );
+	}
+
+	// Armed?
+	static
+	bool
+	armed()
+	{
+		return armed_.load( std::memory_order_relaxed );
+	}
+
+public: // Static Property
+
+	// Allocations Counted While Armed
+	static
+	std::size_t
+	count()
+	{
+		return count_.load( std::memory_order_relaxed );
+	}
+
+public: // Static Methods
+
+	// Arm: Reset Count and Start Counting
+	static
+	void
+	arm()
+	{
+		count_.store( 0u, std::memory_order_relaxed );
+		armed_.store( true, std::memory_order_relaxed );
+	}
+
+	// Disarm: Stop Counting
+	static
+	void
+	disarm()
+	{
+		armed_.store( false, std::memory_order_relaxed );
+	}
+
+	// Flag Counting operator new as Linked In
+	static
+	void
+	hook()
+	{
+		hooked_.store( true, std::memory_order_relaxed );
+	}
+
+	// Deallocate Memory from the Counting operator new: Out-of-Line so Callers Don't See the free Call
+	static
+	void
+	deallocate( void * p ) noexcept;
+
+	// Allocation Notification from operator new
+	static
+	void
+	on_new()
+	{
+		if ( armed_.load( std::memory_order_relaxed ) ) count_.fetch_add( 1u, std::memory_order_relaxed );
+	}
+
+private: // Static Data
+
+	static std::atomic< bool > hooked_; // Counting operator new linked in?
+	static std::atomic< bool > armed_; // Counting?
+	static std::atomic< std::size_t > count_; // Allocations counted
+
+}; // AllocCheck
+
+} // QSS
+
+#endif
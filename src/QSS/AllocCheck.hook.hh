@@ -0,0 +1,152 @@
+// Heap Allocation Check Counting operator new Replacement
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_AllocCheck_hook_hh_INCLUDED
+#define QSS_AllocCheck_hook_hh_INCLUDED
+
+// Include in exactly one translation unit of a program to replace the global operator new/delete
+// Aligned forms are not replaced so over-aligned allocations are not counted
+
+// QSS Headers
+#include <QSS/AllocCheck.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace QSS {
+
+// Flag the Counting operator new as Linked In
+struct AllocCheckHook final
+{
+	AllocCheckHook()
+	{
+		AllocCheck::hook();
+	}
+}; // AllocCheckHook
+
+static AllocCheckHook const alloc_check_hook;
+
+} // QSS
+
+// Counting operator new
+void *
+operator new( std::size_t n )
+{
+	QSS::AllocCheck::on_new();
+	if ( n == 0u ) n = 1u;
+	while ( true ) {
+		void * const p( std::malloc( n ) );
+		if ( p != nullptr ) return p;
+		std::new_handler const handler( std::get_new_handler() );
+		if ( handler == nullptr ) throw std::bad_alloc();
+		handler();
+	}
+}
+
+// Counting operator new[]
+void *
+operator new[]( std::size_t n )
+{
+	return ::operator new( n );
+}
+
+// Counting operator new: No-Throw
+void *
+operator new( std::size_t n, std::nothrow_t const & ) noexcept
+{
+	try {
+		return ::operator new( n );
+	} catch ( ... ) {
+		return nullptr;
+	}
+}
+
+// Counting operator new[]: No-Throw
+void *
+operator new[]( std::size_t n, std::nothrow_t const & ) noexcept
+{
+	try {
+		return ::operator new( n );
+	} catch ( ... ) {
+		return nullptr;
+	}
+}
+
+// operator delete
+void
+operator delete( void * p ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+// operator delete[]
+void
+operator delete[]( void * p ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+// operator delete: Sized
+void
+operator delete( void * p, std::size_t ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+// operator delete[]: Sized
+void
+operator delete[]( void * p, std::size_t ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+// operator delete: No-Throw
+void
+operator delete( void * p, std::nothrow_t const & ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+// operator delete[]: No-Throw
+void
+operator delete[]( void * p, std::nothrow_t const & ) noexcept
+{
+	QSS::AllocCheck::deallocate( p );
+}
+
+#endif
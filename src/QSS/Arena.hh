@@ -0,0 +1,221 @@
+// Fixed-Stride Slot Arena
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_Arena_hh_INCLUDED
+#define QSS_Arena_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <utility>
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace QSS {
+
+// Fixed-Stride Slot Arena
+//
+// Objects are constructed in caller-chosen slots of one contiguous block so the placement order is independent of the construction order
+// Memory is released with the arena: Objects must be destroyed (not deleted) before that
+class Arena final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+
+	static constexpr size_type line{ 64u }; // Cache line size (bytes)
+
+public: // Creation
+
+	// Default Constructor
+	Arena() = default;
+
+	// Slots + Stride Constructor
+	Arena(
+	 size_type const n,
+	 size_type const stride
+	)
+	{
+		assign( n, stride );
+	}
+
+	// Copy Constructor
+	Arena( Arena const & ) = delete;
+
+	// Move Constructor
+	Arena( Arena && ) = delete;
+
+	// Destructor
+	~Arena()
+	{
+		release();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Arena &
+	operator =( Arena const & ) = delete;
+
+	// Move Assignment
+	Arena &
+	operator =( Arena && ) = delete;
+
+public: // Predicate
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return n_ == 0u;
+	}
+
+	// Owns Address?
+	bool
+	owns( void const * p ) const
+	{
+		return ( mem_ != nullptr ) && ( static_cast< char const * >( p ) >= mem_ ) && ( static_cast< char const * >( p ) < mem_ + ( n_ * stride_ ) );
+	}
+
+public: // Property
+
+	// Number of Slots
+	size_type
+	n() const
+	{
+		return n_;
+	}
+
+	// Slot Stride (bytes)
+	size_type
+	stride() const
+	{
+		return stride_;
+	}
+
+	// Block Size (bytes)
+	size_type
+	bytes() const
+	{
+		return n_ * stride_;
+	}
+
+	// Slot Index of an Owned Address
+	size_type
+	slot( void const * p ) const
+	{
+		assert( owns( p ) );
+		return size_type( static_cast< char const * >( p ) - mem_ ) / stride_;
+	}
+
+public: // Methods
+
+	// Allocate n Slots of at Least stride Bytes: Prior Objects Must Have Been Destroyed
+	void
+	assign(
+	 size_type const n,
+	 size_type const stride
+	)
+	{
+		release();
+		n_ = n;
+		stride_ = ( ( stride + line - 1u ) / line ) * line; // Slots start on cache lines
+		if ( n_ * stride_ > 0u ) {
+#ifdef _WIN32
+			mem_ = static_cast< char * >( _aligned_malloc( n_ * stride_, line ) );
+#else
+			mem_ = static_cast< char * >( std::aligned_alloc( line, n_ * stride_ ) );
+#endif
+			if ( mem_ == nullptr ) throw std::bad_alloc();
+		}
+	}
+
+	// Construct an Object in Slot i
+	template< typename T, typename... Args >
+	T *
+	make(
+	 size_type const i,
+	 Args &&... args
+	)
+	{
+		assert( i < n_ );
+		assert( sizeof( T ) <= stride_ );
+		static_assert( alignof( T ) <= line, "Arena slot alignment is insufficient" );
+		return ::new ( static_cast< void * >( mem_ + ( i * stride_ ) ) ) T( std::forward< Args >( args )... );
+	}
+
+	// Destroy or Delete an Object Depending on Whether the Arena Owns It
+	template< typename T >
+	void
+	destroy( T * p ) const
+	{
+		if ( p == nullptr ) return;
+		if ( owns( p ) ) {
+			p->~T();
+		} else {
+			delete p;
+		}
+	}
+
+private: // Methods
+
+	// Release the Slot Block
+	void
+	release()
+	{
+#ifdef _WIN32
+		_aligned_free( mem_ );
+#else
+		std::free( mem_ );
+#endif
+		mem_ = nullptr;
+	}
+
+private: // Data
+
+	char * mem_{ nullptr }; // Slot block
+	size_type n_{ 0u }; // Number of slots
+	size_type stride_{ 0u }; // Slot stride (bytes)
+
+}; // Arena
+
+} // QSS
+
+#endif
@@ -221,6 +221,81 @@ private: // Static Data
 
 }; // BinOptimizer
 
+// QSS Binning Work Meter
+//
+// Deterministic alternative to CPU time for bin optimization
+// Work is counted in FMU calls and variable updates so auto-binning is reproducible
+class BinWork final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Time = double;
+	using Velocity = double;
+
+public: // Creation
+
+	// Default Constructor
+	BinWork() = default;
+
+	// Begin Time Constructor
+	explicit
+	BinWork( Time const tb ) :
+	 tb_( tb )
+	{}
+
+public: // Property
+
+	// Begin Time
+	Time
+	tb() const
+	{
+		return tb_;
+	}
+
+	// Work Since Start
+	size_type
+	work() const
+	{
+		return work_;
+	}
+
+	// Solution "Velocity": Simulation Time per Unit Work
+	Velocity
+	operator()( Time const tn ) const
+	{
+		assert( tb_ <= tn );
+		return work_ > 0u ? ( tn - tb_ ) / static_cast< Velocity >( work_ ) : ( tb_ < tn ? infinity : 0.0 );
+	}
+
+public: // Operator
+
+	// += Work
+	BinWork &
+	operator +=( size_type const work )
+	{
+		work_ += work;
+		return *this;
+	}
+
+public: // Method
+
+	// Start
+	void
+	start( Time const tb = Time( 0 ) )
+	{
+		tb_ = tb;
+		work_ = 0u;
+	}
+
+private: // Data
+
+	Time tb_{ 0.0 }; // Simulation begin time
+	size_type work_{ 0u }; // Work since begin time
+
+}; // BinWork
+
 } // QSS
 
 #endif
@@ -0,0 +1,105 @@
+// Zero-Crossing Bump Peers
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_BumpPeers_hh_INCLUDED
+#define QSS_BumpPeers_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// Set Zero-Crossing Variable Bump Peers
+//
+// Bumping a zero-crossing variable sets its observees to the bump time and its handlers may be modified by the FMU event processing
+// so the FMU detection of another zero-crossing variable is affected if it observes any of those observees or handlers
+// Peers of a zero-crossing variable are itself and those zero-crossing variables, sorted by FMU event indicator index
+// ZC provides observees(), bump_peers(), and ei_index and handlers_of( zc ) gives a range of its handler variables
+template< typename ZC, typename HandlersOf >
+void
+set_bump_peers(
+ std::vector< ZC * > const & zcs,
+ HandlersOf && handlers_of
+)
+{
+	std::unordered_map< void const *, std::vector< ZC * > > observee_ZCs; // Map from observees to their zero-crossing variable observers
+	for ( ZC * zc : zcs ) {
+		for ( auto const * observee : zc->observees() ) {
+			observee_ZCs[ observee ].push_back( zc );
+		}
+	}
+	for ( ZC * zc : zcs ) {
+		std::vector< ZC * > & peers( zc->bump_peers() );
+		peers.clear();
+		peers.push_back( zc );
+		auto const add_peers = [&]( void const * v ){
+			auto const i( observee_ZCs.find( v ) );
+			if ( i != observee_ZCs.end() ) peers.insert( peers.end(), i->second.begin(), i->second.end() );
+		};
+		for ( auto const * observee : zc->observees() ) {
+			add_peers( observee );
+		}
+		for ( auto const * handler : handlers_of( zc ) ) {
+			add_peers( handler );
+		}
+		std::sort( peers.begin(), peers.end(), []( ZC const * zc_1, ZC const * zc_2 ){ return zc_1->ei_index < zc_2->ei_index; } ); // Sort by FMU event indicator index
+		peers.erase( std::unique( peers.begin(), peers.end() ), peers.end() );
+		peers.shrink_to_fit();
+	}
+}
+
+// Merge Bump Peers of Triggered Zero-Crossing Variables into the Bump Set Sorted by FMU Event Indicator Index
+template< typename ZC >
+void
+merge_bump_peers(
+ std::vector< ZC * > const & triggers,
+ std::vector< ZC * > & bump
+)
+{
+	bump.clear();
+	for ( ZC const * trigger : triggers ) {
+		bump.insert( bump.end(), trigger->bump_peers().begin(), trigger->bump_peers().end() );
+	}
+	if ( triggers.size() > 1u ) { // Merge peer sets
+		std::sort( bump.begin(), bump.end(), []( ZC const * zc_1, ZC const * zc_2 ){ return zc_1->ei_index < zc_2->ei_index; } );
+		bump.erase( std::unique( bump.begin(), bump.end() ), bump.end() );
+	}
+}
+
+} // QSS
+
+#endif
@@ -0,0 +1,188 @@
+// QSS Compressed Sparse Row Directed Graph
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_CSR_hh_INCLUDED
+#define QSS_CSR_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace QSS {
+
+// QSS Compressed Sparse Row Directed Graph
+//
+// Node i's edge targets are the contiguous range [ begin( i ), end( i ) ) in edge insertion order
+template< typename I = std::uint32_t >
+class CSR final
+{
+
+public: // Types
+
+	using Index = I;
+	using Indexes = std::vector< Index >;
+	using Edge = std::pair< Index, Index >; // ( From, To )
+	using Edges = std::vector< Edge >;
+	using size_type = std::size_t;
+	using const_iterator = Index const *;
+
+public: // Creation
+
+	// Default Constructor
+	CSR() = default;
+
+	// Nodes + Edges Constructor
+	CSR(
+	 Index const n,
+	 Edges const & edges
+	)
+	{
+		assign( n, edges );
+	}
+
+public: // Property
+
+	// Number of Nodes
+	Index
+	n() const
+	{
+		return off_.empty() ? Index( 0u ) : Index( off_.size() - 1u );
+	}
+
+	// Number of Edges
+	size_type
+	n_edges() const
+	{
+		return tgt_.size();
+	}
+
+	// Number of Edges from Node i
+	size_type
+	degree( Index const i ) const
+	{
+		assert( i < n() );
+		return off_[ i + 1u ] - off_[ i ];
+	}
+
+	// Edge Targets Begin Iterator of Node i
+	const_iterator
+	begin( Index const i ) const
+	{
+		assert( i < n() );
+		return tgt_.data() + off_[ i ];
+	}
+
+	// Edge Targets End Iterator of Node i
+	const_iterator
+	end( Index const i ) const
+	{
+		assert( i < n() );
+		return tgt_.data() + off_[ i + 1u ];
+	}
+
+	// Edge Offsets
+	std::vector< size_type > const &
+	offsets() const
+	{
+		return off_;
+	}
+
+	// Edge Targets
+	Indexes const &
+	targets() const
+	{
+		return tgt_;
+	}
+
+public: // Methods
+
+	// Assign from Nodes + Edges: Stable Counting Sort by Source Node
+	void
+	assign(
+	 Index const n,
+	 Edges const & edges
+	)
+	{
+		off_.assign( size_type( n ) + 1u, 0u );
+		for ( Edge const & edge : edges ) {
+			assert( edge.first < n );
+			assert( edge.second < n );
+			++off_[ edge.first + 1u ];
+		}
+		for ( size_type i = 1u; i <= n; ++i ) off_[ i ] += off_[ i - 1u ];
+		tgt_.resize( edges.size() );
+		std::vector< size_type > pos( off_.begin(), off_.end() - 1 );
+		for ( Edge const & edge : edges ) tgt_[ pos[ edge.first ]++ ] = edge.second;
+	}
+
+	// Sort and Uniquify Each Node's Edge Targets
+	void
+	sort_and_uniquify()
+	{
+		size_type k( 0u ); // Compacted targets size
+		for ( size_type i = 0u, n = off_.size() - ( off_.empty() ? 0u : 1u ); i < n; ++i ) {
+			auto const b( tgt_.begin() + off_[ i ] ), e( tgt_.begin() + off_[ i + 1u ] );
+			std::sort( b, e );
+			auto const u( std::unique( b, e ) );
+			off_[ i ] = k;
+			k = std::copy( b, u, tgt_.begin() + k ) - tgt_.begin();
+		}
+		if ( !off_.empty() ) off_.back() = k;
+		tgt_.resize( k );
+	}
+
+	// Clear
+	void
+	clear()
+	{
+		off_.clear();
+		tgt_.clear();
+	}
+
+private: // Data
+
+	std::vector< size_type > off_; // Edge offsets of each node (n+1)
+	Indexes tgt_; // Edge targets
+
+}; // CSR
+
+} // QSS
+
+#endif
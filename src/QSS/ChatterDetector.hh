@@ -0,0 +1,144 @@
+// Zero-Crossing Chatter Detector
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_ChatterDetector_hh_INCLUDED
+#define QSS_ChatterDetector_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace QSS {
+
+// Zero-Crossing Chatter Detector
+//
+// Records the times of crossing direction reversals in a ring and flags chattering when the last n reversals fall within a time window
+class ChatterDetector final
+{
+
+public: // Types
+
+	using Time = double;
+	using Times = std::vector< Time >;
+	using size_type = std::size_t;
+
+public: // Creation
+
+	// Default Constructor
+	ChatterDetector() = default;
+
+	// Reversal Count and Window Constructor
+	ChatterDetector(
+	 size_type const n,
+	 Time const dt
+	) :
+	 t_( n, neg_infinity ),
+	 dt_( dt )
+	{
+		assert( dt_ >= 0.0 );
+	}
+
+public: // Predicate
+
+	// Detection On?
+	bool
+	on() const
+	{
+		return !t_.empty();
+	}
+
+public: // Property
+
+	// Reversal Count Threshold
+	size_type
+	n() const
+	{
+		return t_.size();
+	}
+
+	// Window
+	Time
+	dt() const
+	{
+		return dt_;
+	}
+
+public: // Methods
+
+	// Crossing at Time t in Direction dir (-1 => Down, 0 => Flat, +1 => Up): Returns Whether Chattering Detected
+	bool
+	crossing( Time const t, int const dir )
+	{
+		if ( t_.empty() || ( dir == 0 ) ) return false;
+		bool chattering( false );
+		if ( dir == -dir_ ) { // Reversal
+			t_[ i_ ] = t;
+			if ( ++i_ == t_.size() ) i_ = 0u; // Now at oldest reversal
+			if ( t - t_[ i_ ] <= dt_ ) { // Last n reversals within window
+				chattering = true;
+				reset(); // Require a fresh run of reversals before detecting again
+			}
+		}
+		dir_ = dir;
+		return chattering;
+	}
+
+	// Reset Reversal History
+	void
+	reset()
+	{
+		std::fill( t_.begin(), t_.end(), neg_infinity );
+		i_ = 0u;
+	}
+
+private: // Static Data
+
+	static constexpr Time neg_infinity{ -std::numeric_limits< Time >::infinity() };
+
+private: // Data
+
+	Times t_; // Reversal time ring
+	size_type i_{ 0u }; // Ring index of next reversal
+	Time dt_{ 0.0 }; // Window
+	int dir_{ 0 }; // Direction of last crossing
+
+}; // ChatterDetector
+
+} // QSS
+
+#endif
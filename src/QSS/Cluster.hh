@@ -37,10 +37,10 @@
 #define QSS_Cluster_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/Glob.hh>
 #include <QSS/string.hh>
 
 // C++ Headers
-#include <algorithm>
 #include <iostream>
 #include <regex>
 #include <string>
@@ -54,8 +54,8 @@ class Cluster final
 
 public: // Types
 
-	using Filter = std::regex;
-	using Filters = std::vector< Filter >;
+	using Filter = Glob;
+	using Filters = Globs;
 	using size_type = Filters::size_type;
 
 public: // Creation
@@ -67,7 +67,7 @@ public: // Creation
 		for ( std::string var_spec : var_specs ) {
 			if ( !strip( var_spec ).empty() ) { // Add to filter
 				try {
-					filters_.push_back( std::regex( regex_string( var_spec ) ) );
+					filters_.add( var_spec );
 				} catch (...) {
 					std::cerr << "\nError: Skipping cluster spec that yields invalid regex: " << var_spec << std::endl;
 				}
@@ -88,7 +88,16 @@ public: // Predicate
 			if ( has_prefix( var_name, "temp_" ) && is_int( var_name.substr( 5 ) ) ) return false; // Omit temporary variables
 			return true;
 		}
-		return std::any_of( filters_.begin(), filters_.end(), [ &var_name ]( Filter const & filter ){ return std::regex_match( var_name, filter ); } ); // Name matches filter?
+		return filters_.any( var_name ); // Name matches filter?
+	}
+
+public: // Property
+
+	// Filters
+	Filters const &
+	filters() const
+	{
+		return filters_;
 	}
 
 public: // Static Methods
@@ -98,24 +107,7 @@ public: // Static Methods
 	std::string
 	regex_string( std::string const & spec )
 	{
-		// Convert glob usage to regex (imperfect)
-		std::string re_spec;
-		for ( char const c : spec ) {
-			if ( c == '?' ) {
-				re_spec.push_back( '.' );
-			} else if ( c == '*' ) {
-				re_spec.append( ".*" );
-			} else if ( c == '.' ) {
-				re_spec.append( "\\." );
-			} else if ( c == '[' ) {
-				re_spec.append( "\\[" );
-			} else if ( c == ']' ) {
-				re_spec.append( "\\]" );
-			} else {
-				re_spec.push_back( c );
-			}
-		}
-		return re_spec;
+		return Glob::regex_string( spec );
 	}
 
 	// Regex of a Variable Spec
@@ -38,9 +38,11 @@
 
 // QSS Headers
 #include <QSS/Cluster.hh>
+#include <QSS/Glob.hh>
 #include <QSS/string.hh>
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -87,6 +89,17 @@ public: // Creation
 				clusters_.push_back( Cluster( specs ) );
 			}
 		}
+		for ( index_type idx = 0u, n = clusters_.size(); idx < n; ++idx ) { // Combined specs for one-pass matching
+			Cluster::Filters const & filters( clusters_[ idx ].filters() );
+			if ( filters.empty() ) { // Default filtering cluster
+				defaults_.push_back( idx );
+			} else {
+				for ( Globs::size_type i = 0u, e = filters.size(); i < e; ++i ) {
+					specs_.add( filters[ i ] );
+					spec_clusters_.push_back( idx );
+				}
+			}
+		}
 	}
 
 public: // Predicate
@@ -98,6 +111,22 @@ public: // Predicate
 		return clusters_.empty();
 	}
 
+public: // Property
+
+	// Indexes of Clusters Matching a Variable Name in Ascending Order
+	void
+	matches( std::string const & var_name, std::vector< index_type > & idxs ) const
+	{
+		specs_.matches( var_name, spec_idxs_ );
+		idxs.clear();
+		for ( Globs::size_type const i : spec_idxs_ ) idxs.push_back( spec_clusters_[ i ] );
+		for ( index_type const idx : defaults_ ) {
+			if ( clusters_[ idx ]( var_name ) ) idxs.push_back( idx );
+		}
+		std::sort( idxs.begin(), idxs.end() );
+		idxs.erase( std::unique( idxs.begin(), idxs.end() ), idxs.end() );
+	}
+
 public: // Subscript
 
 	// Get a Cluster
@@ -149,6 +178,10 @@ public: // Iterator
 private: // Data
 
 	ClusterSpecs clusters_; // Variable_QSS clusters
+	Globs specs_; // Specs of all clusters
+	std::vector< index_type > spec_clusters_; // Cluster index of each spec
+	std::vector< index_type > defaults_; // Indexes of clusters with no valid specs
+	mutable Globs::Indexes spec_idxs_; // Matching spec indexes work array
 
 }; // Clusters
 
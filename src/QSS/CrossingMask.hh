@@ -0,0 +1,235 @@
+// QSS Event Indicator Crossing Bitmask
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_CrossingMask_hh_INCLUDED
+#define QSS_CrossingMask_hh_INCLUDED
+
+// C++ Headers
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#if defined(__AVX__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace QSS {
+
+// Event Indicator Crossing Bitmask
+//
+// Bit k is set when event indicator k changed sign between two FMU event indicator snapshots
+// Sign tests are vectorized and packed into 64-bit words so set bits are visited in event indicator index order
+class CrossingMask final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Word = std::uint64_t;
+	using Words = std::vector< Word >;
+
+public: // Creation
+
+	// Default Constructor
+	CrossingMask() = default;
+
+	// Size Constructor
+	explicit
+	CrossingMask( size_type const n ) :
+	 n_( n ),
+	 words_( n_words( n ), Word( 0u ) )
+	{}
+
+public: // Predicate
+
+	// Any Bits Set?
+	bool
+	any() const
+	{
+		for ( Word const word : words_ ) {
+			if ( word != 0u ) return true;
+		}
+		return false;
+	}
+
+	// Bit k Set?
+	bool
+	test( size_type const k ) const
+	{
+		assert( k < n_ );
+		return ( words_[ k / 64u ] >> ( k % 64u ) ) & Word( 1u );
+	}
+
+public: // Property
+
+	// Size
+	size_type
+	size() const
+	{
+		return n_;
+	}
+
+	// Number of Bits Set
+	size_type
+	count() const
+	{
+		size_type c( 0u );
+		for ( Word const word : words_ ) {
+			c += static_cast< size_type >( std::popcount( word ) );
+		}
+		return c;
+	}
+
+public: // Operator
+
+	// |= Another Mask
+	CrossingMask &
+	operator |=( CrossingMask const & mask )
+	{
+		assert( mask.n_ == n_ );
+		for ( size_type w = 0u, e = words_.size(); w < e; ++w ) {
+			words_[ w ] |= mask.words_[ w ];
+		}
+		return *this;
+	}
+
+public: // Methods
+
+	// Resize and Clear
+	void
+	resize( size_type const n )
+	{
+		n_ = n;
+		words_.assign( n_words( n ), Word( 0u ) );
+	}
+
+	// Clear
+	void
+	clear()
+	{
+		for ( Word & word : words_ ) word = Word( 0u );
+	}
+
+	// Set Bit k
+	void
+	set( size_type const k )
+	{
+		assert( k < n_ );
+		words_[ k / 64u ] |= Word( 1u ) << ( k % 64u );
+	}
+
+	// Scan Event Indicators for Sign Changes: Returns Whether Any Crossed
+	bool
+	scan( double const * const v, double const * const v_last )
+	{
+		assert( ( n_ == 0u ) || ( ( v != nullptr ) && ( v_last != nullptr ) ) );
+		Word any( 0u );
+		size_type const n_full( n_ / 64u );
+		for ( size_type w = 0u; w < n_full; ++w ) {
+			size_type const k( w * 64u );
+			any |= ( words_[ w ] = scan_word( v + k, v_last + k, 64u ) );
+		}
+		size_type const n_tail( n_ % 64u );
+		if ( n_tail > 0u ) {
+			size_type const k( n_full * 64u );
+			any |= ( words_[ n_full ] = scan_word( v + k, v_last + k, n_tail ) );
+		}
+		return any != 0u;
+	}
+
+	// Apply a Function to Each Set Bit Index in Increasing Order
+	template< typename F >
+	void
+	for_each( F && f ) const
+	{
+		for ( size_type w = 0u, e = words_.size(); w < e; ++w ) {
+			Word word( words_[ w ] );
+			while ( word != 0u ) {
+				f( ( w * 64u ) + static_cast< size_type >( std::countr_zero( word ) ) );
+				word &= word - 1u; // Clear lowest set bit
+			}
+		}
+	}
+
+private: // Static Methods
+
+	// Number of Words for n Bits
+	static
+	size_type
+	n_words( size_type const n )
+	{
+		return ( n + 63u ) / 64u;
+	}
+
+	// Scan Up to 64 Event Indicators into a Word
+	static
+	Word
+	scan_word( double const * const v, double const * const v_last, size_type const m )
+	{
+		assert( m <= 64u );
+		Word word( 0u );
+		size_type k( 0u );
+#if defined(__AVX__)
+		__m256d const zero( _mm256_setzero_pd() );
+		for ( size_type const e( m & ~size_type( 3u ) ); k < e; k += 4u ) {
+			__m256d const ge( _mm256_cmp_pd( _mm256_loadu_pd( v + k ), zero, _CMP_GE_OQ ) );
+			__m256d const gt( _mm256_cmp_pd( _mm256_loadu_pd( v_last + k ), zero, _CMP_GT_OQ ) );
+			word |= Word( static_cast< unsigned >( _mm256_movemask_pd( _mm256_xor_pd( ge, gt ) ) ) ) << k;
+		}
+#elif defined(__SSE2__)
+		__m128d const zero( _mm_setzero_pd() );
+		for ( size_type const e( m & ~size_type( 1u ) ); k < e; k += 2u ) {
+			__m128d const ge( _mm_cmpge_pd( _mm_loadu_pd( v + k ), zero ) );
+			__m128d const gt( _mm_cmpgt_pd( _mm_loadu_pd( v_last + k ), zero ) );
+			word |= Word( static_cast< unsigned >( _mm_movemask_pd( _mm_xor_pd( ge, gt ) ) ) ) << k;
+		}
+#endif
+		for ( ; k < m; ++k ) { // Remainder (or portable branch-free fallback)
+			word |= Word( ( v[ k ] >= 0.0 ) != ( v_last[ k ] > 0.0 ) ) << k;
+		}
+		return word;
+	}
+
+private: // Data
+
+	size_type n_{ 0u }; // Number of bits
+	Words words_; // Bit words
+
+}; // CrossingMask
+
+} // QSS
+
+#endif
@@ -36,9 +36,13 @@
 #ifndef QSS_Dependencies_hh_INCLUDED
 #define QSS_Dependencies_hh_INCLUDED
 
+// QSS Headers
+#include <QSS/CSR.hh>
+
 // C++ Headers
 #include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <unordered_map>
 #include <utility> // std::move
@@ -323,6 +327,124 @@ public: // Methods
 
 }; // FMU_Dependencies
 
+// FMU Variable Dependencies Dense Graph
+//
+// Index-addressed CSR form of the FMU dependencies built once annotation parsing is complete
+// FMU variable indexes are 1-based so node 0 is unused
+struct FMU_DepGraph final
+{
+	// Types
+	using Index = std::uint32_t;
+	using Graph = CSR< Index >;
+	using Edge = Graph::Edge;
+	using Edges = Graph::Edges;
+	using const_iterator = Graph::const_iterator;
+	using size_type = std::size_t;
+
+public: // Creation
+
+	// Default Constructor
+	FMU_DepGraph() = default;
+
+public: // Predicate
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return n_has_ == 0u;
+	}
+
+	// Has Dependencies Entry for FMU Variable?
+	bool
+	has( size_type const idx ) const
+	{
+		return ( idx < has_.size() ) && has_[ idx ];
+	}
+
+public: // Property
+
+	// Number of FMU Variables
+	size_type
+	n() const
+	{
+		return has_.empty() ? 0u : has_.size() - 1u;
+	}
+
+	// Number of Dependencies
+	size_type
+	n_edges() const
+	{
+		return g_.n_edges();
+	}
+
+	// Observees Begin Iterator of FMU Variable
+	const_iterator
+	begin( size_type const idx ) const
+	{
+		return g_.begin( Index( idx ) );
+	}
+
+	// Observees End Iterator of FMU Variable
+	const_iterator
+	end( size_type const idx ) const
+	{
+		return g_.end( Index( idx ) );
+	}
+
+	// Observee Graph
+	Graph const &
+	graph() const
+	{
+		return g_;
+	}
+
+public: // Methods
+
+	// Assign from Dependencies Collection with n FMU Variables
+	void
+	assign(
+	 FMU_Dependencies const & deps,
+	 size_type const n
+	)
+	{
+		has_.assign( n + 1u, false );
+		n_has_ = 0u;
+		size_type n_edges( 0u );
+		for ( FMU_Dependencies::value_type const & idx_var : deps ) n_edges += idx_var.second.observees.size();
+		Edges edges;
+		edges.reserve( n_edges );
+		for ( FMU_Dependencies::value_type const & idx_var : deps ) {
+			assert( idx_var.first <= n );
+			has_[ idx_var.first ] = true;
+			++n_has_;
+			for ( FMU_Dependencies::Index const observee : idx_var.second.observees ) edges.emplace_back( Index( idx_var.first ), Index( observee ) );
+		}
+		g_.assign( Index( n + 1u ), edges );
+	}
+
+	// Assign Edges: Entries Unchanged
+	void
+	assign( Edges const & edges )
+	{
+		g_.assign( Index( has_.size() ), edges );
+	}
+
+	// Sort and Uniquify Observees
+	void
+	finalize()
+	{
+		g_.sort_and_uniquify();
+	}
+
+private: // Data
+
+	Graph g_; // Observee graph
+	std::vector< bool > has_; // FMU variables with a dependencies entry
+	size_type n_has_{ 0u }; // Number of FMU variables with a dependencies entry
+
+}; // FMU_DepGraph
+
 // Dependencies Global Lookup by FMU-ME Context
 namespace { // Pollution control
 using All_Dependencies = std::vector< FMU_Dependencies >;
@@ -47,10 +47,13 @@
 #include <QSS/SuperdenseTime.hh>
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace QSS {
@@ -479,87 +482,123 @@ public: // Methods
 	// QSS Requantization Bin Subtypes at Front of Queue
 	template< typename S >
 	void
-	bin_QSS( size_type const bin_size, double const bin_frac, std::vector< S * > & subs )
+	bin_QSS( size_type const bin_size, double const bin_frac, std::vector< S * > & subs, bool const local = false )
 	{
 		subs.clear();
 		if ( !m_.empty() ) {
 			iterator i( m_.begin() );
 			iterator const e( m_.end() );
 			SuperdenseTime const & s( i->first );
+			std::uint64_t loc( 0u ); // Front triggers locality signature
 			while ( ( i != e ) && ( i->first == s ) ) { // First get the simultaneous events
-				subs.push_back( i->second.template sub< S >() );
+				S * sub( i->second.template sub< S >() );
+				subs.push_back( sub );
+				if ( local ) loc |= sub->locality();
 				++i;
 			}
 			Time const t_top( s.t );
 			size_type j( 0u ); // Loop counter (non-simultaneous events)
+			bin_others_.clear();
 			while ( ( i != e ) && ( ++j < 5 * bin_size ) && ( subs.size() < bin_size ) ) { // Bin events
 				if ( i->second.is_QSS() ) { // QSS requantization event
 					S * sub( i->second.template sub< S >() );
 					double const sub_frac( ( t_top - sub->tQ ) / ( sub->tE - sub->tQ ) );
 					if ( sub_frac >= bin_frac ) { // Time step fraction is acceptable
-						subs.push_back( sub );
+						if ( ( !local ) || ( ( sub->locality() & loc ) != 0u ) ) { // Shares observees/cluster with front triggers
+							subs.push_back( sub );
+						} else { // Defer to fill any remaining bin space
+							bin_others_.push_back( sub );
+						}
 					}
 				}
 				++i;
 			}
+			if ( subs.size() < bin_size ) { // Fill remaining bin space with deferred events
+				size_type const n( std::min( bin_others_.size(), bin_size - subs.size() ) );
+				for ( size_type k = 0u; k < n; ++k ) subs.push_back( static_cast< S * >( bin_others_[ k ] ) );
+			}
 		}
 	}
 
 	// QSS ZC Requantization Bin Subtypes at Front of Queue
 	template< typename S >
 	void
-	bin_QSS_ZC( size_type const bin_size, double const bin_frac, std::vector< S * > & subs )
+	bin_QSS_ZC( size_type const bin_size, double const bin_frac, std::vector< S * > & subs, bool const local = false )
 	{
 		subs.clear();
 		if ( !m_.empty() ) {
 			iterator i( m_.begin() );
 			iterator const e( m_.end() );
 			SuperdenseTime const & s( i->first );
+			std::uint64_t loc( 0u ); // Front triggers locality signature
 			while ( ( i != e ) && ( i->first == s ) ) { // First get the simultaneous events
-				subs.push_back( i->second.template sub< S >() );
+				S * sub( i->second.template sub< S >() );
+				subs.push_back( sub );
+				if ( local ) loc |= sub->locality();
 				++i;
 			}
 			Time const t_top( s.t );
 			size_type j( 0u ); // Loop counter (non-simultaneous events)
+			bin_others_.clear();
 			while ( ( i != e ) && ( ++j < 5 * bin_size ) && ( subs.size() < bin_size ) ) { // Bin events
 				if ( i->second.is_QSS_ZC() ) { // QSS ZC requantization event
 					S * sub( i->second.template sub< S >() );
 					double const sub_frac( ( t_top - sub->tQ ) / ( sub->tE - sub->tQ ) );
 					if ( sub_frac >= bin_frac ) { // Time step fraction is acceptable
-						subs.push_back( sub );
+						if ( ( !local ) || ( ( sub->locality() & loc ) != 0u ) ) { // Shares observees/cluster with front triggers
+							subs.push_back( sub );
+						} else { // Defer to fill any remaining bin space
+							bin_others_.push_back( sub );
+						}
 					}
 				}
 				++i;
 			}
+			if ( subs.size() < bin_size ) { // Fill remaining bin space with deferred events
+				size_type const n( std::min( bin_others_.size(), bin_size - subs.size() ) );
+				for ( size_type k = 0u; k < n; ++k ) subs.push_back( static_cast< S * >( bin_others_[ k ] ) );
+			}
 		}
 	}
 
 	// QSS R Requantization Bin Subtypes at Front of Queue
 	template< typename S >
 	void
-	bin_QSS_R( size_type const bin_size, double const bin_frac, std::vector< S * > & subs )
+	bin_QSS_R( size_type const bin_size, double const bin_frac, std::vector< S * > & subs, bool const local = false )
 	{
 		subs.clear();
 		if ( !m_.empty() ) {
 			iterator i( m_.begin() );
 			iterator const e( m_.end() );
 			SuperdenseTime const & s( i->first );
+			std::uint64_t loc( 0u ); // Front triggers locality signature
 			while ( ( i != e ) && ( i->first == s ) ) { // First get the simultaneous events
-				subs.push_back( i->second.template sub< S >() );
+				S * sub( i->second.template sub< S >() );
+				subs.push_back( sub );
+				if ( local ) loc |= sub->locality();
 				++i;
 			}
 			Time const t_top( s.t );
 			size_type j( 0u ); // Loop counter (non-simultaneous events)
+			bin_others_.clear();
 			while ( ( i != e ) && ( ++j < 5 * bin_size ) && ( subs.size() < bin_size ) ) { // Bin events
 				if ( i->second.is_QSS_R() ) { // QSS R requantization event
 					S * sub( i->second.template sub< S >() );
 					double const sub_frac( ( t_top - sub->tQ ) / ( sub->tE - sub->tQ ) );
 					if ( sub_frac >= bin_frac ) { // Time step fraction is acceptable
-						subs.push_back( sub );
+						if ( ( !local ) || ( ( sub->locality() & loc ) != 0u ) ) { // Shares observees/cluster with front triggers
+							subs.push_back( sub );
+						} else { // Defer to fill any remaining bin space
+							bin_others_.push_back( sub );
+						}
 					}
 				}
 				++i;
 			}
+			if ( subs.size() < bin_size ) { // Fill remaining bin space with deferred events
+				size_type const n( std::min( bin_others_.size(), bin_size - subs.size() ) );
+				for ( size_type k = 0u; k < n; ++k ) subs.push_back( static_cast< S * >( bin_others_[ k ] ) );
+			}
 		}
 	}
 
@@ -593,9 +632,7 @@ public: // Discrete Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::Discrete ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::Discrete ), EventT( Type::Discrete, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::Discrete ), Type::Discrete );
 	}
 
 public: // Zero-Crossing Event Methods
@@ -620,9 +657,7 @@ public: // Zero-Crossing Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::ZC ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::ZC ), EventT( Type::ZC, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::ZC ), Type::ZC );
 	}
 
 public: // Conditional Event Methods
@@ -644,18 +679,14 @@ public: // Conditional Event Methods
 		assert( t_ == s_.t );
 		assert( t == t_ );
 		Index const idx( s_.o < Off::Conditional ? s_.i : s_.i + 1u );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::Conditional ), EventT( Type::Conditional, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::Conditional ), Type::Conditional );
 	}
 
 	// Shift Conditional Event to Time Infinity
 	iterator
 	shift_conditional( iterator const i )
 	{
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( infinity, 0, Off::Conditional ), EventT( Type::Conditional, tar ) );
+		return shift_node( i, SuperdenseTime( infinity, 0, Off::Conditional ), Type::Conditional );
 	}
 
 public: // Handler Event Methods
@@ -699,18 +730,14 @@ public: // Handler Event Methods
 		assert( t_ == s_.t );
 		assert( t == t_ );
 		Index const idx( s_.o < Off::Handler ? s_.i : s_.i + 1u );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::Handler ), EventT( Type::Handler, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::Handler ), Type::Handler );
 	}
 
 	// Shift Handler Event to Time Infinity
 	iterator
 	shift_handler( iterator const i )
 	{
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( infinity, 0, Off::Handler ), EventT( Type::Handler, tar ) );
+		return shift_node( i, SuperdenseTime( infinity, 0, Off::Handler ), Type::Handler );
 	}
 
 	// Shift Handler Event Joining Any Handler(s) at Front of Queue
@@ -723,9 +750,7 @@ public: // Handler Event Methods
 		assert( t_ == s_.t );
 		assert( t == t_ );
 		Index const idx( s_.o <= Off::Handler ? s_.i : s_.i + 1u );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::Handler ), EventT( Type::Handler, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::Handler ), Type::Handler );
 	}
 
 public: // QSS Event Methods
@@ -750,9 +775,7 @@ public: // QSS Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::QSS ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::QSS ), EventT( Type::QSS, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::QSS ), Type::QSS );
 	}
 
 public: // QSS R Event Methods
@@ -777,9 +800,7 @@ public: // QSS R Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::QSS_R ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::QSS_R ), EventT( Type::QSS_R, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::QSS_R ), Type::QSS_R );
 	}
 
 public: // QSS ZC Event Methods
@@ -804,9 +825,7 @@ public: // QSS ZC Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::QSS_ZC ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::QSS_ZC ), EventT( Type::QSS_ZC, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::QSS_ZC ), Type::QSS_ZC );
 	}
 
 public: // QSS Input Event Methods
@@ -831,9 +850,23 @@ public: // QSS Input Event Methods
 		assert( t_ == s_.t );
 		assert( t >= t_ );
 		Index const idx( t == t_ ? ( s_.o < Off::QSS_Inp ? s_.i : s_.i + 1u ) : Index( 0 ) );
-		Target * tar( i->second.tar() );
-		m_.erase( i );
-		return m_.emplace( SuperdenseTime( t, idx, Off::QSS_Inp ), EventT( Type::QSS_Inp, tar ) );
+		return shift_node( i, SuperdenseTime( t, idx, Off::QSS_Inp ), Type::QSS_Inp );
+	}
+
+private: // Methods
+
+	// Shift an Event by Reusing its Map Node: No Allocation
+	iterator
+	shift_node(
+	 iterator const i,
+	 SuperdenseTime const & s,
+	 Type const type
+	)
+	{
+		typename EventMap::node_type node( m_.extract( i ) );
+		node.key() = s;
+		node.mapped() = EventT( type, node.mapped().tar() );
+		return m_.insert( std::move( node ) );
 	}
 
 private: // Static Data
@@ -845,6 +878,7 @@ private: // Data
 	EventMap m_;
 	SuperdenseTime s_; // Active event superdense time
 	Time t_{ 0.0 }; // Active event time
+	Targets bin_others_; // Locality binning deferred events
 
 }; // EventQueue
 
@@ -35,12 +35,16 @@
 
 // QSS Headers
 #include <QSS/FMU_ME.hh>
+#include <QSS/AllocCheck.hh>
 #include <QSS/annotation.hh>
 #include <QSS/BinOptimizer.hh>
+#include <QSS/BumpPeers.hh>
 #include <QSS/Clusters.hh>
 #include <QSS/Conditional.hh>
 #include <QSS/container.hh>
+#include <QSS/CrossingMask.hh>
 #include <QSS/cpu_time.hh>
+#include <QSS/computational.hh>
 #include <QSS/cycles.hh>
 #include <QSS/dependency_clusters.hh>
 #include <QSS/EventIndicators.hh>
@@ -48,13 +52,19 @@
 #include <QSS/Function_Inp_sin.hh>
 #include <QSS/Function_Inp_step.hh>
 #include <QSS/Function_Inp_toggle.hh>
+#include <QSS/Glob.hh>
 #include <QSS/Handlers.hh>
 #include <QSS/math.hh>
 #include <QSS/options.hh>
+#include <QSS/OutputPool.hh>
 #include <QSS/path.hh>
+#include <QSS/PlanCache.hh>
 #include <QSS/Range.hh>
+#include <QSS/rcm.hh>
+#include <QSS/scc.hh>
 #include <QSS/string.hh>
 #include <QSS/Timers.hh>
+#include <QSS/Timing.hh>
 #include <QSS/Triggers_QSS.hh>
 #include <QSS/Triggers_ZC.hh>
 #include <QSS/Triggers_R.hh>
@@ -73,6 +83,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <fstream>
@@ -80,6 +91,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <numeric>
 #include <unordered_set>
 #include <utility>
 
@@ -99,29 +111,36 @@ namespace QSS {
 		std::free( der_list );
 		if ( fmu ) fmi2_import_free( fmu );
 		if ( context ) fmi_import_free_context( context );
-		for ( Variable * var : vars ) delete var;
+		for ( Variable * var : vars ) var_arena.destroy( var );
 		for ( Conditional< Variable_ZC > * con : cons ) delete con;
 		for ( auto & f_out : f_outs ) f_out.flush();
 		for ( auto & l_out : l_outs ) l_out.flush();
+		delete shm;
 		if ( eventq_own ) delete eventq;
 	}
 
-	// Variable Lookup by Name (for Testing)
+	// Variable Lookup by Name
 	Variable const *
 	FMU_ME::
 	var_named( std::string const & var_name ) const
 	{
-		auto const var_it( std::find_if( vars.begin(), vars.end(), [ &var_name ]( Variable const * var ){ return var->name() == var_name; } ) );
-		return var_it != vars.end() ? *var_it : nullptr;
+		NameTable::Id const id( NameTable::instance().find( var_name ) );
+		if ( id == NameTable::none ) return nullptr; // Name was never interned
+		if ( var_name_var.size() != vars.size() ) { // Build the lookup on first use or after variables are added
+			var_name_var.clear();
+			var_name_var.reserve( vars.size() );
+			for ( Variable * var : vars ) var_name_var[ var->name_id() ] = var;
+		}
+		auto const i( var_name_var.find( id ) );
+		return i != var_name_var.end() ? i->second : nullptr;
 	}
 
-	// Variable Lookup by Name (for Testing)
+	// Variable Lookup by Name
 	Variable *
 	FMU_ME::
 	var_named( std::string const & var_name )
 	{
-		auto var_it( std::find_if( vars.begin(), vars.end(), [ &var_name ]( Variable const * var ){ return var->name() == var_name; } ) );
-		return var_it != vars.end() ? *var_it : nullptr;
+		return const_cast< Variable * >( static_cast< FMU_ME const & >( *this ).var_named( var_name ) );
 	}
 
 	// Initialize
@@ -133,6 +152,7 @@ namespace QSS {
 			std::cerr << "\nFMU-ME name is not of the form <model>.fmu" << std::endl;
 			std::exit( EXIT_FAILURE );
 		}
+		Timing::Phase timing( path::base( path ), "initialize" );
 
 		// Set up FMU callbacks and context
 		callbacks.malloc = std::malloc;
@@ -186,6 +206,7 @@ namespace QSS {
 		}
 
 		// Get/check FMU's FMI version
+		timing.sub( "unzip" );
 		fmi_version_enu_t const fmi_version( fmi_import_get_fmi_version( context, path.c_str(), unzip_dir.c_str() ) );
 		if ( fmi_version != fmi_version_2_0_enu ) {
 			std::cerr << "\nError: FMU-ME is not FMI 2.0" << std::endl;
@@ -193,6 +214,7 @@ namespace QSS {
 		}
 
 		// Parse the XML: Set up EventIndicators and Dependencies data structures
+		timing.sub( "parse XML" );
 		all_eventindicators.emplace_back( this );
 		all_dependencies.emplace_back( this );
 		fmu = fmi2_import_parse_xml( context, unzip_dir.c_str(), &xml_callbacks );
@@ -208,6 +230,7 @@ namespace QSS {
 		}
 
 		// Load the FMU-ME library
+		timing.sub( "load library" );
 		callBackFunctions.logger = fmi2_log_forwarding;
 		callBackFunctions.allocateMemory = std::calloc;
 		callBackFunctions.freeMemory = std::free;
@@ -218,6 +241,7 @@ namespace QSS {
 		}
 
 		// Get/check generation tool
+		timing.sub_end();
 		std::string const fmu_generation_tool( fmi2_import_get_generation_tool( fmu ) );
 		std::cout << '\n' + name + " FMU-ME generated by " << fmu_generation_tool << std::endl;
 		fmu_generator = (
@@ -275,6 +299,8 @@ namespace QSS {
 	FMU_ME::
 	instantiate()
 	{
+		Timing::Phase const timing( name, "instantiate" );
+
 		// Instantiate the FMU
 		if ( fmi2_import_instantiate( fmu, "FMU-ME model instance", fmi2_model_exchange, 0, 0 ) == jm_status_error ) {
 			std::cerr << "\nError: fmi2_import_instantiate failed" << std::endl;
@@ -343,8 +369,11 @@ namespace QSS {
 		using Real = Variable::Real;
 		using Name = std::string;
 		using Var_Names = std::vector< Name >;
+		using Var_Ids = std::vector< NameTable::Id >;
 		using Function = std::function< SmoothToken ( Time const ) >;
 
+		Timing::Phase timing( name, "pre_simulate" );
+
 		// I/o setup
 		std::cout << std::setprecision( 16 );
 		std::cerr << std::setprecision( 16 );
@@ -669,9 +698,11 @@ namespace QSS {
 		std::cout << "Model identifier: " << fmi2_import_get_model_identifier_ME( fmu ) << std::endl;
 
 		// Collections
-		Var_Names var_names; // Variable names (to check for duplicates)
+		NameTable & names( NameTable::instance() );
+		Var_Ids var_names; // Variable interned name ids (to check for duplicates)
 
 		// FMU variable list
+		timing.sub( "FMU variables" );
 		var_list = fmi2_import_get_variable_list( fmu, 0 ); // sort order = 0 for original order
 		size_type const n_fmu_vars( fmi2_import_get_variable_list_size( var_list ) );
 		fmu_variables.clear(); fmu_variables.reserve( n_fmu_vars );
@@ -684,9 +715,7 @@ namespace QSS {
 			size_type const idx( i + 1 ); // FMU variable index
 			fmi2_import_variable_t * var( fmi2_import_get_variable( var_list, i ) );
 			std::string const var_name( fmi2_import_get_variable_name( var ) );
-			var_names.push_back( var_name );
-			fmi2_value_reference_t const var_ref( fmi2_import_get_variable_vr( var ) );
-			var_name_ref[ var_name ] = var_ref;
+			var_names.push_back( names.intern( var_name ) );
 			fmi2_base_type_enu_t const var_base_type( fmi2_import_get_variable_base_type( var ) );
 			switch ( var_base_type ) {
 			case fmi2_base_type_real: // Real
@@ -713,6 +742,7 @@ namespace QSS {
 		}
 
 		// FMU Event Indicator Processing
+		timing.sub( "event indicators" );
 		std::cout << "\nFMU Event Indicator Processing =====" << std::endl;
 		size_type n_ZC_vars( 0 );
 		has_event_indicators = false;
@@ -757,6 +787,7 @@ namespace QSS {
 		}
 
 		// FMU Dependencies Retrieval
+		timing.sub( "dependencies retrieval" );
 		std::cout << "\nFMU Dependencies Retrieval =====" << std::endl;
 		auto const ideps( std::find_if( all_dependencies.begin(), all_dependencies.end(), [this]( FMU_Dependencies const & fdeps ){ return fdeps.context == this; } ) );
 		if ( ideps == all_dependencies.end() ) {
@@ -766,14 +797,17 @@ namespace QSS {
 		FMU_Dependencies & fmu_dependencies( *ideps );
 		if ( !fmu_dependencies.empty() ) { // Report dependencies from XML <Dependencies> annotation section
 			std::cout << "\nDependencies:" << std::endl;
-			std::map< FMU_Dependencies::Index, FMU_Dependencies::Variable > const fmu_dep_vars( fmu_dependencies.variables.begin(), fmu_dependencies.variables.end() ); // Use std::map for deterministic display order
-			for ( FMU_Dependencies::Variables::value_type const & idx_var : fmu_dep_vars ) {
-				if ( ( idx_var.first <= 0 ) || ( idx_var.first > n_fmu_vars ) ) {
-					std::cerr << "\nError: Dependencies specified for non-existent variable index: " << idx_var.first << std::endl;
+			std::vector< FMU_Dependencies::Index > fmu_dep_idxs; // Sorted for deterministic display order
+			fmu_dep_idxs.reserve( fmu_dependencies.variables.size() );
+			for ( FMU_Dependencies::value_type const & idx_var : fmu_dependencies ) fmu_dep_idxs.push_back( idx_var.first );
+			std::sort( fmu_dep_idxs.begin(), fmu_dep_idxs.end() );
+			for ( FMU_Dependencies::Index const idx : fmu_dep_idxs ) {
+				if ( ( idx <= 0 ) || ( idx > n_fmu_vars ) ) {
+					std::cerr << "\nError: Dependencies specified for non-existent variable index: " << idx << std::endl;
 					std::exit( EXIT_FAILURE );
 				}
-				std::cout << ' ' << idx_var.first << " -> ";
-				for ( FMU_Dependencies::Index const & idx_observee : idx_var.second.observees ) {
+				std::cout << ' ' << idx << " -> ";
+				for ( FMU_Dependencies::Index const & idx_observee : fmu_dependencies[ idx ].observees ) {
 					std::cout << ' ' << idx_observee;
 					if ( ( idx_observee <= 0 ) || ( idx_observee > n_fmu_vars ) ) {
 						std::cerr << "\nError: Non-existent dependency variable index: " << idx_observee << std::endl;
@@ -783,8 +817,12 @@ namespace QSS {
 				std::cout << '\n';
 			}
 		}
+		FMU_DepGraph dep_graph; // Dense dependency graph
+		dep_graph.assign( fmu_dependencies, n_fmu_vars );
+		FMU_Dependencies::Variables().swap( fmu_dependencies.variables ); // Release the annotation dependencies map
 
 		// FMU Derivative Processing
+		timing.sub( "derivatives" );
 		der_list = fmi2_import_get_derivatives_list( fmu );
 		n_derivatives = fmi2_import_get_variable_list_size( der_list );
 		std::cout << "\nFMU Derivative Processing: " << n_derivatives << " Derivatives =====" << std::endl;
@@ -849,42 +887,42 @@ namespace QSS {
 		}
 
 		// FMU Dependency Processing
+		timing.sub( "FMU dependencies" );
 		std::cout << "\nFMU Dependency Processing =====" << std::endl;
+		FMU_DepGraph::Edges dep_edges; // Dependency graph edges being rebuilt
+		dep_edges.reserve( dep_graph.n_edges() );
 		bool derivative_observees( true );
-		while ( derivative_observees ) { // Short-circuit dependencies on derivatives (as OCT does in <Derivatives> section of XML): This is not currently efficient!
+		while ( derivative_observees ) { // Short-circuit dependencies on derivatives (as OCT does in <Derivatives> section of XML)
 			derivative_observees = false;
-			for ( FMU_Dependencies::Variables::value_type & idx_var : fmu_dependencies.variables ) { // Pair of index and dep::Variable
-				dep::Variable & dep_var( idx_var.second );
-				dep::Variable::Observees & dep_var_observees( dep_var.observees );
-				dep::Variable::Observees new_dep_var_observees;
-				for ( dep::Variable::Observees::size_type ioe = 0u; ioe < dep_var_observees.size(); ++ioe ) {
-					dep::Variable::Index const ide( dep_var_observees[ ioe ] );
-					FMU_Variable const & observee_fmu_var( fmu_variables[ ide - 1 ] ); // FMU variable corresponding to the dep::Variable
-					if ( observee_fmu_var.is_Derivative() ) { // Observee is a derivative
-						assert( dep_var.idx != ide ); // OCT removes derivative self-dependencies
+			dep_edges.clear();
+			for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) {
+				if ( !dep_graph.has( idx ) ) continue;
+				for ( auto i = dep_graph.begin( idx ), e = dep_graph.end( idx ); i != e; ++i ) {
+					FMU_DepGraph::Index const ide( *i );
+					FMU_Variable const & observee_fmu_var( fmu_variables[ ide - 1 ] ); // FMU variable corresponding to the observee index
+					if ( observee_fmu_var.is_Derivative() ) { // Observee is a derivative: Replace it by its observees
+						assert( idx != ide ); // OCT removes derivative self-dependencies
 						derivative_observees = true;
-						dep_var_observees.erase( std::next( dep_var_observees.begin(), ioe ) ); // Remove the derivative observee
-						FMU_Dependencies::iterator i_ide( fmu_dependencies.find( ide ) );
-						if ( i_ide != fmu_dependencies.end() ) { // Derivative has dependencies
-							dep::Variable::Observees const & der_var_observees( i_ide->second.observees );
-							assert( !std::binary_search( der_var_observees.begin(), der_var_observees.end(), ide ) ); // OCT removes derivative self-dependencies
-							for ( dep::Variable::Index const der_var_observee_idx : der_var_observees ) new_dep_var_observees.push_back( der_var_observee_idx );
+						if ( dep_graph.has( ide ) ) { // Derivative has dependencies
+							assert( !std::binary_search( dep_graph.begin( ide ), dep_graph.end( ide ), ide ) ); // OCT removes derivative self-dependencies
+							for ( auto k = dep_graph.begin( ide ), ke = dep_graph.end( ide ); k != ke; ++k ) dep_edges.emplace_back( FMU_DepGraph::Index( idx ), *k );
 						}
+					} else {
+						dep_edges.emplace_back( FMU_DepGraph::Index( idx ), ide );
 					}
 				}
-				if ( !new_dep_var_observees.empty() ) { // Merge in derivative dependencies
-					uniquify( new_dep_var_observees );
-					for ( dep::Variable::Index const new_observee_idx : new_dep_var_observees ) dep_var_observees.push_back( new_observee_idx );
-					uniquify( dep_var_observees ); // Sort and remove duplicates
-				}
+			}
+			if ( derivative_observees ) {
+				dep_graph.assign( dep_edges );
+				dep_graph.finalize(); // Sort and remove duplicates
 			}
 		}
-		for ( FMU_Dependencies::Variables::value_type & idx_var : fmu_dependencies.variables ) { // Check for event indicator (direct) dependencies on event indicators
-			FMU_Variable const & dep_fmu_var( fmu_variables[ idx_var.first - 1 ] ); // FMU variable corresponding to the dep::Variable
+		for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) { // Check for event indicator (direct) dependencies on event indicators
+			if ( !dep_graph.has( idx ) ) continue;
+			FMU_Variable const & dep_fmu_var( fmu_variables[ idx - 1 ] ); // FMU variable corresponding to the dependencies
 			if ( dep_fmu_var.is_EventIndicator() ) { // Event indicator
-				dep::Variable const & dep_var( idx_var.second );
-				for ( dep::Variable::Index const observee : dep_var.observees ) {
-					FMU_Variable const & observee_fmu_var( fmu_variables[ observee - 1 ] ); // FMU variable corresponding to the observee index
+				for ( auto i = dep_graph.begin( idx ), e = dep_graph.end( idx ); i != e; ++i ) {
+					FMU_Variable const & observee_fmu_var( fmu_variables[ *i - 1 ] ); // FMU variable corresponding to the observee index
 					if ( observee_fmu_var.is_EventIndicator() ) { // Observee is an event indicator
 						std::cerr << " Note: FMU dependency of event indicator " << dep_fmu_var.name() << " on event indicator " << observee_fmu_var.name() << std::endl;
 						// Not an error if a temporary variable was short-circuited such as for EIs generated by integer() calls
@@ -892,53 +930,50 @@ namespace QSS {
 				}
 			}
 		}
-		// for ( FMU_Dependencies::Variables::value_type & idx_var : fmu_dependencies.variables ) { // Short-circuit dependencies of event indicators on event indicators: This assumes these dependencies appear when their zero-crossing functions are related
-		// 	FMU_Variable const & dep_fmu_var( fmu_variables[ idx_var.first - 1 ] ); // FMU variable corresponding to the dep::Variable
-		// 	if ( dep_fmu_var.is_EventIndicator() ) { // Event indicator
-		// 		dep::Variable & dep_var( idx_var.second );
-		// 		DepIdxSet nei_observees; // Non event indicator observees in dependency subgraph
-		// 		DepIdxSet ei_observees; // Event indicator observees in dependency subgraph
-		// 		ei_observees.insert( idx_var.first ); // Put observing event indicator in so we skip self-dependency
-		// 		subgraph_ei_observees( fmu_dependencies, dep_var.observees, nei_observees, ei_observees );
-		// 		dep::Variable::Observees new_dep_var_observees( nei_observees.begin(), nei_observees.end() );
-		// 		dep_var.observees = new_dep_var_observees;
-		// 	}
-		// }
-		for ( FMU_Dependencies::Variables::value_type & idx_var : fmu_dependencies.variables ) { // Drill thru dependencies where event indicators depend on event indicators: Temporary hack for OCT EI->EI dependencies that appear when their zero-crossing functions are related
-			FMU_Variable const & dep_fmu_var( fmu_variables[ idx_var.first - 1 ] ); // FMU variable corresponding to the dep::Variable
-			if ( dep_fmu_var.is_EventIndicator() ) { // Event indicator
-				dep::Variable & dep_var( idx_var.second );
-				DepIdxSet nei_observees; // Non event indicator observees in dependency subgraph
-				DepIdxSet ei_observees; // Event indicator observees in dependency subgraph
-				ei_observees.insert( idx_var.first ); // Put observing event indicator in so we skip self-dependency
-				subgraph_ei_observees( fmu_dependencies, dep_var.observees, nei_observees, ei_observees );
-				for ( auto const idx_observee : nei_observees ) {
-					dep_var.observees.push_back( idx_observee ); // This may add duplicates so we uniquify when we finalize
-				}
-			}
-		}
-		fmu_dependencies.finalize();
-		for ( FMU_Dependencies::Variables::value_type & idx_var : fmu_dependencies.variables ) { // Mark handler FMU variables
-			FMU_Variable & dep_fmu_var( fmu_variables[ idx_var.first - 1 ] ); // FMU variable corresponding to the dep::Variable
-			dep::Variable const & dep_var( idx_var.second );
-			for ( dep::Variable::Index const observee : dep_var.observees ) {
-				FMU_Variable const & observee_fmu_var( fmu_variables[ observee - 1 ] ); // FMU variable corresponding to the observee index
+		{ // Drill thru dependencies where event indicators depend on event indicators: Temporary hack for OCT EI->EI dependencies that appear when their zero-crossing functions are related
+			dep_edges.clear();
+			DepIdxMarks ei_marks( n_fmu_vars + 1u, 0u ); // Event indicator observees in dependency subgraph marked by the observing event indicator
+			DepIdxMarks nei_marks( n_fmu_vars + 1u, 0u ); // Non event indicator observees in dependency subgraph marked by the observing event indicator
+			DepIdxs nei_observees; // Non event indicator observees in dependency subgraph
+			for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) {
+				if ( !dep_graph.has( idx ) ) continue;
+				for ( auto i = dep_graph.begin( idx ), e = dep_graph.end( idx ); i != e; ++i ) dep_edges.emplace_back( FMU_DepGraph::Index( idx ), *i );
+				if ( fmu_variables[ idx - 1 ].is_EventIndicator() ) { // Event indicator
+					ei_marks[ idx ] = FMU_DepGraph::Index( idx ); // Mark observing event indicator so we skip self-dependency
+					subgraph_ei_observees( dep_graph, FMU_DepGraph::Index( idx ), ei_marks, nei_marks, nei_observees );
+					for ( FMU_DepGraph::Index const idx_observee : nei_observees ) dep_edges.emplace_back( FMU_DepGraph::Index( idx ), idx_observee ); // Duplicates removed when we finalize
+				}
+			}
+			dep_graph.assign( dep_edges );
+			dep_graph.finalize(); // Sort dependencies by index and uniquify: Need uniquify for EI->EI dependency hack
+			FMU_DepGraph::Edges().swap( dep_edges );
+		}
+		for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) { // Mark handler FMU variables
+			if ( !dep_graph.has( idx ) ) continue;
+			FMU_Variable & dep_fmu_var( fmu_variables[ idx - 1 ] ); // FMU variable corresponding to the dependencies
+			for ( auto i = dep_graph.begin( idx ), e = dep_graph.end( idx ); i != e; ++i ) {
+				FMU_Variable const & observee_fmu_var( fmu_variables[ *i - 1 ] ); // FMU variable corresponding to the observee index
 				if ( observee_fmu_var.is_EventIndicator() ) { // Observee is event indicator => Parent variable is a handler
 					dep_fmu_var.is_handler = true;
 					break;
 				}
 			}
 		}
-		for ( FMU_Dependencies::Variables::value_type const & idx_var : fmu_dependencies.variables ) { // Mark handler variables with upstream state or event indicator observers
-			FMU_Variable const & dep_fmu_var( fmu_variables[ idx_var.first - 1 ] ); // FMU variable corresponding to the dep::Variable
+		for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) { // Mark handler variables with upstream state or event indicator observers
+			if ( !dep_graph.has( idx ) ) continue;
+			FMU_Variable const & dep_fmu_var( fmu_variables[ idx - 1 ] ); // FMU variable corresponding to the dependencies
 			if ( dep_fmu_var.is_State() || dep_fmu_var.is_Derivative() || dep_fmu_var.is_EventIndicator() ) { // State/Derivative or Event indicator
-				dep::Variable const & dep_var( idx_var.second );
-				mark_active_downstream_observees( fmu_dependencies, dep_var );
+				mark_active_downstream_observees( dep_graph, FMU_DepGraph::Index( idx ) );
 			}
 		}
 
+		// QSS Variable Memory Layout
+		timing.sub( "QSS variables" );
+		init_layout( dep_graph );
+
 		// QSS Variable Processing
 		std::cout << "\nQSS Variable Processing =====" << std::endl;
+		fmu_idxs.assign( n_fmu_vars + 1u, nullptr );
 		for ( size_type i = 0u; i < n_fmu_vars; ++i ) {
 			FMU_Variable & fmu_var( fmu_variables[ i ] );
 			size_type const idx( i + 1 );
@@ -1179,23 +1214,23 @@ namespace QSS {
 							switch ( options::order ) {
 							case 1:
 								if ( !options::fQSS ) {
-									qss_var = new Variable_Inp1( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_Inp1 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								} else {
-									qss_var = new Variable_fInp1( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_fInp1 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								}
 								break;
 							case 2:
 								if ( !options::fQSS ) {
-									qss_var = new Variable_Inp2( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_Inp2 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								} else {
-									qss_var = new Variable_fInp2( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_fInp2 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								}
 								break;
 							case 3:
 								if ( !options::fQSS ) {
-									qss_var = new Variable_Inp3( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_Inp3 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								} else {
-									qss_var = new Variable_fInp3( this, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
+									qss_var = new_var< Variable_fInp3 >( idx, var_name, options::rTol, var_aTol, var_start, fmu_var, inp_fxn );
 								}
 								break;
 							default:
@@ -1203,11 +1238,9 @@ namespace QSS {
 								std::exit( EXIT_FAILURE );
 							}
 						} else { // Use connection variables for connections
-							qss_var = new Variable_Con( this, options::order, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_Con >( idx, options::order, var_name, var_start, fmu_var );
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 					} else if ( fmu_var.is_State() ) { // State
 						std::cout << " Type: Real: Continuous: State" << std::endl;
@@ -1223,122 +1256,122 @@ namespace QSS {
 						Variable_QSS * qss_var( nullptr );
 						Real const var_aTol( std::max( options::specified::aTol ? options::aTol : options::rTol * options::aFac * var_nominal, std::numeric_limits< Real >::min() ) ); // Use variable nominal value to set the absolute tolerance unless aTol specified
 						if ( var_name == "time" ) {
-							qss_var = new Variable_time( this, options::order, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+							qss_var = new_var< Variable_time >( idx, options::order, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 						} else {
 							switch ( options::qss ) {
 							case options::QSS::QSS1:
-								qss_var = new Variable_QSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_QSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::QSS2:
-								qss_var = new Variable_QSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_QSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::QSS3:
-								qss_var = new Variable_QSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_QSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::LIQSS1:
-								qss_var = new Variable_LIQSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_LIQSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::LIQSS2:
-								qss_var = new Variable_LIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_LIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::LIQSS3:
-								qss_var = new Variable_LIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_LIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fQSS1:
-								qss_var = new Variable_fQSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fQSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fQSS2:
-								qss_var = new Variable_fQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fQSS3:
-								qss_var = new Variable_fQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fLIQSS1:
-								qss_var = new Variable_fLIQSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fLIQSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fLIQSS2:
-								qss_var = new Variable_fLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::fLIQSS3:
-								qss_var = new Variable_fLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_fLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::iLIQSS1:
-								qss_var = new Variable_iLIQSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_iLIQSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::iLIQSS2:
-								qss_var = new Variable_iLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_iLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::iLIQSS3:
-								qss_var = new Variable_iLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_iLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::ifLIQSS1:
-								qss_var = new Variable_ifLIQSS1( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_ifLIQSS1 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::ifLIQSS2:
-								qss_var = new Variable_ifLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_ifLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::ifLIQSS3:
-								qss_var = new Variable_ifLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_ifLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::rQSS2:
-								qss_var = new Variable_rQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_rQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::rQSS3:
-								qss_var = new Variable_rQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_rQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::rfQSS2:
-								qss_var = new Variable_rfQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_rfQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::rfQSS3:
-								qss_var = new Variable_rfQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_rfQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nQSS2:
-								qss_var = new Variable_nQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nQSS3:
-								qss_var = new Variable_nQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nLIQSS2:
-								qss_var = new Variable_nLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nLIQSS3:
-								qss_var = new Variable_nLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nfQSS2:
-								qss_var = new Variable_nfQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nfQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nfQSS3:
-								qss_var = new Variable_nfQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nfQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nfLIQSS2:
-								qss_var = new Variable_nfLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nfLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nfLIQSS3:
-								qss_var = new Variable_nfLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nfLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::niLIQSS2:
-								qss_var = new Variable_niLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_niLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::niLIQSS3:
-								qss_var = new Variable_niLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_niLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nifLIQSS2:
-								qss_var = new Variable_nifLIQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nifLIQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nifLIQSS3:
-								qss_var = new Variable_nifLIQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nifLIQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nrQSS2:
-								qss_var = new Variable_nrQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nrQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nrQSS3:
-								qss_var = new Variable_nrQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nrQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nrfQSS2:
-								qss_var = new Variable_nrfQSS2( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nrfQSS2 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							case options::QSS::nrfQSS3:
-								qss_var = new Variable_nrfQSS3( this, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
+								qss_var = new_var< Variable_nrfQSS3 >( idx, var_name, options::rTol, var_aTol, options::zTol, state_start, fmu_var, fmu_der );
 								break;
 							default:
 								std::cerr << " Error: Specified QSS method is not supported" << std::endl;
@@ -1346,8 +1379,6 @@ namespace QSS {
 							}
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						state_vars.push_back( qss_var ); // Add to state variables
 						if ( fmu_var.causality_output() || fmu_var.causality_local() ) { // Add to FMU QSS variable outputs
 							if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Skip FMU output of local QSS variables for now
@@ -1364,13 +1395,13 @@ namespace QSS {
 
 						switch ( options::order ) {
 						case 1:
-							qss_var = new Variable_ZC1( this, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
+							qss_var = new_var< Variable_ZC1 >( idx, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
 							break;
 						case 2:
-							qss_var = new Variable_ZC2( this, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
+							qss_var = new_var< Variable_ZC2 >( idx, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
 							break;
 						case 3:
-							qss_var = new Variable_ZC3( this, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
+							qss_var = new_var< Variable_ZC3 >( idx, var_name, var_rTol, var_aTol, options::zTol, var_start, fmu_var );
 							break;
 						default:
 							std::cerr << " Error: Specified QSS method is not supported" << std::endl;
@@ -1378,8 +1409,6 @@ namespace QSS {
 						}
 						cons.push_back( new Conditional< Variable_ZC >( var_name, qss_var, eventq ) ); // Create conditional for the zero-crossing variable
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Add to FMU QSS variable outputs
 							if ( output_filter( var_name ) ) f_outs_vars.push_back( qss_var );
 							fmu_outs.del( fmu_var.rvr ); // Remove it from non-QSS FMU outputs
@@ -1392,10 +1421,10 @@ namespace QSS {
 						if ( fmu_var.is_Discrete() ) { // Continous in theory but actually discrete
 							if ( fmu_var.must_be_active || options::active ) { // Active
 								std::cout << " Type: Real: Continuous: De Facto Discrete: Active" << std::endl;
-								qss_var = new Variable_D( this, var_name, var_start, fmu_var );
+								qss_var = new_var< Variable_D >( idx, var_name, var_start, fmu_var );
 							} else { // Passive
 								std::cout << " Type: Real: Continuous: De Facto Discrete: Passive" << std::endl;
-								qss_var = new Variable_DP( this, var_name, var_start, fmu_var );
+								qss_var = new_var< Variable_DP >( idx, var_name, var_start, fmu_var );
 							}
 						} else { // Continuous
 							if ( fmu_var.must_be_active || options::active ) { // Active
@@ -1405,13 +1434,13 @@ namespace QSS {
 								Real const var_aTol( std::max( options::specified::aTol ? options::aTol : options::rTol * options::aFac * var_nominal, std::numeric_limits< Real >::min() ) ); // Use variable nominal value to set the absolute tolerance unless aTol specified
 								switch ( options::order ) {
 								case 1:
-									qss_var = new Variable_R1( this, var_name, var_rTol, var_aTol, var_start, fmu_var );
+									qss_var = new_var< Variable_R1 >( idx, var_name, var_rTol, var_aTol, var_start, fmu_var );
 									break;
 								case 2:
-									qss_var = new Variable_R2( this, var_name, var_rTol, var_aTol, var_start, fmu_var );
+									qss_var = new_var< Variable_R2 >( idx, var_name, var_rTol, var_aTol, var_start, fmu_var );
 									break;
 								case 3:
-									qss_var = new Variable_R3( this, var_name, var_rTol, var_aTol, var_start, fmu_var );
+									qss_var = new_var< Variable_R3 >( idx, var_name, var_rTol, var_aTol, var_start, fmu_var );
 									break;
 								default:
 									std::cerr << " Error: Specified QSS method is not supported" << std::endl;
@@ -1419,12 +1448,10 @@ namespace QSS {
 								}
 							} else { // Passive
 								std::cout << " Type: Real: Continuous: Non-Discrete: Passive" << std::endl;
-								qss_var = new Variable_RP( this, var_name, var_start, fmu_var );
+								qss_var = new_var< Variable_RP >( idx, var_name, var_start, fmu_var );
 							}
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Add to FMU QSS variable outputs
 							if ( output_filter( var_name ) ) f_outs_vars.push_back( qss_var );
 							fmu_outs.del( fmu_var.rvr ); // Remove it from non-QSS FMU outputs
@@ -1445,23 +1472,19 @@ namespace QSS {
 						// Function inp_fxn( Function_Inp_constant( var_has_xml_start ? xml_start : 0.0 ) ); // Constant start value
 						Function inp_fxn( Function_Inp_step( var_has_xml_start ? xml_start : 0.0, 1.0, 1.0 ) ); // Step up by 1 every 1 s via discrete events
 						// Function inp_fxn( Function_Inp_toggle( var_has_xml_start ? xml_start : 0.0, 1.0, 1.0 ) ); // Toggle by 1 every 1 s via discrete events
-						Variable_InpD * qss_var( new Variable_InpD( this, var_name, var_start, fmu_var, inp_fxn ) );
+						Variable_InpD * qss_var( new_var< Variable_InpD >( idx, var_name, var_start, fmu_var, inp_fxn ) );
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 					} else if ( fmu_var.causality_output() || fmu_var.causality_local() ) { // Output or local
 						Variable * qss_var( nullptr );
 						if ( fmu_var.must_be_active || options::active ) { // Active
 							std::cout << " Type: Real: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Active" << std::endl;
-							qss_var = new Variable_D( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_D >( idx, var_name, var_start, fmu_var );
 						} else { // Passive
 							std::cout << " Type: Real: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Passive" << std::endl;
-							qss_var = new Variable_DP( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_DP >( idx, var_name, var_start, fmu_var );
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ fmu_var.ref() ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 						if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Add to FMU QSS variable outputs
 							if ( output_filter( var_name ) ) f_outs_vars.push_back( qss_var );
@@ -1528,24 +1551,20 @@ namespace QSS {
 						// Function inp_fxn( Function_Inp_constant( var_has_xml_start ? xml_start : 0.0 ) ); // Constant start value
 						Function inp_fxn( Function_Inp_step( ( var_has_xml_start ? xml_start : 0.0 ), 1.0, 1.0 ) ); // Step up by 1 every 1 s via discrete events
 						// Function inp_fxn( Function_Inp_toggle( ( var_has_xml_start ? xml_start : 0.0 ), 1.0, 1.0 ) ); // Toggle by 1 every 1 s via discrete events
-						Variable_InpI * qss_var( new Variable_InpI( this, var_name, var_start, fmu_var, inp_fxn ) );
+						Variable_InpI * qss_var( new_var< Variable_InpI >( idx, var_name, var_start, fmu_var, inp_fxn ) );
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ var_ref ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 
 					} else if ( fmu_var.causality_output() || fmu_var.causality_local() ) { // Output or local
 						Variable * qss_var( nullptr );
 						if ( fmu_var.must_be_active || options::active ) { // Active
 							std::cout << " Type: Integer: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Active" << std::endl;
-							qss_var = new Variable_I( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_I >( idx, var_name, var_start, fmu_var );
 						} else { // Passive
 							std::cout << " Type: Integer: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Passive" << std::endl;
-							qss_var = new Variable_IP( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_IP >( idx, var_name, var_start, fmu_var );
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ var_ref ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 						if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Add to FMU QSS variable outputs
 							if ( output_filter( var_name ) ) f_outs_vars.push_back( qss_var );
@@ -1612,23 +1631,19 @@ namespace QSS {
 					if ( fmu_var.causality_input() ) { // Input
 						std::cout << " Type: Boolean: Discrete: Input" << std::endl;
 						Function inp_fxn( Function_Inp_toggle( 0.0, 1.0, 1.0 ) ); // Toggle 0-1 every 1 s via discrete events
-						Variable_InpB * qss_var( new Variable_InpB( this, var_name, var_start, fmu_var, inp_fxn ) );
+						Variable_InpB * qss_var( new_var< Variable_InpB >( idx, var_name, var_start, fmu_var, inp_fxn ) );
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ var_ref ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 					} else if ( fmu_var.causality_output() || fmu_var.causality_local() ) { // Output or local
 						Variable * qss_var( nullptr );
 						if ( fmu_var.must_be_active || options::active ) { // Active
 							std::cout << " Type: Boolean: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Active" << std::endl;
-							qss_var = new Variable_B( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_B >( idx, var_name, var_start, fmu_var );
 						} else { // Passive
 							std::cout << " Type: Boolean: Discrete: " << ( fmu_var.causality_output() ? "Output" : "Local" ) << ": Passive" << std::endl;
-							qss_var = new Variable_BP( this, var_name, var_start, fmu_var );
+							qss_var = new_var< Variable_BP >( idx, var_name, var_start, fmu_var );
 						}
 						vars.push_back( qss_var ); // Add to QSS variables
-						qss_var_of_ref[ var_ref ] = qss_var;
-						var_name_var[ var_name ] = qss_var;
 						fmu_idxs[ idx ] = qss_var; // Add to map from FMU variable index to QSS variable
 						if ( fmu_var.causality_output() && qss_var->is_Active() ) { // Add to FMU QSS variable outputs
 							if ( output_filter( var_name ) ) f_outs_vars.push_back( qss_var );
@@ -1662,17 +1677,18 @@ namespace QSS {
 		size_type const n_state_vars( state_vars.size() );
 
 		// Duplicate checks
+		timing.sub( "checks and CSV setup" );
 		if ( var_names.size() > 1u ) { // Check for repeat variable names
-			Var_Names sorted_var_names( var_names );
-			std::sort( sorted_var_names.begin(), sorted_var_names.end() );
-			std::string repeat_name;
-			for ( Var_Names::size_type i = 0, l = var_names.size() - 1u; i < l; ++i ) {
-				if ( ( var_names[ i ] == var_names[ i + 1 ] ) && ( var_names[ i ] != repeat_name ) ) { // New repeat name
-					repeat_name = var_names[ i ];
-					std::cerr << " Error: Variable name repeats: " << repeat_name << std::endl;
+			Var_Ids sorted_var_names( var_names );
+			std::sort( sorted_var_names.begin(), sorted_var_names.end() ); // Integer sort: No string comparisons
+			NameTable::Id repeat_name( NameTable::none );
+			for ( Var_Ids::size_type i = 0, l = sorted_var_names.size() - 1u; i < l; ++i ) {
+				if ( ( sorted_var_names[ i ] == sorted_var_names[ i + 1 ] ) && ( sorted_var_names[ i ] != repeat_name ) ) { // New repeat name
+					repeat_name = sorted_var_names[ i ];
+					std::cerr << " Error: Variable name repeats: " << names[ repeat_name ] << std::endl;
 				}
 			}
-			if ( !repeat_name.empty() ) {
+			if ( repeat_name != NameTable::none ) {
 				std::exit( EXIT_FAILURE );
 			}
 		}
@@ -1698,16 +1714,35 @@ namespace QSS {
 		if ( options::csv ) {
 			csv.init( name );
 			Var_Names res_var_names;
-			res_var_indexes.clear();
+			res_R_idx.clear();
+			res_I_idx.clear();
+			res_B_idx.clear();
+			res_R_refs.clear();
+			res_I_refs.clear();
+			res_B_refs.clear();
 			for ( size_type i = 0u; i < n_fmu_vars; ++i ) {
-				Name const & var_name( var_names[ i ] );
-				if ( output_filter.res( var_name ) ) {
+				Name const & var_name( names[ var_names[ i ] ] );
+				if ( output_filter.res( var_name ) ) { // Values are gotten in one batch per type
+					FMU_Variable const & var( fmu_variables[ i ] );
+					size_type const k( res_var_names.size() );
+					if ( var.is_Real() ) {
+						res_R_idx.push_back( k );
+						res_R_refs.push_back( var.ref() );
+					} else if ( var.is_Integer() ) {
+						res_I_idx.push_back( k );
+						res_I_refs.push_back( var.ref() );
+					} else if ( var.is_Boolean() ) {
+						res_B_idx.push_back( k );
+						res_B_refs.push_back( var.ref() );
+					}
 					res_var_names.push_back( var_name );
-					res_var_indexes.push_back( i );
 				}
 			}
 			csv.labels( res_var_names );
-			res_var_vals.clear(); res_var_vals.resize( res_var_indexes.size() );
+			res_var_vals.assign( res_var_names.size(), 0.0 );
+			res_R_vals.resize( res_R_refs.size() );
+			res_I_vals.resize( res_I_refs.size() );
+			res_B_vals.resize( res_B_refs.size() );
 		}
 
 		// Event indicator to Variable_ZC lookup setup
@@ -1721,19 +1756,18 @@ namespace QSS {
 		}
 		ieis->sort(); // Now we can sort the event indicators by their FMU variable index
 
+		DepIdxs().swap( var_slots ); // Variables are all created
+
 		// QSS Dependency Processing
+		timing.sub( "QSS dependencies" );
 		std::cout << "\nQSS Dependency Processing =====" << std::endl;
-		std::map< FMU_Dependencies::Index, FMU_Dependencies::Variable > const fmu_dep_vars( fmu_dependencies.variables.begin(), fmu_dependencies.variables.end() ); // Use std::map for deterministic display order
-		for ( FMU_Dependencies::value_type const & idx_var : fmu_dep_vars ) { // Pair of index and dep::Variable
-			FMU_Dependencies::key_type const idx( idx_var.first );
-			FMU_Variable const & fmu_var( fmu_variables[ idx - 1 ] ); // FMU variable corresponding to the dep::Variable
+		for ( size_type idx = 1u; idx <= n_fmu_vars; ++idx ) { // Index order for deterministic display order
+			if ( !dep_graph.has( idx ) ) continue;
+			FMU_Variable const & fmu_var( fmu_variables[ idx - 1 ] ); // FMU variable corresponding to the dependencies
 			size_type const idv( fmu_var.is_Derivative() ? fmu_var.ids : idx ); // Index of the FMU variable for the QSS variable that has these dependencies
-			auto const i_qss_var( fmu_idxs.find( idv ) );
-			if ( i_qss_var != fmu_idxs.end() ) { // QSS variable that these dependencies apply to exists
-				dep::Variable const & fmu_dependencies_var( idx_var.second );
-				dep::Variable::Observees const & fmu_dependencies_var_observees( fmu_dependencies_var.observees );
-				if ( !fmu_dependencies_var_observees.empty() ) {
-					Variable * qss_var( i_qss_var->second ); // QSS variable that gets these observees
+			Variable * qss_var( qss_var_of_idx( idv ) ); // QSS variable that gets these observees
+			if ( qss_var != nullptr ) { // QSS variable that these dependencies apply to exists
+				if ( dep_graph.begin( idx ) != dep_graph.end( idx ) ) {
 					bool const not_ZC( qss_var->not_ZC() );
 					std::cout << "\n " << fmu_var.name() << " observes:" << std::endl; // FMU variable name shows der() on derivatives to distinguish them from the associated state (unlike qss_var->name())
 					// Should not be any temporaries in the XML now
@@ -1741,11 +1775,11 @@ namespace QSS {
 					// 	dep::Variable::Index const observee_idx( fmu_dependencies_var_observees[ 0 ] );
 					// 	if ( fmu_variables[ observee_idx - 1 ].is_EventIndicator() ) continue; // Temporary variable OCT inserts for an event indicator: Will short-circuit out its dependencies
 					// }
-					for ( dep::Variable::Index const observee_idx : fmu_dependencies_var_observees ) { // Loop over observee indexes
+					for ( auto i_observee = dep_graph.begin( idx ), e_observee = dep_graph.end( idx ); i_observee != e_observee; ++i_observee ) { // Loop over observee indexes
+						size_type const observee_idx( *i_observee );
 						assert( !fmu_variables[ observee_idx - 1 ].is_Derivative() ); // Derivative dependencies were short-circuited out above
-						auto const i_qss_observee_var( fmu_idxs.find( observee_idx ) ); // QSS variable pointer
-						if ( i_qss_observee_var != fmu_idxs.end() ) { // Observee is a QSS variable
-							Variable * qss_observee_var( i_qss_observee_var->second );
+						Variable * qss_observee_var( qss_var_of_idx( observee_idx ) ); // QSS variable pointer
+						if ( qss_observee_var != nullptr ) { // Observee is a QSS variable
 							// Should not be any temporaries in the XML now
 							// if ( qss_observee_var->is_Boolean() && has_prefix( qss_observee_var->name(), "temp_" ) ) { // Boolean observee variable with temporary-style name
 							// 	FMU_Dependencies::const_iterator const & i_observee_dep( fmu_dependencies.find( i_qss_observee_var->first ) );
@@ -1795,9 +1829,8 @@ namespace QSS {
 					fmi2_import_real_variable_t * der_real( fmi2_import_get_variable_as_real( der ) );
 					assert( fmu_dvrs.contains( der_real ) );
 					size_type const idx( fmu_dvrs[ der_real ].idx );
-					auto const ivar( fmu_idxs.find( idx ) );
-					if ( ivar != fmu_idxs.end() ) {
-						Variable * var( ivar->second );
+					Variable * var( qss_var_of_idx( idx ) );
+					if ( var != nullptr ) {
 						// std::cout << " Var: " << var->name() << "  Index: " << idx << std::endl;
 						std::cout << "\n " << der_name << ':' << std::endl;
 						assert( der_name == "der(" + var->name() + ')' );
@@ -1823,9 +1856,8 @@ namespace QSS {
 							// 		std::cout << "   Kind: Num (" << kind << ')' << std::endl;
 							// 	}
 							// }
-							auto const idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
-							if ( idep != fmu_idxs.end() ) {
-								Variable * dep( idep->second );
+							Variable * dep( qss_var_of_idx( dep_idx ) ); //Do Add support for input variable dependents
+							if ( dep != nullptr ) {
 								// if ( dep != var ) { // <Dependencies> has direct der->state dependencies but <Derivatives> has short-circuited ones (including drilling through event indicators) so we skip them here // This alters some results so some of the <Derivatives> der->state dependencies are needed but missing from <Dependencies>
 									var->observe( dep );
 									std::cout << "  " << dep->name() << std::endl;
@@ -1969,9 +2001,8 @@ namespace QSS {
 					}
 					if ( fmu_dis == nullptr ) continue; // Not a variable we care about
 					size_type const idx( fmu_dis->idx );
-					auto const idis( fmu_idxs.find( idx ) ); //Do Add support for input variable dependents
-					if ( idis != fmu_idxs.end() ) {
-						Variable * dis_var( idis->second );
+					Variable * dis_var( qss_var_of_idx( idx ) ); //Do Add support for input variable dependents
+					if ( dis_var != nullptr ) {
 						assert( dis_var->is_Discrete() );
 						for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
 							size_type const dep_idx( dependency[ j ] );
@@ -1995,9 +2026,8 @@ namespace QSS {
 							// 		std::cout << "   Kind: Num (" << kind << ')' << std::endl;
 							// 	}
 							// }
-							auto idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
-							if ( idep != fmu_idxs.end() ) {
-								Variable * dep( idep->second );
+							Variable * dep( qss_var_of_idx( dep_idx ) ); //Do Add support for input variable dependents
+							if ( dep != nullptr ) {
 								dis_var->observe( dep );
 								std::cout << "  " << dep->name() << std::endl;
 							// } else {
@@ -2074,10 +2104,9 @@ namespace QSS {
 					}
 					if ( fmu_out == nullptr ) continue; // Not a type we care about
 					size_type const idx( fmu_out->idx );
-					auto iout( fmu_idxs.find( idx ) ); //Do Add support for input variable dependents
-					if ( ( iout == fmu_idxs.end() ) && ( fmu_var != nullptr ) ) iout = fmu_idxs.find( fmu_var->idx ); // Use variable that output variable is derivative of
-					if ( iout != fmu_idxs.end() ) { // Output variable corresponds to a QSS variable
-						Variable * out_var( iout->second );
+					Variable * out_var( qss_var_of_idx( idx ) ); //Do Add support for input variable dependents
+					if ( ( out_var == nullptr ) && ( fmu_var != nullptr ) ) out_var = qss_var_of_idx( fmu_var->idx ); // Use variable that output variable is derivative of
+					if ( out_var != nullptr ) { // Output variable corresponds to a QSS variable
 						// std::cout << " FMU-ME idx: " << fmu_out->idx << " maps to QSS var: " << out_var->name() << std::endl;
 //						if ( out_var->not_ZC() ) continue; // Don't worry about dependencies of non-ZC output variables on the QSS side //?
 						for ( size_type j = startIndex[ i ]; j < startIndex[ i + 1 ]; ++j ) {
@@ -2102,9 +2131,8 @@ namespace QSS {
 // 									std::cout << "   Kind: Num (" << kind << ')' << std::endl;
 // 								}
 // 							}
-							auto const idep( fmu_idxs.find( dep_idx ) ); //Do Add support for input variable dependents
-							if ( idep != fmu_idxs.end() ) { // Dependency is a QSS variable
-								Variable * dep( idep->second );
+							Variable * dep( qss_var_of_idx( dep_idx ) ); //Do Add support for input variable dependents
+							if ( dep != nullptr ) { // Dependency is a QSS variable
 								out_var->observe( dep );
 								std::cout << "  " << dep->name() << std::endl;
 							// } else { // Dependency is a non-QSS variable
@@ -2128,15 +2156,16 @@ namespace QSS {
 				}
 			}
 		} else if ( options::dep.any() ) {
-			for ( Variable * var : vars ) {
-				for ( options::DepSpecs::Dependency const & dependency : options::dep.dependencies() ) {
-					if ( std::regex_match( var->name(), dependency.spec ) ) {
-						for ( std::regex const & dep_regex : dependency.deps ) {
-							for ( Variable * dep : vars ) {
-								if ( std::regex_match( dep->name(), dep_regex ) ) { // Add the dependency
-									var->observe( dep );
-								}
-							}
+			for ( options::DepSpecs::Dependency const & dependency : options::dep.dependencies() ) { // Match the names against each spec once
+				Variables dep_vars;
+				for ( Variable * dep : vars ) {
+					if ( std::any_of( dependency.deps.begin(), dependency.deps.end(), [ dep ]( options::DepSpecs::Spec const & spec ){ return spec( dep->name() ); } ) ) dep_vars.push_back( dep );
+				}
+				if ( dep_vars.empty() ) continue;
+				for ( Variable * var : vars ) {
+					if ( dependency.spec( var->name() ) ) {
+						for ( Variable * dep : dep_vars ) { // Add the dependency
+							var->observe( dep );
 						}
 					}
 				}
@@ -2144,6 +2173,7 @@ namespace QSS {
 		}
 
 		// Generate Direct Dependency Graph
+		timing.sub( "dependency graph" );
 		if ( options::dot_graph::d ) {
 			std::ofstream dependency_graph( name + ".Dependency.gv", std::ios_base::binary | std::ios_base::out );
 			dependency_graph << "digraph " << name << " {\n";
@@ -2166,6 +2196,7 @@ namespace QSS {
 		}
 
 		// Set Computational Self-Observer Status
+		timing.sub( "containers" );
 		for ( auto var : vars ) {
 			if ( var->self_observer() ) {
 				if ( var->is_ZC() ) {
@@ -2374,18 +2405,34 @@ namespace QSS {
 			options::dtND = dtND_min;
 			std::cout << "\nNumeric differentiation time step raised for compatibility with time range and double precision epsilon: " << options::dtND << std::endl;
 		}
+		Timing::Phase timing( name, "init" );
+		timing.sub( "0.0" );
 		init_0_0();
+		timing.sub( "0.1" );
 		init_0_1();
+		timing.sub( "0.2" );
 		init_0_2();
+		timing.sub( "1.1" );
 		init_1_1();
+		timing.sub( "1.2" );
 		init_1_2();
-		if ( options::dtND_optimizer ) dtND_optimize( t0 );
+		if ( options::dtND_optimizer ) {
+			timing.sub( "dtND_optimize" );
+			dtND_optimize( t0 );
+		}
+		timing.sub( "2.1" );
 		init_2_1();
+		timing.sub( "2.2" );
 		init_2_2();
+		timing.sub( "3.1" );
 		init_3_1();
+		timing.sub( "ZC" );
 		init_ZC();
+		timing.sub( "F" );
 		init_F();
+		timing.sub( "t0" );
 		init_t0();
+		timing.sub_end();
 		init_pre_simulate();
 	}
 
@@ -2416,6 +2463,11 @@ namespace QSS {
 				var->init_time( t0 );
 			}
 		}
+		{ // Computational observees of all variables by index graph traversal: Variable initialization then finds them without passive traversal
+			std::vector< Variables > computational;
+			computational_observees< Variable >( vars, computational );
+			for ( size_type i = 0, n = vars.size(); i < n; ++i ) vars[ i ]->observees() = std::move( computational[ i ] );
+		}
 		for ( auto var : sorted_by_name( vars_NC ) ) {
 			var->init_0();
 		}
@@ -2433,9 +2485,14 @@ namespace QSS {
 		for ( auto var : sorted_by_name( vars_ZC ) ) { // Initialize zero-crossing variable observees
 			var->init_observees();
 		}
-		for ( auto var : vars_NZ ) { // Initialize observers: all variable observees must be initialized first
-			var->init_observers();
+		{ // Initialize observers by index graph traversal: all variable observees must be initialized first
+			std::vector< Variables > computational;
+			computational_observers< Variable >( vars, vars_NZ, computational );
+			for ( size_type i = 0, n = vars_NZ.size(); i < n; ++i ) vars_NZ[ i ]->init_observers( std::move( computational[ i ] ) );
 		}
+		observers_variables_pool.clear(); // Observer arrays are built directly in the model-level pools as observers are finalized
+		observers_refs_pool.clear();
+		observers_reals_pool.clear();
 		for ( auto var : sorted_by_name( vars_NZ ) ) { // Assign computational observers after all are computed and finish initialization
 			var->finalize_observers();
 		}
@@ -2548,7 +2605,10 @@ namespace QSS {
 	FMU_ME::
 	init_pre_simulate()
 	{
+		Timing::Phase timing( name, "init_pre_simulate" );
+
 		// Initialize Conditional observers
+		timing.sub( "observers" );
 		for ( Conditional< Variable_ZC > * con : sorted_by_name( cons ) ) {
 			con->init_observers();
 		}
@@ -2567,6 +2627,12 @@ namespace QSS {
 			vars_HO_ref.push_back( observee->ref() );
 			vars_HO_val.push_back( 0.0 );
 		}
+		vars_HB.reserve( vars_HO.size() );
+		vars_HB_ref.reserve( vars_HO.size() );
+		vars_HB_val.reserve( vars_HO.size() );
+
+		// Set up zero-crossing variable bump peers
+		init_bump_peers();
 
 		// Flag passive ZCs
 		for ( auto var : vars_ZC ) {
@@ -2576,6 +2642,7 @@ namespace QSS {
 		}
 
 		// Generate computational observee graph
+		timing.sub( "dot graphs" );
 		if ( options::dot_graph::e ) {
 			std::ofstream observee_graph( name + ".Observee.gv", std::ios_base::binary | std::ios_base::out );
 			observee_graph << "digraph " << name << " {\n";
@@ -2610,6 +2677,7 @@ namespace QSS {
 		}
 
 		// Dependency cycle detection: After observers set up
+		timing.sub( "cycles and clusters" );
 		if ( options::cycles ) cycles< Variable, Variable_ZC >( vars );
 
 		// Find continuous state variable self-dependency cycles (clusters): After computational observees set up
@@ -2631,29 +2699,19 @@ namespace QSS {
 		if ( !options::clu.empty() ) {
 			Clusters const clusters( options::clu );
 			std::vector< Variable_QSS::Variables_QSS > var_clusters;
-			for ( Cluster const & cluster : clusters ) { // Assemble variable clusters
-				Variable_QSS::Variables_QSS var_cluster;
+			{ // Assemble variable clusters: One pass of the variable names against all cluster specs
+				std::vector< Variable_QSS::Variables_QSS > spec_clusters( std::distance( clusters.begin(), clusters.end() ) );
+				std::vector< Clusters::index_type > idxs;
 				for ( Variable_QSS * var : state_vars ) {
-					if ( cluster( var->name() ) ) {
-						var_cluster.push_back( var );
+					clusters.matches( var->name(), idxs );
+					if ( idxs.size() > 1u ) { // Variable in multiple clusters
+						std::cerr << "\nError: Variable matches multiple cluster specs: " << var->name() << std::endl;
+						std::exit( EXIT_FAILURE );
 					}
+					if ( !idxs.empty() ) spec_clusters[ idxs.front() ].push_back( var );
 				}
-				if ( !var_cluster.empty() ) var_clusters.push_back( var_cluster );
-			}
-			{ // Check for variable(s) in multiple clusters
-				std::unordered_set< Variable_QSS * > var_cluster_set;
-				for ( Variable_QSS::Variables_QSS const & var_cluster : var_clusters ) {
-					for ( Variable_QSS * var : var_cluster ) {
-#if ( __cplusplus >= 202002L ) // C++20+
-						if ( var_cluster_set.contains( var ) ) {
-#else
-						if ( var_cluster_set.find( var ) != var_cluster_set.end() ) {
-#endif
-							std::cerr << "\nError: Variable matches multiple cluster specs: " << var->name() << std::endl;
-							std::exit( EXIT_FAILURE );
-						}
-						var_cluster_set.insert( var );
-					}
+				for ( Variable_QSS::Variables_QSS & var_cluster : spec_clusters ) {
+					if ( !var_cluster.empty() ) var_clusters.push_back( std::move( var_cluster ) );
 				}
 			}
 			for ( Variable_QSS::Variables_QSS const & var_cluster : var_clusters ) { // Add the cluster variables to each's cluster
@@ -2678,13 +2736,32 @@ namespace QSS {
 			options::cluster = true; // To activate cluster use during simulation
 		}
 
+		// Binning locality index: Observee and cluster signatures for locality-aware binning
+		if ( options::bin_local ) {
+			for ( Variable * var : vars ) {
+				var->init_locality();
+			}
+			if ( options::cluster ) {
+				for ( Variable_QSS * var : state_vars ) {
+					if ( var->has_cluster() ) {
+						var->add_locality( var );
+						for ( Variable_QSS const * clu_var : var->cluster ) {
+							var->add_locality( clu_var );
+						}
+					}
+				}
+			}
+		}
+
 		// Output initialization
-		doROut = options::output::R && ( options::output::X || options::output::Q );
-		doZOut = options::output::Z && ( options::output::X || options::output::Q );
-		doDOut = options::output::D && ( options::output::X || options::output::Q );
+		timing.sub( "output" );
+		bool const doXOut( options::output::X || options::output::Q || ( options::shm > 0u ) ); // Trajectory outputs to files and/or shared memory
+		doROut = options::output::R && doXOut;
+		doZOut = options::output::Z && doXOut;
+		doDOut = options::output::D && doXOut;
 		doTOut = options::output::T;
 		doSOut = (
-		 ( options::output::S && ( options::output::X || options::output::Q ) ) ||
+		 ( options::output::S && doXOut ) ||
 		 ( options::output::F && ( n_f_outs > 0u ) ) ||
 		 ( options::output::L && ( n_l_outs > 0u ) ) ||
 		 options::csv
@@ -2765,8 +2842,31 @@ namespace QSS {
 				l_out.append( t, get_as_real( var ) );
 			}
 		}
+		if ( options::shm > 0u ) { // Shared-memory output ring with t0 records
+			delete shm;
+			ShmRing::Vars shm_vars;
+			for ( Variable const * var : vars ) {
+				if ( var->out_on() ) shm_vars.emplace_back( ShmRing::Id( var->var().idx ), var->name() );
+			}
+			shm = new ShmRing( ShmRing::object_name( name ), options::shm, shm_vars );
+			if ( shm->is_open() ) {
+				std::cout << "\nShared-memory output: /dev/shm" << shm->name() << std::endl;
+				for ( Variable const * var : vars ) {
+					if ( var->out_on() ) var->shm_out( t );
+				}
+			} else {
+				delete shm;
+				shm = nullptr;
+			}
+		}
+		init_sampled();
+		init_aggregates();
 
 		// Simulation loop initialization
+		timing.sub( "simulation loop" );
+		if ( ( options::alloc_check > 0u ) && ( !AllocCheck::hooked() ) ) {
+			std::cerr << "\nWarning: Allocation check requires a build with QSS_ALLOC_CHECK defined (make QSS_ALLOC_CHECK=1): Check skipped" << std::endl;
+		}
 		tPer = 0;
 		n_discrete_events = 0;
 		n_QSS_events = 0;
@@ -2814,31 +2914,56 @@ namespace QSS {
 		double const wall_time_beg( omp_get_wtime() ); // Wall time
 #endif
 
-		// Binning setup
-		size_type max_bin_size( 1u ); // Max bin size used since last bin optimizer pass
-		size_type bin_size( std::min( options::bin_size, max( state_vars.size(), vars_ZC.size(), vars.size() - state_vars.size() - vars_ZC.size() ) ) ); // Initial bin size: Bin optimizer will adjust it during the run in auto mode
+		// Binning setup: Separate controls for QSS [0], QSS_ZC [1], and QSS_R [2] requantization bins
+		static char const * const bin_kinds[ 3 ] = { "QSS", "QSS_ZC", "QSS_R" };
+		size_type const n_bin_vars[ 3 ] = { state_vars.size(), vars_ZC.size(), vars.size() - state_vars.size() - vars_ZC.size() }; // Variables of each bin kind
+		size_type max_bin_size[ 3 ] = { 1u, 1u, 1u }; // Max bin size used since last bin optimizer pass
+		size_type const bin_size_ini( std::min( options::bin_size, max( n_bin_vars[ 0 ], n_bin_vars[ 1 ], n_bin_vars[ 2 ] ) ) ); // Initial bin size: Bin optimizer will adjust it during the run in auto mode
+		size_type bin_size[ 3 ] = { bin_size_ini, bin_size_ini, bin_size_ini }; // Bin sizes
 		Real const bin_frac( options::bin_frac ); // Min time step fraction for a binned variable
-		std::pair< size_type, size_type > bin_size_auto( 0u, 0u ); // Automatic bin size total and count for reporting average
+		std::pair< size_type, size_type > bin_size_auto[ 3 ]; // Automatic bin size total and count for reporting average
 		Time const bin_performance_dt_max( tSim / 5.0 ); // Max solution time span for checking performance
 		Time bin_performance_dt( 0.0 ); // Min solution time span for checking performance: adjusted on the fly
 		timers::Performance bin_performance( tPass ); // Solution performance "stopwatch"
-		BinOptimizer bin_optimizer( state_vars.size() ); // Bin size optimizer
+		BinWork bin_work_meter[ 3 ]; // Solution work meters
+		size_type const bin_work_check( 100000u ); // Work that triggers a work metric bin optimizer pass
 		bool const bin_auto( options::specified::bin && options::bin_auto );
-		if ( bin_auto ) bin_performance.start( t ); // Initialize solution performance metric
+		bool const bin_work( bin_auto && options::bin_work ); // Optimize by deterministic work metrics?
+		std::vector< BinOptimizer > bin_optimizers; // Bin size optimizers: Per bin kind in work mode
+		if ( bin_work ) { // Work metric optimizer for each bin kind
+			for ( size_type k = 0u; k < 3u; ++k ) {
+				bin_optimizers.emplace_back( std::max( n_bin_vars[ k ], size_type( 1u ) ) );
+				bin_work_meter[ k ].start( t );
+			}
+		} else { // CPU time optimizer shared by all bin kinds
+			bin_optimizers.emplace_back( state_vars.size() );
+			if ( bin_auto ) bin_performance.start( t ); // Initialize solution performance metric
+		}
 
 		// Simulation loop
 		Variables triggers; // Reusable triggers container
 		Variables handlers; // Reusable handlers container
 		Variable_ZCs var_ZCs_predicted; // Predicted zero-crossing trigger variables
 		Variable_ZCs var_ZCs_detected; // FMU-detected zero-crossing trigger variables
+		CrossingMask ei_crossings( n_event_indicators ); // Event indicator crossings of the last scan
+		CrossingMask ei_detected( n_event_indicators ); // Event indicator crossings detected during a handler event
+		Variable_ZCs var_ZCs_bump; // Zero-crossing variables affected by the predicted crossings: Bumped at handler events
+		Variables handlers_bump; // Handlers of the bumped zero-crossing variables
+		std::pair< size_type, size_type > bump_sizes( 0u, 0u ); // Handler event bump passes and total bumped zero-crossing variables
 		Handlers< Variable > handlers_s( this ); // Simultaneous handlers
-		Triggers_QSS< Variable > triggers_qss_s( this ); // Binned/simultaneous QSS triggers
-		Triggers_ZC< Variable > triggers_zc_s( this ); // Binned/simultaneous ZC triggers
-		Triggers_R< Variable > triggers_r_s( this ); // Binned/simultaneous R triggers
+		using Plan_QSS = TriggersPlan< Triggers_QSS< Variable >, Observers< Variable > >;
+		using Plan_ZC = Triggers_ZC< Variable >;
+		using Plan_R = TriggersPlan< Triggers_R< Variable >, Observers< Variable > >;
+		PlanCache< Plan_QSS, FMU_ME > plans_qss( this, options::plans ); // Binned/simultaneous QSS trigger plans
+		PlanCache< Plan_ZC, FMU_ME > plans_zc( this, options::plans ); // Binned/simultaneous ZC trigger plans
+		PlanCache< Plan_R, FMU_ME > plans_r( this, options::plans ); // Binned/simultaneous R trigger plans
+		std::pair< size_type, size_type > bin_observees[ 3 ]; // Binned/simultaneous QSS|ZC|R advances and observee union size totals
 		Observers< Variable > observers_s( this ); // Binned/simultaneous observers
 		bool connected_output_event( false );
+		bool const alloc_check( ( options::alloc_check > 0u ) && AllocCheck::hooked() ); // Steady-state allocation check?
 		while ( t <= tNext ) {
 			t = eventq->top_time();
+			if ( alloc_check && ( !AllocCheck::armed() ) && ( n_discrete_events + n_QSS_events + n_ZC_events >= options::alloc_check ) ) AllocCheck::arm(); // Warmed up: Count allocations
 			if ( doSOut ) { // QSS and/or FMU sampled outputs
 				Time const tOutStop( std::min( t, tNext ) );
 				while ( tOut < tOutStop ) {
@@ -2863,26 +2988,14 @@ namespace QSS {
 //								if ( state_vars[ i ] != nullptr ) states[ i ] = state_vars[ i ]->x( tOut );
 //							}
 //							fmi2_import_set_continuous_states( fmu, states, n_states );
-							for ( auto const var : vars_NC ) {
-								var->fmu_set_x( tOut );
+							fmu_set_x_NC( tOut );
+							get_l_outs();
+							for ( size_type i = 0u; i < n_l_outs; ++i ) {
+								l_outs[ i ].append( tOut, l_outs_vals[ i ] );
 							}
-							size_type i( 0u );
-							for ( auto const & e : fmu_outs ) {
-								FMU_Variable const & var( *(e.second) );
-								l_outs[ i ].append( tOut, get_as_real( var ) );
-								++i;
-							}
-						}
-					}
-					if ( options::csv ) {
-						for ( auto const var : vars ) {
-							var->fmu_set_x( tOut );
-						}
-						for ( std::size_t i = 0, n = res_var_indexes.size(); i < n; ++i ) {
-							res_var_vals[ i ] = get_as_real( fmu_variables[ res_var_indexes[ i ] ] );
 						}
-						csv.values( res_var_vals );
 					}
+					if ( options::csv ) csv_out( tOut );
 					assert( iOut < std::numeric_limits< size_type >::max() );
 					tOut = t0 + ( ++iOut ) * options::dtOut;
 				}
@@ -2972,6 +3085,10 @@ namespace QSS {
 						}
 
 						trigger->advance_discrete();
+						if ( doAgg ) { // Aggregates
+							trigger->aggregate( t );
+							trigger->observers_aggregate( t );
+						}
 
 						if ( doDOut ) { // Discrete event output: post
 							if ( options::output::A ) { // All variables
@@ -3004,6 +3121,14 @@ namespace QSS {
 							trigger->advance_discrete_simultaneous();
 						}
 						if ( observers_s.have() ) observers_s.advance( t ); // Advance observers
+						if ( doAgg ) { // Aggregates
+							for ( Variable * trigger : triggers ) {
+								trigger->aggregate( t );
+							}
+							for ( Variable * observer : observers_s ) {
+								observer->aggregate( t );
+							}
+						}
 
 						if ( doDOut ) { // Discrete event output: post
 							if ( options::output::A ) { // All variables
@@ -3032,7 +3157,7 @@ namespace QSS {
 						assert( eq_tol( trigger->tZ, t, 1e-15 ) );
 						trigger->st = s; // Set trigger superdense time
 						trigger->advance_ZC();
-						++c_ZC_events[ trigger ];
+						trigger->count_ZC_event();
 						t_bump = std::max( t_bump, trigger->tZC_bump( t ) );
 						if ( doZOut ) { // Zero-crossing event output
 							if ( options::output::A ) { // All variables
@@ -3048,6 +3173,11 @@ namespace QSS {
 
 					// Sort the ZC trigger variables in FMU event indicator index order for efficient comparison with the FMU-detected events
 					std::sort( var_ZCs_predicted.begin(), var_ZCs_predicted.end(), []( Variable_ZC const * var_1, Variable_ZC const * var_2 ){ return var_1->ei_index < var_2->ei_index; } );
+
+					// Zero-crossing variables whose FMU detection is affected by the predicted crossings
+					if ( !options::zcBumpAll ) {
+						merge_bump_peers( var_ZCs_predicted, var_ZCs_bump );
+					}
 				} else if ( event.is_conditional() ) { // Conditional event(s)
 					if ( options::output::d ) std::cout << "Zero-crossing conditional event(s): Time = " << s.t << std::endl;
 					while ( eventq->top_superdense_time() == s ) {
@@ -3055,9 +3185,25 @@ namespace QSS {
 						conditional->st = s; // Set conditional superdense time
 						conditional->advance_conditional(); // Set handler observee state before FMU event detection and shift conditional's next event to t=infinity
 					}
-					prep_all_handlers_observees( t ); // Now we set all handlers' observee state because FMU will process unpredicted zero-crossings
-					for ( Variable * handler : vars_HA ) {
-						handler->fmu_set_x( t ); // Handler derivative, not value, may be set by the FMU event so we set the FMU value at the zero-crossing time here
+					if ( options::zcBumpAll ) { // All handlers
+						prep_all_handlers_observees( t ); // Now we set all handlers' observee state because FMU will process unpredicted zero-crossings
+						for ( Variable * handler : vars_HA ) {
+							handler->fmu_set_x( t ); // Handler derivative, not value, may be set by the FMU event so we set the FMU value at the zero-crossing time here
+						}
+					} else { // Handlers of the zero-crossing variables that will be bumped
+						handlers_bump.clear();
+						for ( Variable_ZC const * var_ZC : var_ZCs_bump ) {
+							if ( var_ZC->conditional != nullptr ) {
+								for ( Variable * handler : var_ZC->conditional->observers() ) {
+									if ( handler->not_ZC() ) handlers_bump.push_back( handler );
+								}
+							}
+						}
+						uniquify( handlers_bump );
+						prep_handlers_observees( handlers_bump, t ); // Now we set the handlers' observee state because FMU will process unpredicted zero-crossings among the bumped variables
+						for ( Variable * handler : handlers_bump ) {
+							handler->fmu_set_x( t ); // Handler derivative, not value, may be set by the FMU event so we set the FMU value at the zero-crossing time here
+						}
 					}
 				} else if ( event.is_handler() ) { // Zero-crossing handler event(s)
 					if ( options::output::d ) std::cout << "Zero-crossing handler event(s): Time = " << s.t << std::endl;
@@ -3070,8 +3216,16 @@ namespace QSS {
 					// for ( Variable_ZC const * trigger : var_ZCs_predicted ) { // Advance predicted zero-crossing variables observees to pre-bump time // DOES USING THIS INSTEAD OF BELOW EVER ALTER RESULTS?????????????????????????
 					// 	trigger->bump_time( t_pre_bump );
 					// }
-					for ( Variable const * var_ZC : vars_ZC ) { // Advance all zero-crossing variables observees to pre-bump time
-						dynamic_cast< Variable_ZC const * >( var_ZC )->bump_time( t_pre_bump );
+					if ( options::zcBumpAll ) {
+						for ( Variable const * var_ZC : vars_ZC ) { // Advance all zero-crossing variables observees to pre-bump time
+							dynamic_cast< Variable_ZC const * >( var_ZC )->bump_time( t_pre_bump );
+						}
+					} else {
+						for ( Variable_ZC const * var_ZC : var_ZCs_bump ) { // Advance affected zero-crossing variables observees to pre-bump time
+							var_ZC->bump_time( t_pre_bump );
+						}
+						++bump_sizes.first;
+						bump_sizes.second += var_ZCs_bump.size();
 					}
 
 					// Get baseline event indicators before the predicted crossing
@@ -3091,16 +3245,16 @@ namespace QSS {
 
 					// Set up for pre-bump and bump time crossing event detection
 					bool zero_crossing_event( false );
-					var_ZCs_detected.clear();
+					ei_detected.clear();
+					auto const set_crossings = [&](){ // Set crossing types of the last scan crossings and accumulate them
+						ei_crossings.for_each( [&]( size_type const k ){ fmu_eis[ k ]->set_crossing( event_indicators_last[ k ], event_indicators[ k ] ); } );
+						ei_detected |= ei_crossings;
+					};
 
 					// Check if any event indicators have triggered at pre-bump time       // DO WE NEED THIS PASS ???????????????????????????????????????????????????????????????????
-					for ( size_type k = 0u; k < n_event_indicators; ++k ) {
-						if ( ( event_indicators[ k ] >= 0.0 ) != ( event_indicators_last[ k ] > 0.0 ) ) {
-							zero_crossing_event = true;
-							Variable_ZC * var_ZC( fmu_eis[ k ] );
-							var_ZC->set_crossing( event_indicators_last[ k ], event_indicators[ k ] );
-							var_ZCs_detected.push_back( var_ZC );
-						}
+					if ( ei_crossings.scan( event_indicators, event_indicators_last ) ) {
+						zero_crossing_event = true;
+						set_crossings();
 					}
 
 					// Zero-crossing time bump (forward) to try and get the FMU to detect relevant crossings
@@ -3111,9 +3265,16 @@ namespace QSS {
 					// 	trigger->bump_time( t_bump );
 					// 	if ( options::output::d ) std::cout << "  " << trigger->name() << " bump value = " << trigger->fmu_get_real() << std::endl;
 					// }
-					for ( Variable const * var_ZC : vars_ZC ) { // Advance all zero-crossing variables observees to bump time
-						dynamic_cast< Variable_ZC const * >( var_ZC )->bump_time( t_bump );
-						if ( options::output::d ) std::cout << "  " << var_ZC->name() << " bump value = " << var_ZC->fmu_get_real() << std::endl;
+					if ( options::zcBumpAll ) {
+						for ( Variable const * var_ZC : vars_ZC ) { // Advance all zero-crossing variables observees to bump time
+							dynamic_cast< Variable_ZC const * >( var_ZC )->bump_time( t_bump );
+							if ( options::output::d ) std::cout << "  " << var_ZC->name() << " bump value = " << var_ZC->fmu_get_real() << std::endl;
+						}
+					} else {
+						for ( Variable_ZC const * var_ZC : var_ZCs_bump ) { // Advance affected zero-crossing variables observees to bump time
+							var_ZC->bump_time( t_bump );
+							if ( options::output::d ) std::cout << "  " << var_ZC->name() << " bump value = " << var_ZC->fmu_get_real() << std::endl;
+						}
 					}
 
 					// Get event indicators after the predicted crossing
@@ -3125,22 +3286,16 @@ namespace QSS {
 					// }
 
 					// Check if any event indicators have triggered
-					for ( size_type k = 0u; k < n_event_indicators; ++k ) {
-						if ( ( event_indicators[ k ] >= 0.0 ) != ( event_indicators_last[ k ] > 0.0 ) ) {
-							zero_crossing_event = true;
-							Variable_ZC * var_ZC( fmu_eis[ k ] );
-							var_ZC->set_crossing( event_indicators_last[ k ], event_indicators[ k ] );
-							var_ZCs_detected.push_back( var_ZC );
-						}
+					if ( ei_crossings.scan( event_indicators, event_indicators_last ) ) {
+						zero_crossing_event = true;
+						set_crossings();
 					}
 
 					// FMU zero-crossing event processing
 					if ( zero_crossing_event ) {
 						if ( options::output::d ) {
 							std::cout << "Predicted zero-crossing triggers FMU-ME event at t=" << t << " for:" << std::endl;
-							for ( Variable_ZC const * var : var_ZCs_detected ) {
-								std::cout << "  " << var->name() << std::endl;
-							}
+							ei_detected.for_each( [&]( size_type const k ){ std::cout << "  " << fmu_eis[ k ]->name() << std::endl; } );
 						}
 						fmi2_import_enter_event_mode( fmu );
 						do_event_iteration();
@@ -3150,17 +3305,12 @@ namespace QSS {
 						fmi2_import_get_event_indicators( fmu, event_indicators, n_event_indicators );
 
 						// Check if any event indicators have triggered due to the event processing
-						bool zero_crossing_event_post( false );
-						for ( size_type k = 0u; k < n_event_indicators; ++k ) {
-							if ( ( event_indicators[ k ] >= 0.0 ) != ( event_indicators_last[ k ] > 0.0 ) ) {
-								zero_crossing_event_post = true;
-								Variable_ZC * var_ZC( fmu_eis[ k ] );
-								var_ZC->set_crossing( event_indicators_last[ k ], event_indicators[ k ] );
-								var_ZCs_detected.push_back( var_ZC ); // It is possible that a duplicate gets added here but that is OK wrt correct handling below
-							}
-						}
-						uniquify( var_ZCs_detected ); // Eliminate duplicates
-						std::sort( var_ZCs_detected.begin(), var_ZCs_detected.end(), []( Variable_ZC const * var_1, Variable_ZC const * var_2 ){ return var_1->ei_index < var_2->ei_index; } ); // Sort by FMU event indicator index
+						bool const zero_crossing_event_post( ei_crossings.scan( event_indicators, event_indicators_last ) );
+						if ( zero_crossing_event_post ) set_crossings(); // Crossings already detected are merged by the mask
+
+						// Detected zero-crossing variables: Unique and in FMU event indicator index order from the mask
+						var_ZCs_detected.clear();
+						ei_detected.for_each( [&]( size_type const k ){ var_ZCs_detected.push_back( fmu_eis[ k ] ); } );
 						if ( zero_crossing_event_post && options::output::d ) {
 							std::cout << "FMU zero-crossing event handling triggers FMU-ME event at t=" << t << " for:" << std::endl;
 							for ( Variable_ZC const * var : var_ZCs_detected ) {
@@ -3188,7 +3338,7 @@ namespace QSS {
 								}
 								if ( !predicted ) {
 									var_detected->st = s; // Set trigger superdense time
-									++c_ZC_events[ var_detected ];
+									var_detected->count_ZC_event();
 									var_detected->tZ = t;
 									var_detected->advance_ZC();
 									var_detected->conditional->st = s;
@@ -3222,8 +3372,14 @@ namespace QSS {
 							// for ( Variable_ZC const * trigger : var_ZCs_predicted ) { // Un-bump time
 							// 	trigger->un_bump_time( t, handler );
 							// }
-							for ( Variable const * var_ZC : vars_ZC ) { // Un-bump time on all zero-crossing variables
-								dynamic_cast< Variable_ZC const * >( var_ZC )->un_bump_time( t, handler );
+							if ( options::zcBumpAll ) {
+								for ( Variable const * var_ZC : vars_ZC ) { // Un-bump time on all zero-crossing variables
+									dynamic_cast< Variable_ZC const * >( var_ZC )->un_bump_time( t, handler );
+								}
+							} else {
+								for ( Variable_ZC const * var_ZC : var_ZCs_bump ) { // Un-bump time on bumped zero-crossing variables
+									var_ZC->un_bump_time( t, handler );
+								}
 							}
 
 							if ( doROut ) { // Handler output: pre
@@ -3233,6 +3389,10 @@ namespace QSS {
 
 							if ( options::dtInfReset ) handler->dt_infinity_reset(); // Reset dtInf relaxation state
 							handler->advance_handler( t );
+							if ( doAgg ) { // Aggregates
+								handler->aggregate( t );
+								handler->observers_aggregate( t );
+							}
 
 							if ( doROut ) { // Handler output: post
 								if ( options::output::A ) { // All variables
@@ -3251,8 +3411,14 @@ namespace QSS {
 							// for ( Variable_ZC const * trigger : var_ZCs_predicted ) { // Un-bump time
 							// 	trigger->un_bump_time( t, handlers );
 							// }
-							for ( Variable const * var_ZC : vars_ZC ) { // Un-bump time on all zero-crossing variables
-								dynamic_cast< Variable_ZC const * >( var_ZC )->un_bump_time( t, handlers );
+							if ( options::zcBumpAll ) {
+								for ( Variable const * var_ZC : vars_ZC ) { // Un-bump time on all zero-crossing variables
+									dynamic_cast< Variable_ZC const * >( var_ZC )->un_bump_time( t, handlers );
+								}
+							} else {
+								for ( Variable_ZC const * var_ZC : var_ZCs_bump ) { // Un-bump time on bumped zero-crossing variables
+									var_ZC->un_bump_time( t, handlers );
+								}
 							}
 
 							if ( doROut ) { // Handler output: pre
@@ -3272,6 +3438,14 @@ namespace QSS {
 								if ( options::dtInfReset ) observers_s.dt_infinity_reset(); // Reset dtInf relaxation state
 								observers_s.advance( t ); // Advance observers
 							}
+							if ( doAgg ) { // Aggregates
+								for ( Variable * handler : handlers ) {
+									handler->aggregate( t );
+								}
+								for ( Variable * observer : observers_s ) {
+									observer->aggregate( t );
+								}
+							}
 
 							if ( doROut && chg ) { // Handler output: post
 								if ( options::output::A ) { // All variables
@@ -3315,13 +3489,7 @@ namespace QSS {
 							// }
 
 							// Check if an event indicator has triggered
-							zero_crossing_event = false;
-							for ( size_type k = 0u; k < n_event_indicators; ++k ) {
-								if ( ( event_indicators[ k ] >= 0.0 ) != ( event_indicators_last[ k ] > 0.0 ) ) {
-									zero_crossing_event = true;
-									break;
-								}
-							}
+							zero_crossing_event = ei_crossings.scan( event_indicators, event_indicators_last );
 
 							// FMU zero-crossing event processing
 							if ( zero_crossing_event ) {
@@ -3364,11 +3532,13 @@ namespace QSS {
 
 				} else if ( event.is_QSS() ) { // QSS requantization event(s)
 					++n_QSS_events;
+					size_type const n_fmu_calls_beg( n_fmu_calls ); // For bin work metric
+					size_type n_observers_s( 0u ); // For bin work metric
 
 					// Trigger(s) setup: Single, simultaneous, or binned
 					Variable * trigger1( nullptr );
-					if ( bin_size > 1u ) {
-						eventq->bin_QSS< Variable >( bin_size, bin_frac, triggers );
+					if ( bin_size[ 0 ] > 1u ) {
+						eventq->bin_QSS< Variable >( bin_size[ 0 ], bin_frac, triggers, options::bin_local );
 						if ( options::output::d ) {
 							std::cout << "\nBin @ " << t << " trigger(s):" << '\n';
 							for ( Variable const * trigger : sorted_by_name( triggers ) ) std::cout << "   " << trigger->name() << "  tQ-tE: " << trigger->tQ << '-' << trigger->tE << '\n';
@@ -3429,7 +3599,7 @@ namespace QSS {
 						Variable * trigger( trigger1 );
 						assert( trigger->tE == t );
 						trigger->st = s; // Set trigger superdense time
-						++c_QSS_events[ trigger ];
+						trigger->count_QSS_event();
 
 						if ( doROut ) { // Requantization output: pre
 							trigger->out_q( t ); // Quantized-only: State requantization has no x discontinuity
@@ -3437,6 +3607,10 @@ namespace QSS {
 						}
 
 						trigger->advance_QSS();
+						if ( doAgg ) { // Aggregates
+							trigger->aggregate( t );
+							trigger->observers_aggregate( t );
+						}
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3454,25 +3628,33 @@ namespace QSS {
 					} else { // Simultaneous/binned triggers
 						if ( options::output::s || options::steps ) { // Statistics or steps file
 							for ( Variable * trigger : triggers ) {
-								++c_QSS_events[ trigger ];
+								trigger->count_QSS_event();
 							}
 						}
 						++n_QSS_simultaneous_events;
-						observers_s.assign( triggers );
+						Plan_QSS & plan( plans_qss( triggers ) ); // Triggers and observers set up
 
 						if ( doROut ) { // Requantization output: pre
 							for ( Variable * trigger : triggers ) { // Triggers
 								trigger->out_q( t ); // Quantized-only: State requantization has no x discontinuity
 							}
 							if ( options::output::O ) { // Observers
-								for ( Variable * observer : observers_s ) {
+								for ( Variable * observer : plan.observers ) {
 									observer->observer_out_pre( t );
 								}
 							}
 						}
 
-						triggers_qss_s.advance( triggers, t, s ); // Advance triggers
-						if ( observers_s.have() ) observers_s.advance( t ); // Advance observers
+						plan.triggers.advance_assigned( triggers, t, s ); // Advance triggers
+						if ( plan.observers.have() ) plan.observers.advance( t ); // Advance observers
+						if ( doAgg ) { // Aggregates
+							for ( Variable * trigger : triggers ) {
+								trigger->aggregate( t );
+							}
+							for ( Variable * observer : plan.observers ) {
+								observer->aggregate( t );
+							}
+						}
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3484,7 +3666,7 @@ namespace QSS {
 									trigger->out( t );
 								}
 								if ( options::output::O ) { // Observers
-									for ( Variable * observer : observers_s ) {
+									for ( Variable * observer : plan.observers ) {
 										observer->observer_out_post( t );
 									}
 								}
@@ -3495,15 +3677,20 @@ namespace QSS {
 								trigger->out_t( t );
 							}
 						}
-						max_bin_size = std::max( max_bin_size, triggers.size() );
+						max_bin_size[ 0 ] = std::max( max_bin_size[ 0 ], triggers.size() );
+						n_observers_s = plan.observers.size();
+						++bin_observees[ 0 ].first;
+						bin_observees[ 0 ].second += plan.triggers.n_observees();
 					}
+					if ( bin_work ) bin_work_meter[ 0 ] += ( n_fmu_calls - n_fmu_calls_beg ) + triggers.size() + ( trigger1 != nullptr ? trigger1->observers().size() : n_observers_s );
 				} else if ( event.is_QSS_ZC() ) { // QSS ZC requantization event(s)
 					++n_QSS_events;
+					size_type const n_fmu_calls_beg( n_fmu_calls ); // For bin work metric
 
 					// Trigger(s) setup: Single, simultaneous, or binned
 					Variable * trigger1( nullptr );
-					if ( bin_size > 1u ) {
-						eventq->bin_QSS_ZC< Variable >( bin_size, bin_frac, triggers );
+					if ( bin_size[ 1 ] > 1u ) {
+						eventq->bin_QSS_ZC< Variable >( bin_size[ 1 ], bin_frac, triggers, options::bin_local );
 						if ( options::output::d ) {
 							std::cout << "\nBin @ " << t << " trigger(s):" << '\n';
 							for ( Variable const * trigger : sorted_by_name( triggers ) ) std::cout << "   " << trigger->name() << "  tQ-tE: " << trigger->tQ << '-' << trigger->tE << '\n';
@@ -3544,13 +3731,17 @@ namespace QSS {
 						assert( trigger->tE == t );
 						assert( trigger->is_ZC() ); // ZC trigger
 						trigger->st = s; // Set trigger superdense time
-						++c_QSS_events[ trigger ];
+						trigger->count_QSS_event();
 
 						if ( doROut ) { // Requantization output: pre
 							trigger->out( t );
 						}
 
 						trigger->advance_QSS();
+						if ( doAgg ) { // Aggregates
+							trigger->aggregate( t );
+							trigger->observers_aggregate( t );
+						}
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3567,7 +3758,7 @@ namespace QSS {
 					} else { // Simultaneous/binned triggers
 						if ( options::output::s || options::steps ) { // Statistics or steps file
 							for ( Variable * trigger : triggers ) {
-								++c_QSS_events[ trigger ];
+								trigger->count_QSS_event();
 							}
 						}
 						++n_QSS_simultaneous_events;
@@ -3578,7 +3769,10 @@ namespace QSS {
 							}
 						}
 
-						triggers_zc_s.advance( triggers, t, s ); // Advance triggers
+						Plan_ZC & plan( plans_zc( triggers ) ); // Triggers set up
+						plan.advance_assigned( triggers, t, s ); // Advance triggers
+						++bin_observees[ 1 ].first;
+						bin_observees[ 1 ].second += plan.n_observees();
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3596,16 +3790,19 @@ namespace QSS {
 								trigger->out_t( t );
 							}
 						}
-						max_bin_size = std::max( max_bin_size, triggers.size() );
+						max_bin_size[ 1 ] = std::max( max_bin_size[ 1 ], triggers.size() );
 					}
+					if ( bin_work ) bin_work_meter[ 1 ] += ( n_fmu_calls - n_fmu_calls_beg ) + triggers.size();
 
 				} else if ( event.is_QSS_R() ) { // QSS R requantization event(s)
 					++n_QSS_events;
+					size_type const n_fmu_calls_beg( n_fmu_calls ); // For bin work metric
+					size_type n_observers_s( 0u ); // For bin work metric
 
 					// Trigger(s) setup: Single, simultaneous, or binned
 					Variable * trigger1( nullptr );
-					if ( bin_size > 1u ) {
-						eventq->bin_QSS_R< Variable >( bin_size, bin_frac, triggers );
+					if ( bin_size[ 2 ] > 1u ) {
+						eventq->bin_QSS_R< Variable >( bin_size[ 2 ], bin_frac, triggers, options::bin_local );
 						if ( options::output::d ) {
 							std::cout << "\nBin @ " << t << " trigger(s):" << '\n';
 							for ( Variable const * trigger : sorted_by_name( triggers ) ) std::cout << "   " << trigger->name() << "  tQ-tE: " << trigger->tQ << '-' << trigger->tE << '\n';
@@ -3644,7 +3841,7 @@ namespace QSS {
 						assert( trigger->tE == t );
 						assert( trigger->is_R() ); // R trigger
 						trigger->st = s; // Set trigger superdense time
-						++c_QSS_events[ trigger ];
+						trigger->count_QSS_event();
 
 						if ( doROut ) { // Requantization output: pre
 							trigger->out( t );
@@ -3652,6 +3849,10 @@ namespace QSS {
 						}
 
 						trigger->advance_QSS();
+						if ( doAgg ) { // Aggregates
+							trigger->aggregate( t );
+							trigger->observers_aggregate( t );
+						}
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3669,25 +3870,33 @@ namespace QSS {
 					} else { // Simultaneous/binned triggers
 						if ( options::output::s || options::steps ) { // Statistics or steps file
 							for ( Variable * trigger : triggers ) {
-								++c_QSS_events[ trigger ];
+								trigger->count_QSS_event();
 							}
 						}
 						++n_QSS_simultaneous_events;
-						observers_s.assign( triggers );
+						Plan_R & plan( plans_r( triggers ) ); // Triggers and observers set up
 
 						if ( doROut ) { // Requantization output: pre
 							for ( Variable * trigger : triggers ) { // Triggers
 								trigger->out( t );
 							}
 							if ( options::output::O ) { // Observers
-								for ( Variable * observer : observers_s ) {
+								for ( Variable * observer : plan.observers ) {
 									observer->observer_out_pre( t );
 								}
 							}
 						}
 
-						triggers_r_s.advance( triggers, t, s ); // Advance triggers
-						if ( observers_s.have() ) observers_s.advance( t ); // Advance observers
+						plan.triggers.advance_assigned( triggers, t, s ); // Advance triggers
+						if ( plan.observers.have() ) plan.observers.advance( t ); // Advance observers
+						if ( doAgg ) { // Aggregates
+							for ( Variable * trigger : triggers ) {
+								trigger->aggregate( t );
+							}
+							for ( Variable * observer : plan.observers ) {
+								observer->aggregate( t );
+							}
+						}
 
 						if ( doROut ) { // Requantization output: post
 							if ( options::output::A ) { // All variables
@@ -3699,7 +3908,7 @@ namespace QSS {
 									trigger->out( t );
 								}
 								if ( options::output::O ) { // Observers
-									for ( Variable * observer : observers_s ) {
+									for ( Variable * observer : plan.observers ) {
 										observer->observer_out_post( t );
 									}
 								}
@@ -3710,8 +3919,12 @@ namespace QSS {
 								trigger->out_t( t );
 							}
 						}
-						max_bin_size = std::max( max_bin_size, triggers.size() );
+						max_bin_size[ 2 ] = std::max( max_bin_size[ 2 ], triggers.size() );
+						n_observers_s = plan.observers.size();
+						++bin_observees[ 2 ].first;
+						bin_observees[ 2 ].second += plan.triggers.n_observees();
 					}
+					if ( bin_work ) bin_work_meter[ 2 ] += ( n_fmu_calls - n_fmu_calls_beg ) + triggers.size() + ( trigger1 != nullptr ? trigger1->observers().size() : n_observers_s );
 
 				} else if ( event.is_QSS_Inp() ) { // QSS Input requantization event(s)
 					++n_QSS_events;
@@ -3719,7 +3932,7 @@ namespace QSS {
 					assert( trigger->tE == t );
 					assert( trigger->is_Input() );
 					trigger->st = s; // Set trigger superdense time
-					++c_QSS_events[ trigger ];
+					trigger->count_QSS_event();
 
 					if ( doROut ) { // Requantization output: pre
 						trigger->out( t );
@@ -3727,6 +3940,10 @@ namespace QSS {
 					}
 
 					trigger->advance_QSS();
+					if ( doAgg ) { // Aggregates
+						trigger->aggregate( t );
+						trigger->observers_aggregate( t );
+					}
 
 					if ( doROut ) { // Requantization output: post
 						if ( options::output::A ) { // All variables
@@ -3747,39 +3964,57 @@ namespace QSS {
 
 				// Local variable event outputs
 				if ( options::output::L && ( n_l_outs > 0u ) && ( options::specified::tLoc ) && ( options::tLoc.first <= t ) && ( t <= options::tLoc.second ) ) {
-					for ( auto const var : vars_NC ) {
-						var->fmu_set_x( t );
-					}
-					size_type i( 0u );
-					for ( auto const & e : fmu_outs ) {
-						FMU_Variable const & var( *(e.second) );
-						if ( var.causality_local() ) l_outs[ i ].append( t, get_as_real( var ) );
-						++i;
+					fmu_set_x_NC( t );
+					get_l_outs();
+					for ( size_type i = 0u; i < n_l_outs; ++i ) {
+						if ( l_outs_local[ i ] ) l_outs[ i ].append( t, l_outs_vals[ i ] );
 					}
 				}
 
 				tProc = t;
 
 				// Bin optimization
-				if ( bin_auto ) { // Bin optimization active
+				if ( bin_work ) { // Bin optimization by work metrics active
+					Time const bin_tb( bin_work_meter[ 0 ].tb() );
+					if ( ( ( bin_work_meter[ 0 ].work() + bin_work_meter[ 1 ].work() + bin_work_meter[ 2 ].work() >= bin_work_check ) && ( t > bin_tb ) ) || ( t >= bin_tb + bin_performance_dt_max ) ) { // Compute bin size metrics
+						for ( size_type k = 0u; k < 3u; ++k ) {
+							BinWork & meter( bin_work_meter[ k ] );
+							if ( meter.work() > 0u ) { // Bin kind active since last pass
+								size_type const bin_size_old( bin_size[ k ] );
+								bin_optimizers[ k ].add( max_bin_size[ k ], meter( t ) );
+								bin_size[ k ] = bin_optimizers[ k ].rec_bin_size();
+								bin_size_auto[ k ].first += bin_size[ k ];
+								++bin_size_auto[ k ].second;
+								if ( options::output::d ) {
+									if ( bin_size[ k ] != bin_size_old ) {
+										std::cout << '\n' << bin_kinds[ k ] << " bin size adjusted to: " << bin_size[ k ] << std::endl;
+									}
+								}
+							}
+							meter.start( t );
+							max_bin_size[ k ] = 1u;
+						}
+					}
+				} else if ( bin_auto ) { // Bin optimization by CPU time active
 					if ( t >= bin_performance.tb() + bin_performance_dt ) { // Enough simulation time to check elapsed CPU time
 						Time const cpu_time_elapsed( bin_performance.elapsed() );
 						if ( ( cpu_time_elapsed >= 1.0 ) || ( t >= bin_performance.tb() + bin_performance_dt_max ) ) { // Compute bin size metrics
 							timers::Performance::Velocity const bin_velocity( bin_performance( t, cpu_time_elapsed ) );
 							bin_performance_dt = std::max( bin_performance_dt, t - bin_performance.tb() ); // Tune simulation time until next check
-							// std::cerr << "\nBining Performance: " << t << ' ' << cpu_time_elapsed << ' ' << bin_size << ' ' << max_bin_size << ' ' << bin_velocity << ' ' << bin_performance_dt << std::endl; //Diagnostic
-							size_type const bin_size_old( bin_size );
-							bin_optimizer.add( max_bin_size, bin_velocity );
-							bin_size = bin_optimizer.rec_bin_size();
-							bin_size_auto.first += bin_size;
-							++bin_size_auto.second;
+							size_type const max_bin_size_all( max( max_bin_size[ 0 ], max_bin_size[ 1 ], max_bin_size[ 2 ] ) );
+							// std::cerr << "\nBining Performance: " << t << ' ' << cpu_time_elapsed << ' ' << bin_size[ 0 ] << ' ' << max_bin_size_all << ' ' << bin_velocity << ' ' << bin_performance_dt << std::endl; //Diagnostic
+							size_type const bin_size_old( bin_size[ 0 ] );
+							bin_optimizers[ 0 ].add( max_bin_size_all, bin_velocity );
+							bin_size[ 0 ] = bin_size[ 1 ] = bin_size[ 2 ] = bin_optimizers[ 0 ].rec_bin_size();
+							bin_size_auto[ 0 ].first += bin_size[ 0 ];
+							++bin_size_auto[ 0 ].second;
 							if ( options::output::d ) {
-								if ( bin_size != bin_size_old ) {
-									std::cout << "\nBin size adjusted to: " << bin_size << std::endl;
+								if ( bin_size[ 0 ] != bin_size_old ) {
+									std::cout << "\nBin size adjusted to: " << bin_size[ 0 ] << std::endl;
 								}
 							}
 							bin_performance.start( t );
-							max_bin_size = 1u;
+							max_bin_size[ 0 ] = max_bin_size[ 1 ] = max_bin_size[ 2 ] = 1u;
 						}
 					}
 				}
@@ -3815,6 +4050,13 @@ namespace QSS {
 				break;
 			}
 		}
+		if ( alloc_check && AllocCheck::armed() ) { // Steady-state allocation check
+			AllocCheck::disarm();
+			if ( AllocCheck::count() > 0u ) {
+				std::cerr << "\nError: " << AllocCheck::count() << " heap allocation(s) in the simulation loop after " << options::alloc_check << " warm-up event passes" << std::endl;
+				std::exit( EXIT_FAILURE );
+			}
+		}
 		eventInfoMaster->nextEventTimeDefined = fmi2_true;
 		eventInfoMaster->nextEventTime = t; // For master loop event queue
 
@@ -3830,32 +4072,81 @@ namespace QSS {
 			if ( n_discrete_events > 0 ) std::cout << n_discrete_events << " discrete event passes" << std::endl;
 			if ( n_QSS_events > 0 ) std::cout << n_QSS_events << " requantization event passes" << std::endl;
 			if ( n_QSS_simultaneous_events > 0 ) std::cout << n_QSS_simultaneous_events << " simultaneous/binned requantization event passes" << std::endl;
+			if ( bin_work ) std::cout << n_fmu_calls << " FMU calls" << std::endl;
 			if ( n_ZC_events > 0 ) std::cout << n_ZC_events << " zero-crossing event passes" << std::endl;
 			std::cout << "Simulation CPU time:  " << sim_cpu_time << " (s)" << std::endl; // CPU time
 #ifdef _OPENMP
 			std::cout << "Simulation wall time: " << sim_wall_time << " (s)" << std::endl; // Wall time
 #endif
-			if ( bin_auto && ( bin_size_auto.second > 0u ) ) {
-				std::cout << "\nAverage optimized bin size: " << static_cast< size_type >( std::round( double( bin_size_auto.first ) / bin_size_auto.second ) ) << std::endl;
+			if ( bin_work ) {
+				for ( size_type k = 0u; k < 3u; ++k ) {
+					if ( bin_size_auto[ k ].second > 0u ) {
+						std::cout << "\nAverage optimized " << bin_kinds[ k ] << " bin size: " << static_cast< size_type >( std::round( double( bin_size_auto[ k ].first ) / bin_size_auto[ k ].second ) ) << std::endl;
+					}
+				}
+			} else if ( bin_auto && ( bin_size_auto[ 0 ].second > 0u ) ) {
+				std::cout << "\nAverage optimized bin size: " << static_cast< size_type >( std::round( double( bin_size_auto[ 0 ].first ) / bin_size_auto[ 0 ].second ) ) << std::endl;
 			}
 			if ( options::output::s ) { // Statistics
+				OutputPool const & output_pool( OutputPool::instance() );
+				if ( output_pool.n_chunks() > 0u ) {
+					std::cout << "\nOutput buffer pool: " << output_pool.allocated() / 1024u << " KB allocated, " << output_pool.n_spills() << " budget spills" << std::endl;
+				}
+				{ // QSS variable memory
+					size_type n_arena( 0u );
+					for ( Variable const * var : vars ) {
+						if ( var_arena.owns( var ) ) ++n_arena;
+					}
+					size_type const n_heap( vars.size() - n_arena );
+					std::cout << "\nQSS Variable Memory: " << vars.size() << " variables" << std::endl;
+					std::cout << " sizeof( Variable ): " << sizeof( Variable ) << "  Largest variable type: " << Variable_max_sizeof << "  Cold data: " << Variable::cold_sizeof() << " (bytes)" << std::endl;
+					std::cout << " Arena: " << n_arena << " variables in " << var_arena.bytes() / 1024u << " KB" << std::endl;
+					if ( n_heap > 0u ) std::cout << " Heap: " << n_heap << " variables in <= " << ( n_heap * Variable_max_sizeof ) / 1024u << " KB" << std::endl;
+					std::cout << " Cold data: " << ( vars.size() * Variable::cold_sizeof() ) / 1024u << " KB" << std::endl;
+					std::cout << " Observers pools: " << ( observers_variables_pool.bytes() + observers_refs_pool.bytes() + observers_reals_pool.bytes() ) / 1024u << " KB" << std::endl;
+					std::cout << " Interned names: " << NameTable::instance().size() << " in " << NameTable::instance().chars() / 1024u << " KB" << std::endl;
+				}
+				if ( bin_observees[ 0 ].first + bin_observees[ 1 ].first + bin_observees[ 2 ].first > 0u ) { // Binned/simultaneous observee union sizes
+					std::cout << "\nBinned/simultaneous triggers average observee union size:" << std::endl;
+					if ( bin_observees[ 0 ].first > 0u ) std::cout << " QSS: " << double( bin_observees[ 0 ].second ) / bin_observees[ 0 ].first << " over " << bin_observees[ 0 ].first << " bins" << std::endl;
+					if ( bin_observees[ 1 ].first > 0u ) std::cout << " QSS_ZC: " << double( bin_observees[ 1 ].second ) / bin_observees[ 1 ].first << " over " << bin_observees[ 1 ].first << " bins" << std::endl;
+					if ( bin_observees[ 2 ].first > 0u ) std::cout << " QSS_R: " << double( bin_observees[ 2 ].second ) / bin_observees[ 2 ].first << " over " << bin_observees[ 2 ].first << " bins" << std::endl;
+				}
+				{ // Zero-crossing root solves
+					size_type n_root_solves( 0u ), n_root_culls( 0u ), n_root_refines( 0u ), n_root_refine_calls( 0u );
+					for ( Variable const * var : vars_ZC ) {
+						Variable_ZC const * var_ZC( static_cast< Variable_ZC const * >( var ) );
+						n_root_solves += var_ZC->n_root_solves();
+						n_root_culls += var_ZC->n_root_culls();
+						n_root_refines += var_ZC->n_root_refines();
+						n_root_refine_calls += var_ZC->n_root_refine_calls();
+					}
+					if ( n_root_solves > 0u ) std::cout << "\nZero-crossing root solves: " << n_root_solves << ", " << n_root_culls << " (" << 100u * n_root_culls / n_root_solves << "%) culled by interval bound" << std::endl;
+					if ( n_root_refines > 0u ) std::cout << "Zero-crossing root refinements: " << n_root_refines << ", " << double( n_root_refine_calls ) / n_root_refines << " FMU evaluations per root on average" << std::endl;
+				}
+				if ( bump_sizes.first > 0u ) { // Localized zero-crossing bumps
+					std::cout << "\nZero-crossing handler bump average size: " << double( bump_sizes.second ) / bump_sizes.first << " of " << vars_ZC.size() << " zero-crossing variables over " << bump_sizes.first << " handler event passes" << std::endl;
+				}
+				if ( plans_qss.on() && ( plans_qss.n_hits() + plans_qss.n_misses() + plans_zc.n_hits() + plans_zc.n_misses() + plans_r.n_hits() + plans_r.n_misses() > 0u ) ) { // Trigger plan cache
+					std::cout << "\nTrigger plan cache: " << plans_qss.n_hits() + plans_zc.n_hits() + plans_r.n_hits() << " hits, " << plans_qss.n_misses() + plans_zc.n_misses() + plans_r.n_misses() << " misses, " << plans_qss.size() + plans_zc.size() + plans_r.size() << " plans" << std::endl;
+				}
 				if ( n_QSS_events > 0 ) {
 					std::cout << "\nQSS Requantization Events: By Name" << std::endl;
 					for ( Variable const * var : vars ) {
-						if ( c_QSS_events[ var ] > 0u ) std::cout << ' ' << var->name() << ' ' << c_QSS_events[ var ] << " (" <<  100u * c_QSS_events[ var ] / n_QSS_events << "%)" << std::endl;
+						if ( var->n_QSS_events() > 0u ) std::cout << ' ' << var->name() << ' ' << var->n_QSS_events() << " (" <<  100u * var->n_QSS_events() / n_QSS_events << "%)" << std::endl;
 					}
 					std::cout << "\nQSS Requantization Events: By Count" << std::endl;
 					Variables vars_by_requants( vars );
-					std::stable_sort( vars_by_requants.begin(), vars_by_requants.end(), [this]( Variable const * v1, Variable const * v2 ){ return c_QSS_events[ v1 ] > c_QSS_events[ v2 ]; } );
+					std::stable_sort( vars_by_requants.begin(), vars_by_requants.end(), []( Variable const * v1, Variable const * v2 ){ return v1->n_QSS_events() > v2->n_QSS_events(); } );
 					for ( Variable const * var : vars_by_requants ) {
-						if ( c_QSS_events[ var ] > 0u ) std::cout << ' ' << var->name() << ' ' << c_QSS_events[ var ] << " (" <<  100u * c_QSS_events[ var ] / n_QSS_events << "%)" << std::endl;
+						if ( var->n_QSS_events() > 0u ) std::cout << ' ' << var->name() << ' ' << var->n_QSS_events() << " (" <<  100u * var->n_QSS_events() / n_QSS_events << "%)" << std::endl;
 					}
 				}
 				if ( n_ZC_events > 0 ) {
 					std::cout << "\nQSS Zero-Crossing Events:" << std::endl;
 					bool any_detected_crossings( false );
 					for ( Variable const * var : vars_ZC ) {
-						if ( c_ZC_events[ var ] > 0u ) std::cout << ' ' << var->name() << ' ' << c_ZC_events[ var ] << " (" <<  100u * c_ZC_events[ var ] / n_ZC_events << "%)" << std::endl;
+						if ( var->n_ZC_events() > 0u ) std::cout << ' ' << var->name() << ' ' << var->n_ZC_events() << " (" <<  100u * var->n_ZC_events() / n_ZC_events << "%)" << std::endl;
 						if ( var->detected_crossing() ) any_detected_crossings = true;
 					}
 					if ( any_detected_crossings ) {
@@ -3864,6 +4155,17 @@ namespace QSS {
 							if ( var->detected_crossing() ) std::cout << ' ' << var->name() << std::endl;
 						}
 					}
+					bool any_chatter( false );
+					for ( Variable const * var : vars_ZC ) {
+						if ( static_cast< Variable_ZC const * >( var )->n_chatter() > 0u ) any_chatter = true;
+					}
+					if ( any_chatter ) {
+						std::cout << "\nQSS Zero-Crossing Variables with Chattering Hysteresis Applied:" << std::endl;
+						for ( Variable const * var : vars_ZC ) {
+							Variable_ZC const * var_ZC( static_cast< Variable_ZC const * >( var ) );
+							if ( var_ZC->n_chatter() > 0u ) std::cout << ' ' << var_ZC->name() << ' ' << var_ZC->n_chatter() << " interventions: zHys=" << var_ZC->zHys() << std::endl;
+						}
+					}
 				}
 			}
 			if ( options::steps ) { // Steps file
@@ -3872,7 +4174,7 @@ namespace QSS {
 					OutputFilter const steps_filter;
 					step_stream << n_QSS_events << '\n';
 					for ( Variable const * var : vars ) {
-						if ( steps_filter( var->name() ) ) step_stream << var->name() << ' ' << c_QSS_events[ var ] << '\n';
+						if ( steps_filter( var->name() ) ) step_stream << var->name() << ' ' << var->n_QSS_events() << '\n';
 					}
 				}
 				step_stream.close();
@@ -3908,9 +4210,9 @@ namespace QSS {
 					if ( doROut || doZOut || doDOut || doSOut ) var->out( tE );
 					if ( doTOut ) var->out_t( tE );
 				}
-				var->flush_out();
 			}
 		}
+		for ( auto var : vars ) var->flush_out(); // Flush and create any output files not yet written
 		if ( options::output::F ) { // FMU QSS variable tE outputs
 			if ( n_f_outs > 0u ) { // FMU QSS variables
 				for ( size_type i = 0u; i < n_f_outs; ++i ) {
@@ -3927,42 +4229,105 @@ namespace QSS {
 //					if ( state_vars[ i ] != nullptr ) states[ i ] = state_vars[ i ]->x( tE );
 //				}
 //				fmi2_import_set_continuous_states( fmu, states, n_states );
-				for ( auto const var : vars_NC ) {
-					var->fmu_set_x( tE );
-				}
-				size_type i( 0u );
-				for ( auto const & e : fmu_outs ) {
-					FMU_Variable const & var( *(e.second) );
-					l_outs[ i ].append( tE, get_as_real( var ) );
+				fmu_set_x_NC( tE );
+				get_l_outs();
+				for ( size_type i = 0u; i < n_l_outs; ++i ) {
+					l_outs[ i ].append( tE, l_outs_vals[ i ] );
 					l_outs[ i ].flush();
-					++i;
 				}
 			}
 		}
+		aggregates_out(); // Aggregates at tE
 		if ( options::csv ) {
-			for ( auto const var : vars ) {
-				var->fmu_set_x( tE );
+			csv_out( tE );
+			csv.flush();
+		}
+	}
+
+	// QSS Variable Memory Layout Setup: Arena Slots of FMU Variables
+	//  FMU variables in the dependency graph other than derivatives get arena slots in the layout order so observers are mostly adjacent
+	void
+	FMU_ME::
+	init_layout( FMU_DepGraph const & dep_graph )
+	{
+		var_slots.clear();
+		if ( options::layout == options::Layout::heap ) return;
+		using Index = FMU_DepGraph::Index;
+		FMU_DepGraph::Graph const & g( dep_graph.graph() );
+		Index const n( g.n() ); // FMU variables + 1
+		std::vector< bool > laid( n, false ); // FMU variables given arena slots
+		for ( Index idx = 1u; idx < n; ++idx ) {
+			if ( !dep_graph.has( idx ) ) continue;
+			laid[ idx ] = true;
+			for ( auto i = g.begin( idx ), e = g.end( idx ); i != e; ++i ) laid[ *i ] = true;
+		}
+		for ( Index idx = 1u; idx < n; ++idx ) {
+			if ( laid[ idx ] && fmu_variables[ idx - 1 ].is_Derivative() ) laid[ idx ] = false; // Derivatives are not QSS variables
+		}
+		DepIdxs order; // FMU variable indexes in layout order
+		std::string layout_name;
+		switch ( options::layout ) {
+		case options::Layout::FMU:
+			layout_name = "FMU";
+			order.resize( n );
+			std::iota( order.begin(), order.end(), Index( 0u ) );
+			break;
+		case options::Layout::RCM:
+			{
+			layout_name = "RCM";
+			CSR< Index > const u( undirected( g ) );
+			rcm( u, order );
+			DepIdxs fmu_order( n );
+			std::iota( fmu_order.begin(), fmu_order.end(), Index( 0u ) );
+			std::cout << "\nDependency graph bandwidth: FMU order: " << bandwidth( u, fmu_order ) << "  RCM order: " << bandwidth( u, order ) << std::endl;
 			}
-			for ( std::size_t i = 0, n = res_var_indexes.size(); i < n; ++i ) {
-				res_var_vals[ i ] = get_as_real( fmu_variables[ res_var_indexes[ i ] ] );
+			break;
+		case options::Layout::SCC:
+			{
+			layout_name = "SCC";
+			DepIdxs comp;
+			scc( g, comp );
+			order.resize( n );
+			std::iota( order.begin(), order.end(), Index( 0u ) );
+			std::stable_sort( order.begin(), order.end(), [ &comp ]( Index const a, Index const b ){ return comp[ a ] < comp[ b ]; } ); // Observees before observers with cycles contiguous
 			}
-			csv.values( res_var_vals );
+			break;
+		default:
+			assert( false );
+			break;
 		}
+		var_slots.assign( n, no_slot );
+		Index n_slots( 0u );
+		for ( Index const idx : order ) {
+			if ( laid[ idx ] ) var_slots[ idx ] = n_slots++;
+		}
+		var_arena.assign( n_slots, Variable_max_sizeof_of( options::qss, options::order, options::fQSS ) ); // Slots fit the types of this run's method
+		std::cout << "\nQSS variable arena: " << n_slots << " slots of " << var_arena.stride() << " bytes in " << layout_name << " order" << std::endl;
 	}
 
-	// Find Event Indicator and Non-Event Indicator Observees in Observee Subgraph
+	// Find Non-Event Indicator Observees in Event Indicator Observee Subgraph of an Event Indicator
+	//  Marks hold the observing event indicator index so they need no clearing between event indicators
 	void
 	FMU_ME::
-	subgraph_ei_observees( FMU_Dependencies const & fmu_dependencies, dep::Variable::Observees const & observees, DepIdxSet & nei_observees, DepIdxSet & ei_observees ) const
+	subgraph_ei_observees( FMU_DepGraph const & dep_graph, FMU_DepGraph::Index const ei, DepIdxMarks & ei_marks, DepIdxMarks & nei_marks, DepIdxs & nei_observees ) const
 	{
-		for ( dep::Variable::Index const observee : observees ) {
-			FMU_Variable const & observee_fmu_var( fmu_variables[ observee - 1 ] ); // FMU variable corresponding to the observee index
-			if ( observee_fmu_var.is_EventIndicator() ) { // Observee is an event indicator
-				if ( ei_observees.insert( observee ).second ) { // Observee was added to event indicator observees
-					subgraph_ei_observees( fmu_dependencies, fmu_dependencies[ observee ].observees, nei_observees, ei_observees ); // Recurse
+		nei_observees.clear();
+		DepIdxs stack( 1u, ei ); // Event indicators to scan
+		while ( !stack.empty() ) {
+			FMU_DepGraph::Index const idx( stack.back() );
+			stack.pop_back();
+			if ( !dep_graph.has( idx ) ) continue;
+			for ( auto i = dep_graph.begin( idx ), e = dep_graph.end( idx ); i != e; ++i ) {
+				FMU_DepGraph::Index const observee( *i );
+				if ( fmu_variables[ observee - 1 ].is_EventIndicator() ) { // Observee is an event indicator
+					if ( ei_marks[ observee ] != ei ) { // Observee was added to event indicator observees
+						ei_marks[ observee ] = ei;
+						stack.push_back( observee );
+					}
+				} else if ( nei_marks[ observee ] != ei ) { // Observee is not an event indicator
+					nei_marks[ observee ] = ei;
+					nei_observees.push_back( observee );
 				}
-			} else { // Observee is not an event indicator
-				nei_observees.insert( observee );
 			}
 		}
 	}
@@ -3970,24 +4335,28 @@ namespace QSS {
 	// Mark FMU Variables That Must be Active: Handlers with Upstream State or Event Indicator Observers
 	void
 	FMU_ME::
-	mark_active_downstream_observees( FMU_Dependencies const & fmu_dependencies, dep::Variable const & dep_var )
+	mark_active_downstream_observees( FMU_DepGraph const & dep_graph, FMU_DepGraph::Index const idx )
 	{
-		for ( dep::Variable::Index const observee : dep_var.observees ) {
-			FMU_Variable & observee_fmu_var( fmu_variables[ observee - 1 ] ); // FMU variable corresponding to the observee index
-			if ( observee_fmu_var.must_be_active_scanned ) { // Already subgraph scanned
-				// Stop scan
-			} else if ( observee_fmu_var.must_be_active ) { // Already active and subgraph scanned
-				// Stop scan
-			} else if ( observee_fmu_var.is_State() || observee_fmu_var.is_Derivative() || observee_fmu_var.is_EventIndicator() ) { // State/Derivative or Event indicator sub-graph will be root of another marking pass
-				observee_fmu_var.must_be_active_scanned = true;
-				// Stop scan
-			} else { // Mark active if handler
-				observee_fmu_var.must_be_active_scanned = true;
-				if ( observee_fmu_var.is_handler ) { // Must be active
-					observee_fmu_var.must_be_active = true; // Mark it
-				}
-				if ( fmu_dependencies.has( observee ) ) { // Scan from observee
-					mark_active_downstream_observees( fmu_dependencies, fmu_dependencies[ observee ] ); // Recurse
+		DepIdxs stack( 1u, idx ); // Variables to scan from
+		while ( !stack.empty() ) {
+			FMU_DepGraph::Index const idv( stack.back() );
+			stack.pop_back();
+			for ( auto i = dep_graph.begin( idv ), e = dep_graph.end( idv ); i != e; ++i ) {
+				FMU_DepGraph::Index const observee( *i );
+				FMU_Variable & observee_fmu_var( fmu_variables[ observee - 1 ] ); // FMU variable corresponding to the observee index
+				if ( observee_fmu_var.must_be_active_scanned ) { // Already subgraph scanned
+					// Stop scan
+				} else if ( observee_fmu_var.must_be_active ) { // Already active and subgraph scanned
+					// Stop scan
+				} else if ( observee_fmu_var.is_State() || observee_fmu_var.is_Derivative() || observee_fmu_var.is_EventIndicator() ) { // State/Derivative or Event indicator sub-graph will be root of another marking pass
+					observee_fmu_var.must_be_active_scanned = true;
+					// Stop scan
+				} else { // Mark active if handler
+					observee_fmu_var.must_be_active_scanned = true;
+					if ( observee_fmu_var.is_handler ) { // Must be active
+						observee_fmu_var.must_be_active = true; // Mark it
+					}
+					if ( dep_graph.has( observee ) ) stack.push_back( observee ); // Scan from observee
 				}
 			}
 		}
@@ -4005,6 +4374,220 @@ namespace QSS {
 		set_reals( n_observees, vars_HO_ref.data(), vars_HO_val.data() ); // Set observees FMU values
 	}
 
+	// Prepare Handlers' Observees for Handler Processing at Predicted Zero-Crossing
+	void
+	FMU_ME::
+	prep_handlers_observees( Variables const & handlers, Time const t )
+	{
+		vars_HB.clear();
+		for ( Variable * handler : handlers ) {
+			for ( Variable * observee : handler->observees() ) {
+				vars_HB.push_back( observee );
+			}
+		}
+		uniquify( vars_HB ); // Remove duplicates from handlers' observees collection
+		size_type n_observees( vars_HB.size() );
+		vars_HB_ref.resize( n_observees ); // Grow-only capacity after warm-up
+		vars_HB_val.resize( n_observees );
+		for ( size_type j = 0u; j < n_observees; ++j ) { // Set observee value reference and value vectors
+			vars_HB_ref[ j ] = vars_HB[ j ]->ref();
+			vars_HB_val[ j ] = vars_HB[ j ]->x( t );
+		}
+		set_reals( n_observees, vars_HB_ref.data(), vars_HB_val.data() ); // Set observees FMU values
+	}
+
+	// Set Up Zero-Crossing Variable Bump Peers
+	void
+	FMU_ME::
+	init_bump_peers()
+	{
+		using Variable_ZCs = Variable_ZC::Variable_ZCs;
+		Variable_ZCs var_ZCs;
+		var_ZCs.reserve( vars_ZC.size() );
+		for ( Variable * var : vars_ZC ) {
+			assert( dynamic_cast< Variable_ZC * >( var ) != nullptr );
+			var_ZCs.push_back( static_cast< Variable_ZC * >( var ) );
+		}
+		Variables const no_handlers;
+		set_bump_peers( var_ZCs, [&]( Variable_ZC const * var_ZC ) -> Variables const & { return var_ZC->conditional != nullptr ? var_ZC->conditional->observers() : no_handlers; } );
+	}
+
+	// Sampled Output Batching Setup
+	void
+	FMU_ME::
+	init_sampled()
+	{
+		// Non-zero-crossing non-connection variables: Real FMU values are set in one batch
+		smp_NC_R.clear();
+		smp_NC_O.clear();
+		smp_NC_R_refs.clear();
+		for ( Variable * var : vars_NC ) {
+			if ( var->is_Integer() || var->is_Boolean() ) { // Variables with typed FMU sets
+				smp_NC_O.push_back( var );
+			} else {
+				smp_NC_R.push_back( var );
+				smp_NC_R_refs.push_back( var->var().ref() );
+			}
+		}
+		smp_NC_R_vals.resize( smp_NC_R.size() );
+
+		// FMU local variable outputs: Values are gotten in one batch per type
+		smp_l_R_idx.clear();
+		smp_l_I_idx.clear();
+		smp_l_B_idx.clear();
+		smp_l_R_refs.clear();
+		smp_l_I_refs.clear();
+		smp_l_B_refs.clear();
+		l_outs_local.clear();
+		size_type i( 0u );
+		for ( auto const & e : fmu_outs ) { // Same order as l_outs
+			FMU_Variable const & var( *(e.second) );
+			if ( var.is_Real() ) {
+				smp_l_R_idx.push_back( i );
+				smp_l_R_refs.push_back( var.ref() );
+			} else if ( var.is_Integer() ) {
+				smp_l_I_idx.push_back( i );
+				smp_l_I_refs.push_back( var.ref() );
+			} else if ( var.is_Boolean() ) {
+				smp_l_B_idx.push_back( i );
+				smp_l_B_refs.push_back( var.ref() );
+			}
+			l_outs_local.push_back( var.causality_local() );
+			++i;
+		}
+		smp_l_R_vals.resize( smp_l_R_refs.size() );
+		smp_l_I_vals.resize( smp_l_I_refs.size() );
+		smp_l_B_vals.resize( smp_l_B_refs.size() );
+		l_outs_vals.assign( fmu_outs.size(), 0.0 );
+	}
+
+	// Aggregates Setup
+	void
+	FMU_ME::
+	init_aggregates()
+	{
+		aggs.clear();
+		agg_vars.clear();
+		doAgg = false;
+		if ( options::agg.empty() ) return;
+		Globs agg_globs; // Compiled agg specs in spec order
+		for ( options::AggSpec const & agg_spec : options::agg ) {
+			try {
+				agg_globs.add( agg_spec.var );
+			} catch (...) {
+				std::cerr << "\nError: Skipping aggregate spec that yields invalid regex: " << agg_spec.var << std::endl;
+				agg_globs.add( std::string() ); // Placeholder that matches no variable
+			}
+		}
+		std::vector< options::AggSpecs::size_type > agg_specs;
+		for ( Variable * var : vars_NZ ) { // Non-zero-crossing variables
+			Globs::size_type const i( agg_globs.first( var->name() ) ); // First matching spec is used
+			if ( i != Globs::npos ) {
+				agg_vars.push_back( var );
+				agg_specs.push_back( i );
+			}
+		}
+		aggs.reserve( agg_vars.size() ); // Aggregate addresses must not change
+		for ( size_type i = 0, n = agg_vars.size(); i < n; ++i ) {
+			aggs.emplace_back( options::agg[ agg_specs[ i ] ].thresholds );
+			agg_vars[ i ]->aggregate( &aggs.back() );
+			agg_vars[ i ]->aggregate( t ); // Start first segment
+		}
+		doAgg = !agg_vars.empty();
+		if ( !doAgg ) std::cerr << "\nWarning: No variables match the aggregate specs" << std::endl;
+	}
+
+	// Aggregates Output
+	void
+	FMU_ME::
+	aggregates_out()
+	{
+		if ( !doAgg ) return;
+		std::string const output_dir( options::have_multiple_models() ? name : std::string() );
+		if ( ( !output_dir.empty() ) && ( !path::make_dir( output_dir ) ) ) {
+			std::cerr << "\nError: Output directory creation failed: " << output_dir << std::endl;
+			return;
+		}
+		std::string const agg_file( ( output_dir.empty() ? std::string() : output_dir + path::sep ) + name + ".agg" );
+		std::ofstream agg_stream( agg_file, std::ios_base::binary | std::ios_base::out );
+		if ( !agg_stream.is_open() ) {
+			std::cerr << "\nError: Aggregates file open failed: " << agg_file << std::endl;
+			return;
+		}
+		agg_stream << std::setprecision( 15 ) << "Variable Integral Min Max Threshold TimeAbove\n";
+		for ( size_type i = 0, n = agg_vars.size(); i < n; ++i ) {
+			Variable const * var( agg_vars[ i ] );
+			Aggregate & agg( aggs[ i ] );
+			if ( agg.tA() < tE ) agg.accumulate( tE );
+			if ( agg.thresholds().empty() ) {
+				agg_stream << var->name() << ' ' << agg.integral() << ' ' << agg.min() << ' ' << agg.max() << '\n';
+			} else {
+				for ( Aggregate::size_type k = 0, m = agg.thresholds().size(); k < m; ++k ) {
+					agg_stream << var->name() << ' ' << agg.integral() << ' ' << agg.min() << ' ' << agg.max() << ' ' << agg.thresholds()[ k ] << ' ' << agg.t_above( k ) << '\n';
+				}
+			}
+		}
+		agg_stream.close();
+	}
+
+	// Set All Non-Zero-Crossing Non-Connection FMU Variables to Continuous Value at Time t
+	void
+	FMU_ME::
+	fmu_set_x_NC( Time const t )
+	{
+		std::int64_t const n_R( smp_NC_R.size() );
+		#pragma omp parallel for schedule(static) if ( n_R >= 16384 )
+		for ( std::int64_t i = 0; i < n_R; ++i ) { // Trajectory evaluations are independent
+			smp_NC_R_vals[ i ] = smp_NC_R[ i ]->x( t );
+		}
+		if ( n_R > 0 ) set_reals( smp_NC_R.size(), smp_NC_R_refs.data(), smp_NC_R_vals.data() );
+		for ( Variable const * var : smp_NC_O ) {
+			var->fmu_set_x( t );
+		}
+	}
+
+	// Get FMU Local Variable Output Values at Time t: FMU Variables Must be Set First
+	void
+	FMU_ME::
+	get_l_outs()
+	{
+		if ( !smp_l_R_refs.empty() ) {
+			get_reals( smp_l_R_refs.size(), smp_l_R_refs.data(), smp_l_R_vals.data() );
+			for ( size_type i = 0, n = smp_l_R_idx.size(); i < n; ++i ) l_outs_vals[ smp_l_R_idx[ i ] ] = smp_l_R_vals[ i ];
+		}
+		if ( !smp_l_I_refs.empty() ) {
+			get_integers( smp_l_I_refs.size(), smp_l_I_refs.data(), smp_l_I_vals.data() );
+			for ( size_type i = 0, n = smp_l_I_idx.size(); i < n; ++i ) l_outs_vals[ smp_l_I_idx[ i ] ] = Real( smp_l_I_vals[ i ] );
+		}
+		if ( !smp_l_B_refs.empty() ) {
+			get_booleans( smp_l_B_refs.size(), smp_l_B_refs.data(), smp_l_B_vals.data() );
+			for ( size_type i = 0, n = smp_l_B_idx.size(); i < n; ++i ) l_outs_vals[ smp_l_B_idx[ i ] ] = Real( smp_l_B_vals[ i ] != 0 );
+		}
+	}
+
+	// CSV Results Output at Time t
+	void
+	FMU_ME::
+	csv_out( Time const t )
+	{
+		fmu_set_x_NC( t );
+		for ( Variable const * var : vars_CI ) var->fmu_set_x( t );
+		for ( Variable const * var : vars_ZC ) var->fmu_set_x( t );
+		if ( !res_R_refs.empty() ) {
+			get_reals( res_R_refs.size(), res_R_refs.data(), res_R_vals.data() );
+			for ( size_type i = 0, n = res_R_idx.size(); i < n; ++i ) res_var_vals[ res_R_idx[ i ] ] = res_R_vals[ i ];
+		}
+		if ( !res_I_refs.empty() ) {
+			get_integers( res_I_refs.size(), res_I_refs.data(), res_I_vals.data() );
+			for ( size_type i = 0, n = res_I_idx.size(); i < n; ++i ) res_var_vals[ res_I_idx[ i ] ] = Real( res_I_vals[ i ] );
+		}
+		if ( !res_B_refs.empty() ) {
+			get_booleans( res_B_refs.size(), res_B_refs.data(), res_B_vals.data() );
+			for ( size_type i = 0, n = res_B_idx.size(); i < n; ++i ) res_var_vals[ res_B_idx[ i ] ] = Real( res_B_vals[ i ] != 0 );
+		}
+		csv.values( res_var_vals );
+	}
+
 	// FMI Status Check/Report
 	bool
 	FMU_ME::
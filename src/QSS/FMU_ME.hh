@@ -37,12 +37,17 @@
 #define QSS_FMU_ME_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/Aggregate.hh>
+#include <QSS/Arena.hh>
 #include <QSS/FMU_Variable.hh>
 #include <QSS/Dependencies.hh>
 #include <QSS/EventQueue.hh>
+#include <QSS/NameTable.hh>
 #include <QSS/Output.hh>
 #include <QSS/OutputFilter.hh>
+#include <QSS/Pooled.hh>
 #include <QSS/Results_CSV.hh>
+#include <QSS/ShmRing.hh>
 #include <QSS/SmoothToken.hh>
 
 // FMI Library Headers
@@ -51,9 +56,11 @@
 // C++ Headers
 #include <cassert>
 #include <cstdlib>
+#include <limits>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace QSS {
@@ -295,18 +302,18 @@ public: // Types
 	using Variables = std::vector< Variable * >;
 	using Variables_QSS = std::vector< Variable_QSS * >;
 	using Var_Indexes = std::vector< Index >;
-	using Var_Name_Var = std::unordered_map< std::string, Variable * >; // Map from variable names to variables
-	using Var_Name_Ref = std::unordered_map< std::string, fmi2_value_reference_t >; // Map from variable names to FMU variable value references
-	using Ref_Var = std::unordered_map< fmi2_value_reference_t, Variable * >;
+	using Var_Name_Var = std::unordered_map< NameTable::Id, Variable * >; // Map from interned variable name ids to variables
 	using VariableRef = fmi2_value_reference_t;
 	using VariableRefs = std::vector< VariableRef >;
 	using Conditionals = std::vector< Conditional< Variable_ZC > * >;
 	using FMU_Variables = std::vector< FMU_Variable >;
-	using FMU_Idxs = std::unordered_map< Index, Variable * >; // Map from FMU variable indexes to QSS Variables
+	using FMU_Idxs = std::vector< Variable * >; // FMU variable indexes to QSS Variables
 	using FMU_EIs = std::vector< Variable_ZC * >; // Map from FMU event indicator indexes to QSS ZC Variables
 	using SmoothTokenOutput = Output< SmoothToken >;
-	using Counts = std::unordered_map< Variable const *, Index >; // Map from Variables to counters
-	using DepIdxSet = std::unordered_set< dep::Variable::Index >;
+	using DepIdxs = std::vector< FMU_DepGraph::Index >; // FMU variable indexes
+	using DepIdxMarks = std::vector< FMU_DepGraph::Index >; // FMU variable index marks
+
+	static constexpr FMU_DepGraph::Index no_slot{ std::numeric_limits< FMU_DepGraph::Index >::max() }; // No arena slot
 
 public: // Creation
 
@@ -353,14 +360,21 @@ public: // Predicate
 
 public: // Property
 
-	// Variable Lookup by Name (for Testing)
+	// Variable Lookup by Name
 	Variable const *
 	var_named( std::string const & var_name ) const;
 
-	// Variable Lookup by Name (for Testing)
+	// Variable Lookup by Name
 	Variable *
 	var_named( std::string const & var_name );
 
+	// QSS Variable of FMU Variable Index
+	Variable *
+	qss_var_of_idx( size_type const idx ) const
+	{
+		return idx < fmu_idxs.size() ? fmu_idxs[ idx ] : nullptr;
+	}
+
 public: // Simulation Methods
 
 	// Initialize
@@ -486,6 +500,7 @@ public: // FMU Methods
 	{
 		assert( fmu != nullptr );
 		Real val;
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_real( fmu, &ref, std::size_t( 1u ), &val );
 		assert( status_check( fmi_status, "get_real" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -497,6 +512,7 @@ public: // FMU Methods
 	set_real( fmi2_value_reference_t const ref, Real const val )
 	{
 		assert( fmu != nullptr );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_set_real( fmu, &ref, std::size_t( 1u ), &val );
 		assert( status_check( fmi_status, "set_real" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -508,6 +524,7 @@ public: // FMU Methods
 	get_reals( std::size_t const n, fmi2_value_reference_t const refs[], Real vals[] ) const
 	{
 		assert( fmu != nullptr );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_real( fmu, refs, n, vals );
 		assert( status_check( fmi_status, "get_reals" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -518,10 +535,12 @@ public: // FMU Methods
 	set_reals( std::size_t const n, fmi2_value_reference_t const refs[], Real const vals[] )
 	{
 		assert( fmu != nullptr );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_set_real( fmu, refs, n, vals );
 		assert( status_check( fmi_status, "set_reals" ) );
 		(void)fmi_status; // Suppress unused warning
-		std::vector< Real > get_vals( n ); get_reals( n, refs, get_vals.data() ); //! Work-around for unexpected OCT directional derivatives
+		if ( set_reals_vals.size() < n ) set_reals_vals.resize( n ); // Grow-only scratch: No steady-state allocation
+		get_reals( n, refs, set_reals_vals.data() ); //! Work-around for unexpected OCT directional derivatives
 	}
 
 	// Get a Derivative: First call get_derivatives
@@ -537,6 +556,7 @@ public: // FMU Methods
 	get_derivatives() const
 	{
 		assert( derivatives != nullptr );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_derivatives( fmu, derivatives, n_derivatives );
 		assert( status_check( fmi_status, "get_derivatives" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -554,6 +574,7 @@ public: // FMU Methods
 		assert( fmu != nullptr );
 		if ( nv == 0u ) return fmi2_real_t( 0.0 ); // No seed => Zero derivative
 		fmi2_real_t dz;
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_directional_derivative( fmu, v_ref, nv, &z_ref, std::size_t( 1u ), dv, &dz );
 		assert( status_check( fmi_status, "get_directional_derivative" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -576,6 +597,7 @@ public: // FMU Methods
 			for ( std::size_t i = 0; i < nz; ++i ) dz[ i ] = fmi2_real_t( 0.0 );
 			return;
 		}
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_directional_derivative( fmu, v_ref, nv, z_ref, nz, dv, dz );
 		assert( status_check( fmi_status, "get_directional_derivatives" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -587,17 +609,30 @@ public: // FMU Methods
 	{
 		assert( fmu != nullptr );
 		Integer val;
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_integer( fmu, &ref, std::size_t( 1u ), &val );
 		assert( status_check( fmi_status, "get_integer" ) );
 		(void)fmi_status; // Suppress unused warning
 		return val;
 	}
 
+	// Get Integer FMU Variable Values
+	void
+	get_integers( std::size_t const n, fmi2_value_reference_t const refs[], Integer vals[] ) const
+	{
+		assert( fmu != nullptr );
+		++n_fmu_calls;
+		fmi2_status_t const fmi_status = fmi2_import_get_integer( fmu, refs, n, vals );
+		assert( status_check( fmi_status, "get_integers" ) );
+		(void)fmi_status; // Suppress unused warning
+	}
+
 	// Set an Integer FMU Variable Value
 	void
 	set_integer( fmi2_value_reference_t const ref, Integer const val )
 	{
 		assert( fmu != nullptr );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_set_integer( fmu, &ref, std::size_t( 1u ), &val );
 		assert( status_check( fmi_status, "set_integer" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -609,18 +644,31 @@ public: // FMU Methods
 	{
 		assert( fmu != nullptr );
 		fmi2_boolean_t fbt;
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_boolean( fmu, &ref, std::size_t( 1u ), &fbt );
 		assert( status_check( fmi_status, "get_boolean" ) );
 		(void)fmi_status; // Suppress unused warning
 		return fbt != 0;
 	}
 
+	// Get Boolean FMU Variable Values
+	void
+	get_booleans( std::size_t const n, fmi2_value_reference_t const refs[], fmi2_boolean_t vals[] ) const
+	{
+		assert( fmu != nullptr );
+		++n_fmu_calls;
+		fmi2_status_t const fmi_status = fmi2_import_get_boolean( fmu, refs, n, vals );
+		assert( status_check( fmi_status, "get_booleans" ) );
+		(void)fmi_status; // Suppress unused warning
+	}
+
 	// Set an Boolean FMU Variable Value
 	void
 	set_boolean( fmi2_value_reference_t const ref, bool const val )
 	{
 		assert( fmu != nullptr );
 		fmi2_boolean_t const fbt( static_cast< fmi2_boolean_t >( val ) );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_set_boolean( fmu, &ref, std::size_t( 1u ), &fbt );
 		assert( status_check( fmi_status, "set_boolean" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -632,6 +680,7 @@ public: // FMU Methods
 	{
 		assert( fmu != nullptr );
 		fmi2_string_t fst;
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_get_string( fmu, &ref, std::size_t( 1u ), &fst );
 		assert( status_check( fmi_status, "get_string" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -644,6 +693,7 @@ public: // FMU Methods
 	{
 		assert( fmu != nullptr );
 		fmi2_string_t const fst( static_cast< fmi2_string_t >( val.c_str() ) );
+		++n_fmu_calls;
 		fmi2_status_t const fmi_status = fmi2_import_set_string( fmu, &ref, std::size_t( 1u ), &fst );
 		assert( status_check( fmi_status, "set_string" ) );
 		(void)fmi_status; // Suppress unused warning
@@ -683,18 +733,63 @@ public: // FMU Methods
 
 private: // Methods
 
-	// Event Indicator Observees in Observee Subgraph
+	// QSS Variable Memory Layout Setup: Arena Slots of FMU Variables
 	void
-	subgraph_ei_observees( FMU_Dependencies const & fmu_dependencies, dep::Variable::Observees const & observees, DepIdxSet & nei_observees, DepIdxSet & ei_observees ) const;
+	init_layout( FMU_DepGraph const & dep_graph );
+
+	// New QSS Variable of FMU Variable idx in its Arena Slot or on the Heap
+	template< typename V, typename... Args >
+	V *
+	new_var( size_type const idx, Args &&... args )
+	{
+		if ( ( idx < var_slots.size() ) && ( var_slots[ idx ] != no_slot ) && ( sizeof( V ) <= var_arena.stride() ) ) return var_arena.make< V >( var_slots[ idx ], this, std::forward< Args >( args )... );
+		return new V( this, std::forward< Args >( args )... );
+	}
+
+	// Non-Event Indicator Observees in Event Indicator Observee Subgraph
+	void
+	subgraph_ei_observees( FMU_DepGraph const & dep_graph, FMU_DepGraph::Index const ei, DepIdxMarks & ei_marks, DepIdxMarks & nei_marks, DepIdxs & nei_observees ) const;
 
 	// Mark FMU Variables That Must be Active: Handlers with Upstream State or Event Indicator Observers
 	void
-	mark_active_downstream_observees( FMU_Dependencies const & fmu_dependencies, dep::Variable const & dep_var );
+	mark_active_downstream_observees( FMU_DepGraph const & dep_graph, FMU_DepGraph::Index const idx );
 
 	// Prepare All Handlers' Observees for Handler Processing at Predicted Zero-Crossing
 	void
 	prep_all_handlers_observees( Time const t );
 
+	// Prepare Handlers' Observees for Handler Processing at Predicted Zero-Crossing
+	void
+	prep_handlers_observees( Variables const & handlers, Time const t );
+
+	// Set Up Zero-Crossing Variable Bump Peers
+	void
+	init_bump_peers();
+
+	// Sampled Output Batching Setup
+	void
+	init_sampled();
+
+	// Set All Non-Zero-Crossing Non-Connection FMU Variables to Continuous Value at Time t
+	void
+	fmu_set_x_NC( Time const t );
+
+	// Get FMU Local Variable Output Values at Time t: FMU Variables Must be Set First
+	void
+	get_l_outs();
+
+	// CSV Results Output at Time t
+	void
+	csv_out( Time const t );
+
+	// Aggregates Setup
+	void
+	init_aggregates();
+
+	// Aggregates Output
+	void
+	aggregates_out();
+
 private: // Static Methods
 
 	// FMI Status OK Check
@@ -792,21 +887,42 @@ public: // Data
 	Variables vars_HO; // All handlers' observees
 	VariableRefs vars_HO_ref; // All handlers' observees value references
 	Reals vars_HO_val; // All handlers' observees values
+	Variables vars_HB; // Bumped handlers' observees
+	VariableRefs vars_HB_ref; // Bumped handlers' observees value references
+	Reals vars_HB_val; // Bumped handlers' observees values
 	Variables_QSS state_vars; // State variables
 	Variables f_outs_vars; // Output QSS variables
-	Var_Name_Ref var_name_ref; // Map from variable names to FMU variable value references
-	Var_Name_Var var_name_var; // Map from variable names to variables
+	mutable Var_Name_Var var_name_var; // Map from variable name ids to variables: Built on first lookup
 	Conditionals cons; // Conditionals
 	FMU_Variables fmu_variables; // FMU variables
 	FMUVarLookup fmu_vars; // FMU variables lookup
 	FMUVarLookup fmu_outs; // FMU output variables lookup
 	FMUVarLookup fmu_dvrs; // FMU derivative to variable lookup
-	FMU_Idxs fmu_idxs; // FMU variable index to QSS variable lookup
+	FMU_Idxs fmu_idxs; // FMU variable index to QSS variable lookup: Dense
+	Arena var_arena; // QSS variable arena
+	DepIdxs var_slots; // FMU variable index to QSS variable arena slot during variable creation (no_slot => Heap)
+	Pool< Variable * > observers_variables_pool; // QSS variable observers pooled variable arrays
+	Pool< VariableRef > observers_refs_pool; // QSS variable observers pooled FMU value reference arrays
+	Pool< Real > observers_reals_pool; // QSS variable observers pooled FMU value and derivative arrays
 	FMU_EIs fmu_eis; // FMU event indicator index to QSS ZC variable lookup
-	Ref_Var qss_var_of_ref;
 	VariableRefs out_var_refs;
 	std::vector< Output<> > f_outs; // FMU QSS variable outputs
 	std::vector< Output<> > l_outs; // FMU local variable outputs
+	Variables smp_NC_R; // Non-zero-crossing non-connection variables with batched Real FMU sets
+	Variables smp_NC_O; // Non-zero-crossing non-connection variables with individual FMU sets
+	VariableRefs smp_NC_R_refs; // Batched Real FMU set value references
+	Reals smp_NC_R_vals; // Batched Real FMU set values
+	Var_Indexes smp_l_R_idx; // Real FMU local variable output indexes
+	Var_Indexes smp_l_I_idx; // Integer FMU local variable output indexes
+	Var_Indexes smp_l_B_idx; // Boolean FMU local variable output indexes
+	VariableRefs smp_l_R_refs; // Real FMU local variable output value references
+	VariableRefs smp_l_I_refs; // Integer FMU local variable output value references
+	VariableRefs smp_l_B_refs; // Boolean FMU local variable output value references
+	Reals smp_l_R_vals; // Real FMU local variable output values
+	std::vector< Integer > smp_l_I_vals; // Integer FMU local variable output values
+	std::vector< fmi2_boolean_t > smp_l_B_vals; // Boolean FMU local variable output values
+	Reals l_outs_vals; // FMU local variable output values
+	std::vector< bool > l_outs_local; // FMU local variable outputs with local causality
 	int order_max_CI{ 0 }; // Connection input QSS variable max order
 	int order_max_NC{ 0 }; // Non-zero-crossing non-connection QSS variable max order
 	bool has_event_indicators{ false };
@@ -818,11 +934,25 @@ public: // Data
 	bool doDOut{ false }; // Discrete events
 	bool doTOut{ false }; // Time Steps
 	bool doSOut{ false }; // Sampled
+	bool doAgg{ false }; // Aggregates
+	ShmRing * shm{ nullptr }; // Shared-memory output ring
+
+	// Aggregates
+	std::vector< Aggregate > aggs; // Trajectory aggregates
+	Variables agg_vars; // Aggregated variables
 
 	// Results
 	Results_CSV<> csv;
-	Results_CSV<>::Values res_var_vals;
-	Var_Indexes res_var_indexes;
+	Results_CSV<>::Values res_var_vals; // CSV result values
+	Var_Indexes res_R_idx; // Real CSV result indexes
+	Var_Indexes res_I_idx; // Integer CSV result indexes
+	Var_Indexes res_B_idx; // Boolean CSV result indexes
+	VariableRefs res_R_refs; // Real CSV result value references
+	VariableRefs res_I_refs; // Integer CSV result value references
+	VariableRefs res_B_refs; // Boolean CSV result value references
+	Reals res_R_vals; // Real CSV result values
+	std::vector< Integer > res_I_vals; // Integer CSV result values
+	std::vector< fmi2_boolean_t > res_B_vals; // Boolean CSV result values
 
 	// Simulation
 	size_type const max_pass_count_multiplier{ 2 };
@@ -830,6 +960,8 @@ public: // Data
 	size_type n_QSS_events{ 0u };
 	size_type n_QSS_simultaneous_events{ 0u };
 	size_type n_ZC_events{ 0u };
+	mutable size_type n_fmu_calls{ 0u }; // FMU get/set/derivative calls
+	Reals set_reals_vals; // set_reals work-around values scratch
 	double sim_dtMin{ 0.0 };
 	bool pass_warned{ false };
 	Variables observers;
@@ -838,8 +970,6 @@ public: // Data
 	int tPer{ 0 }; // Percent of simulation time completed
 	double sim_cpu_time{ 0.0 }; // Simulation CPU time
 	double sim_wall_time{ 0.0 }; // Simulation wall time
-	Counts c_QSS_events;
-	Counts c_ZC_events;
 
 }; // FMU_ME
 
@@ -0,0 +1,382 @@
+// QSS Compiled Variable Name Glob Matchers
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_Glob_hh_INCLUDED
+#define QSS_Glob_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// QSS Compiled Glob Matcher of a Variable Spec
+//
+// Specs are globs: * matches any sequence and ? matches any character with other characters literal
+// Specs using other regex syntax are matched with std::regex built by regex_string as before
+class Glob final
+{
+
+public: // Types
+
+	using size_type = std::string::size_type;
+
+public: // Creation
+
+	// Default Constructor
+	Glob() = default;
+
+	// Spec Constructor
+	explicit
+	Glob( std::string const & spec ) :
+	 spec_( spec )
+	{
+		if ( is_regex_spec( spec_ ) ) { // Regex fallback
+			regex_ = std::make_shared< std::regex const >( regex_string( spec_ ) ); // Can throw exception if resulting string is not a valid regex
+		} else {
+			size_type const i_wild( spec_.find_first_of( "*?" ) );
+			if ( i_wild == std::string::npos ) { // Literal
+				literal_ = true;
+				prefix_len_ = spec_.length();
+			} else {
+				prefix_len_ = i_wild;
+				size_type const l_wild( spec_.find_last_of( "*?" ) );
+				suffix_len_ = spec_.length() - l_wild - 1u;
+				prefix_only_ = ( i_wild == l_wild ) && ( spec_[ i_wild ] == '*' ) && ( suffix_len_ == 0u );
+				for ( char const c : spec_ ) {
+					if ( c == '?' ) ++min_len_;
+				}
+				min_len_ += prefix_len_ + suffix_len_;
+			}
+		}
+	}
+
+public: // Predicate
+
+	// Regex Fallback?
+	bool
+	is_regex() const
+	{
+		return bool( regex_ );
+	}
+
+	// Literal Name?
+	bool
+	is_literal() const
+	{
+		return literal_;
+	}
+
+	// Literal Prefix Followed by a Single Trailing * ?
+	bool
+	is_prefix() const
+	{
+		return prefix_only_;
+	}
+
+	// Name Matches Spec?
+	bool
+	operator ()( std::string_view const name ) const
+	{
+		if ( regex_ ) return std::regex_match( name.begin(), name.end(), *regex_ );
+		if ( literal_ ) return name == spec_;
+		if ( name.length() < min_len_ ) return false;
+		std::string_view const spec( spec_ );
+		if ( name.compare( 0u, prefix_len_, spec, 0u, prefix_len_ ) != 0 ) return false;
+		if ( prefix_only_ ) return true;
+		if ( name.compare( name.length() - suffix_len_, suffix_len_, spec, spec.length() - suffix_len_, suffix_len_ ) != 0 ) return false;
+		return wildcard_match( spec.substr( prefix_len_ ), name.substr( prefix_len_ ) );
+	}
+
+public: // Property
+
+	// Spec
+	std::string const &
+	spec() const
+	{
+		return spec_;
+	}
+
+	// Literal Prefix
+	std::string_view
+	prefix() const
+	{
+		return std::string_view( spec_ ).substr( 0u, prefix_len_ );
+	}
+
+public: // Static Methods
+
+	// Spec Uses Regex Syntax Beyond * and ? ?
+	static
+	bool
+	is_regex_spec( std::string const & spec )
+	{
+		return spec.find_first_of( "\\^$|(){}+" ) != std::string::npos;
+	}
+
+	// Regex String of a Variable Spec
+	static
+	std::string
+	regex_string( std::string const & spec )
+	{
+		// Convert glob usage to regex (imperfect)
+		std::string re_spec;
+		for ( char const c : spec ) {
+			if ( c == '?' ) {
+				re_spec.push_back( '.' );
+			} else if ( c == '*' ) {
+				re_spec.append( ".*" );
+			} else if ( c == '.' ) {
+				re_spec.append( "\\." );
+			} else if ( c == '[' ) {
+				re_spec.append( "\\[" );
+			} else if ( c == ']' ) {
+				re_spec.append( "\\]" );
+			} else {
+				re_spec.push_back( c );
+			}
+		}
+		return re_spec;
+	}
+
+private: // Static Methods
+
+	// Wildcard Match: Greedy with Backtrack to the Last * so Linear in Typical Use
+	static
+	bool
+	wildcard_match( std::string_view const pat, std::string_view const str )
+	{
+		size_type p( 0u ), s( 0u );
+		size_type p_star( std::string::npos ), s_star( 0u );
+		while ( s < str.length() ) {
+			if ( ( p < pat.length() ) && ( ( pat[ p ] == '?' ) || ( ( pat[ p ] != '*' ) && ( pat[ p ] == str[ s ] ) ) ) ) {
+				++p;
+				++s;
+			} else if ( ( p < pat.length() ) && ( pat[ p ] == '*' ) ) {
+				p_star = p++;
+				s_star = s;
+			} else if ( p_star != std::string::npos ) {
+				p = p_star + 1u;
+				s = ++s_star;
+			} else {
+				return false;
+			}
+		}
+		while ( ( p < pat.length() ) && ( pat[ p ] == '*' ) ) ++p;
+		return p == pat.length();
+	}
+
+private: // Data
+
+	std::string spec_; // Spec
+	size_type prefix_len_{ 0u }; // Literal prefix length
+	size_type suffix_len_{ 0u }; // Literal suffix length after last wildcard
+	size_type min_len_{ 0u }; // Minimum matching name length
+	bool literal_{ false }; // Literal name?
+	bool prefix_only_{ false }; // Literal prefix followed by a single trailing * ?
+	std::shared_ptr< std::regex const > regex_; // Regex fallback
+
+}; // Glob
+
+// QSS Compiled Glob Set: One-Pass Matching of a Name Against All Specs
+//
+// Literal specs are hashed, prefix* specs are looked up by prefix length, and only general globs are scanned
+class Globs final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Indexes = std::vector< size_type >;
+
+	static constexpr size_type npos{ std::numeric_limits< size_type >::max() };
+
+public: // Creation
+
+	// Default Constructor
+	Globs() = default;
+
+public: // Predicate
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return globs_.empty();
+	}
+
+	// Name Matches Any Spec?
+	bool
+	any( std::string const & name ) const
+	{
+		if ( literals_.find( name ) != literals_.end() ) return true;
+		std::string_view const name_v( name );
+		for ( size_type const len : prefix_lengths_ ) {
+			if ( len > name_v.length() ) break;
+			if ( prefixes_.find( name_v.substr( 0u, len ) ) != prefixes_.end() ) return true;
+		}
+		for ( size_type const i : general_ ) {
+			if ( globs_[ i ]( name_v ) ) return true;
+		}
+		return false;
+	}
+
+	// Name Matches Any Spec?
+	bool
+	operator ()( std::string const & name ) const
+	{
+		return any( name );
+	}
+
+public: // Property
+
+	// Size
+	size_type
+	size() const
+	{
+		return globs_.size();
+	}
+
+	// Glob at Index
+	Glob const &
+	operator []( size_type const i ) const
+	{
+		assert( i < globs_.size() );
+		return globs_[ i ];
+	}
+
+	// Index of First Spec Matching a Name or npos
+	size_type
+	first( std::string const & name ) const
+	{
+		size_type i_min( npos );
+		auto const l( literals_.find( name ) );
+		if ( l != literals_.end() ) i_min = l->second.front();
+		std::string_view const name_v( name );
+		for ( size_type const len : prefix_lengths_ ) {
+			if ( len > name_v.length() ) break;
+			auto const p( prefixes_.find( name_v.substr( 0u, len ) ) );
+			if ( p != prefixes_.end() ) i_min = std::min( i_min, p->second.front() );
+		}
+		for ( size_type const i : general_ ) {
+			if ( i >= i_min ) break;
+			if ( globs_[ i ]( name_v ) ) return i;
+		}
+		return i_min;
+	}
+
+	// Indexes of All Specs Matching a Name in Ascending Order
+	void
+	matches( std::string const & name, Indexes & idxs ) const
+	{
+		idxs.clear();
+		auto const l( literals_.find( name ) );
+		if ( l != literals_.end() ) idxs.insert( idxs.end(), l->second.begin(), l->second.end() );
+		std::string_view const name_v( name );
+		for ( size_type const len : prefix_lengths_ ) {
+			if ( len > name_v.length() ) break;
+			auto const p( prefixes_.find( name_v.substr( 0u, len ) ) );
+			if ( p != prefixes_.end() ) idxs.insert( idxs.end(), p->second.begin(), p->second.end() );
+		}
+		for ( size_type const i : general_ ) {
+			if ( globs_[ i ]( name_v ) ) idxs.push_back( i );
+		}
+		std::sort( idxs.begin(), idxs.end() );
+	}
+
+public: // Methods
+
+	// Add a Spec: Can Throw if a Regex Fallback Spec is Invalid
+	void
+	add( std::string const & spec )
+	{
+		add( Glob( spec ) );
+	}
+
+	// Add a Glob
+	void
+	add( Glob const & glob )
+	{
+		size_type const i( globs_.size() );
+		globs_.push_back( glob );
+		if ( glob.is_literal() ) {
+			literals_[ glob.spec() ].push_back( i );
+		} else if ( glob.is_prefix() ) {
+			std::string_view const prefix( glob.prefix() );
+			auto p( prefixes_.find( prefix ) );
+			if ( p == prefixes_.end() ) p = prefixes_.emplace( std::string( prefix ), Indexes() ).first;
+			p->second.push_back( i );
+			auto const l( std::lower_bound( prefix_lengths_.begin(), prefix_lengths_.end(), prefix.length() ) );
+			if ( ( l == prefix_lengths_.end() ) || ( *l != prefix.length() ) ) prefix_lengths_.insert( l, prefix.length() );
+		} else {
+			general_.push_back( i );
+		}
+	}
+
+	// Clear
+	void
+	clear()
+	{
+		globs_.clear();
+		literals_.clear();
+		prefixes_.clear();
+		prefix_lengths_.clear();
+		general_.clear();
+	}
+
+private: // Data
+
+	std::vector< Glob > globs_; // Globs in spec order
+	std::unordered_map< std::string, Indexes > literals_; // Literal spec indexes by name
+	std::map< std::string, Indexes, std::less<> > prefixes_; // Prefix-only spec indexes by prefix
+	Indexes prefix_lengths_; // Distinct prefix lengths in ascending order
+	Indexes general_; // General glob and regex spec indexes in ascending order
+
+}; // Globs
+
+} // QSS
+
+#endif
@@ -0,0 +1,175 @@
+// Interned Name Table
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_NameTable_hh_INCLUDED
+#define QSS_NameTable_hh_INCLUDED
+
+// C++ Headers
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace QSS {
+
+// Interned Name Table
+//
+// Each distinct name is stored once and identified by a 32-bit id: Id 0 is the empty name
+// Concurrent model runs intern names while other threads look them up so access is guarded by a reader/writer lock
+// Stored names don't move so references to them stay valid after the lock is released
+class NameTable final
+{
+
+public: // Types
+
+	using Id = std::uint32_t;
+	using size_type = std::size_t;
+
+	static constexpr Id none{ std::numeric_limits< Id >::max() }; // Not found
+
+private: // Creation
+
+	// Default Constructor
+	NameTable()
+	{
+		intern( std::string_view() ); // Id 0 is the empty name
+	}
+
+public: // Creation
+
+	// Copy Constructor
+	NameTable( NameTable const & ) = delete;
+
+public: // Assignment
+
+	// Copy Assignment
+	NameTable &
+	operator =( NameTable const & ) = delete;
+
+public: // Static Methods
+
+	// Process Name Table
+	static
+	NameTable &
+	instance();
+
+public: // Property
+
+	// Size
+	size_type
+	size() const
+	{
+		std::shared_lock< std::shared_mutex > const lock( mutex_ );
+		return names_.size();
+	}
+
+	// Characters Stored
+	size_type
+	chars() const
+	{
+		std::shared_lock< std::shared_mutex > const lock( mutex_ );
+		return chars_;
+	}
+
+	// Name of an Id
+	std::string const &
+	name( Id const id ) const
+	{
+		std::shared_lock< std::shared_mutex > const lock( mutex_ );
+		assert( id < names_.size() );
+		return names_[ id ];
+	}
+
+public: // Subscript
+
+	// Name of an Id
+	std::string const &
+	operator []( Id const id ) const
+	{
+		std::shared_lock< std::shared_mutex > const lock( mutex_ );
+		assert( id < names_.size() );
+		return names_[ id ];
+	}
+
+public: // Methods
+
+	// Intern a Name and Return its Id
+	Id
+	intern( std::string_view const name )
+	{
+		{ // Already interned?
+			std::shared_lock< std::shared_mutex > const lock( mutex_ );
+			auto const i( ids_.find( name ) );
+			if ( i != ids_.end() ) return i->second;
+		}
+		std::unique_lock< std::shared_mutex > const lock( mutex_ );
+		auto const i( ids_.find( name ) ); // Another thread may have interned it since the check
+		if ( i != ids_.end() ) return i->second;
+		assert( names_.size() < size_type( none ) );
+		Id const id( static_cast< Id >( names_.size() ) );
+		std::string const & stored( names_.emplace_back( name ) ); // Deque elements don't move so the key view stays valid
+		ids_.emplace( std::string_view( stored ), id );
+		chars_ += stored.length();
+		return id;
+	}
+
+	// Id of a Name or none if Not Interned
+	Id
+	find( std::string_view const name ) const
+	{
+		std::shared_lock< std::shared_mutex > const lock( mutex_ );
+		auto const i( ids_.find( name ) );
+		return i != ids_.end() ? i->second : none;
+	}
+
+private: // Data
+
+	std::deque< std::string > names_; // Names by id
+	std::unordered_map< std::string_view, Id > ids_; // Ids by name
+	size_type chars_{ 0u }; // Characters stored
+	mutable std::shared_mutex mutex_; // Guards the table
+
+}; // NameTable
+
+} // QSS
+
+#endif
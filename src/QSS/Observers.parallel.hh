@@ -38,12 +38,14 @@
 
 // QSS Headers
 #include <QSS/FMU_ME.hh>
+#include <QSS/Pooled.hh>
 #include <QSS/RefsDers.hh> //n2d
 #include <QSS/RefsDirDers.hh>
 #include <QSS/RefsValsDers.hh>
 #include <QSS/container.hh>
 #include <QSS/options.hh>
 #include <QSS/Range.hh>
+#include <QSS/RootBatch.hh>
 
 // OpenMP Headers
 #ifdef _OPENMP
@@ -54,6 +56,7 @@
 #include <algorithm>
 #include <cassert>
 #include <utility>
+#include <vector>
 
 namespace QSS {
 
@@ -72,14 +75,21 @@ public: // Types
 	using VariablesSet = typename Variable::VariablesSet;
 	using VariableRef = typename Variable::VariableRef;
 	using VariableRefs = typename Variable::VariableRefs;
-	using value_type = typename Variables::value_type;
-	using size_type = typename Variables::size_type;
-	using const_iterator = typename Variables::const_iterator;
-	using iterator = typename Variables::iterator;
-	using const_pointer = typename Variables::const_pointer;
-	using pointer = typename Variables::pointer;
-	using const_reference = typename Variables::const_reference;
-	using reference = typename Variables::reference;
+	using PooledVariables = Pooled< Variable * >;
+	using PooledVariableRefs = Pooled< VariableRef >;
+	using PooledReals = Pooled< Real >;
+	using value_type = typename PooledVariables::value_type;
+	using size_type = typename PooledVariables::size_type;
+	using const_iterator = typename PooledVariables::const_iterator;
+	using iterator = typename PooledVariables::iterator;
+	using const_pointer = typename PooledVariables::const_pointer;
+	using pointer = typename PooledVariables::pointer;
+	using const_reference = typename PooledVariables::const_reference;
+	using reference = typename PooledVariables::reference;
+
+private: // Static Data
+
+	static constexpr size_type qss_batch_min{ 8u }; // Min QSS observers to batch root solves
 
 public: // Creation
 
@@ -109,13 +119,13 @@ public: // Creation
 public: // Conversion
 
 	// Observers Conversion
-	operator Variables const &() const
+	operator PooledVariables const &() const
 	{
 		return observers_;
 	}
 
 	// Observers Conversion
-	operator Variables &()
+	operator PooledVariables &()
 	{
 		return observers_;
 	}
@@ -161,14 +171,14 @@ public: // Property
 	}
 
 	// Observers Collection
-	Variables const &
+	PooledVariables const &
 	observers() const
 	{
 		return observers_;
 	}
 
 	// Observers Collection
-	Variables &
+	PooledVariables &
 	observers()
 	{
 		return observers_;
@@ -194,7 +204,7 @@ public: // Methods
 	void
 	del( Variable * const v )
 	{
-		typename Variables::iterator const i( std::find( observers_.begin(), observers_.end(), v ) );
+		iterator const i( std::find( observers_.begin(), observers_.end(), v ) );
 		if ( i != observers_.end() ) observers_.erase( i );
 	}
 
@@ -211,6 +221,15 @@ public: // Methods
 		computational_observers_.assign( observers_set.begin(), observers_set.end() ); // Swap in the computational observers
 	}
 
+	// Set Precomputed Computational Observers
+	void
+	set_computational_observers( Variables && computational_observers )
+	{
+		assert( trigger_ != nullptr );
+		computational_observers_.assign( computational_observers.begin(), computational_observers.end() );
+		Variables().swap( computational_observers ); // Recover memory
+	}
+
 	// Assign Computational Observers
 	void
 	assign_computational_observers()
@@ -220,11 +239,11 @@ public: // Methods
 		computational_observers_.shrink_to_fit(); // Recover memory
 	}
 
-	// Initialize for Observers of a Single Variable
+	// Initialize for Observers of a Single Variable: Arrays are built in the model-level pools
 	void
 	init()
 	{
-		set_up( true );
+		set_up( true, true );
 	}
 
 	// Assign a Triggers Collection
@@ -246,7 +265,8 @@ public: // Methods
 				}
 			}
 		} else { // Binary search
-			Variables sorted_triggers( triggers ); // Copy triggers to avoid sorting side effect causing non-deterministic results
+			static thread_local Variables sorted_triggers; // Reused scratch: No steady-state allocation
+			sorted_triggers.assign( triggers.begin(), triggers.end() ); // Copy triggers to avoid sorting side effect causing non-deterministic results
 			std::sort( sorted_triggers.begin(), sorted_triggers.end() );
 			for ( Variable * trigger : sorted_triggers ) {
 				for ( Variable * observer : trigger->observers() ) {
@@ -353,7 +373,7 @@ private: // Methods
 	// Find Extended Computational Observers
 	void
 	find_computational_observers(
-	 Variables & observers,
+	 PooledVariables const & observers,
 	 VariablesSet & observers_checked,
 	 VariablesSet & observers_set
 	)
@@ -380,7 +400,7 @@ private: // Methods
 	// Find Extended X-Based Computational Observers
 	void
 	find_computational_X_observers(
-	 Variables & observers,
+	 PooledVariables const & observers,
 	 VariablesSet & observers_checked,
 	 VariablesSet & observers_set
 	)
@@ -407,6 +427,7 @@ private: // Methods
 	reset_specs()
 	{
 		connected_output_observer_ = false;
+		qss_batch_.clear();
 		all_.reset();
 		qss_.reset();
 		ns_.reset();
@@ -442,6 +463,11 @@ private: // Methods
 		}
 		if ( qss_.began() ) {
 			qss_.e() = i;
+			for ( size_type j = qss_.b(), e = qss_.e(); j < e; ++j ) { // Batch the requantization root solves of the QSS observers that support them
+				if ( observers_[ j ]->is_root_batch() ) qss_batch_.push_back( j );
+			}
+			if ( qss_batch_.size() < qss_batch_min ) qss_batch_.clear();
+			qss_batch_.shrink_to_fit();
 		}
 
 		// Non-state observers
@@ -489,16 +515,23 @@ private: // Methods
 
 	// Set up for Current Observers
 	void
-	set_up( bool const recover = false )
+	set_up( bool const recover = false, bool const pooled = false )
 	{
 		if ( observers_.empty() ) {
 			reset_specs();
 			return;
 		}
 
+		// Model-level pools that the arrays are built in if pooled: Segments are taken in setup order
+		assert( ( !pooled ) || ( fmu_me_ != nullptr ) );
+		Pool< Variable * > * const variables_pool( pooled ? &fmu_me_->observers_variables_pool : nullptr );
+		Pool< VariableRef > * const refs_pool( pooled ? &fmu_me_->observers_refs_pool : nullptr );
+		Pool< Real > * const reals_pool( pooled ? &fmu_me_->observers_reals_pool : nullptr );
+
 		// Remove duplicates then sort by type
-		uniquify( observers_, recover ); // Sort by address and remove duplicates and optionally recover unused memory
+		uniquify( observers_, recover && !pooled ); // Sort by address and remove duplicates and optionally recover unused memory
 		sort_by_type( observers_ );
+		if ( pooled ) observers_.pool( *variables_pool );
 
 		// Set specs
 		set_specs();
@@ -506,14 +539,14 @@ private: // Methods
 		// FMU pooled data set up
 		if ( qss_.have() ) { // State variables
 			if ( options::d2d ) {
-				qss_ders_.clear_and_reserve( qss_.n() );
+				clear_and_reserve( qss_ders_, qss_.n(), refs_pool, reals_pool );
 				for ( size_type i = qss_.b(), e = qss_.e(); i < e; ++i ) {
 					assert( observers_[ i ]->is_QSS() );
 					qss_ders_.push_back( observers_[ i ]->der().ref() );
 				}
 			} else {
 				assert( options::n2d );
-				qss_dn2d_.clear_and_reserve( qss_.n() );
+				clear_and_reserve( qss_dn2d_, qss_.n(), refs_pool, reals_pool );
 				for ( size_type i = qss_.b(), e = qss_.e(); i < e; ++i ) {
 					assert( observers_[ i ]->is_QSS() );
 					qss_dn2d_.push_back( observers_[ i ]->der().ref() );
@@ -521,14 +554,14 @@ private: // Methods
 			}
 		}
 		if ( r_.have() ) { // R variables
-			r_vars_.clear_and_reserve( r_.n() );
+			clear_and_reserve( r_vars_, r_.n(), refs_pool, reals_pool );
 			for ( size_type i = r_.b(), e = r_.e(); i < e; ++i ) {
 				assert( observers_[ i ]->is_R() );
 				r_vars_.push_back( observers_[ i ]->var().ref() );
 			}
 		}
 		if ( zc_.have() ) { // Zero-crossing variables
-			zc_vars_.clear_and_reserve( zc_.n() );
+			clear_and_reserve( zc_vars_, zc_.n(), refs_pool, reals_pool );
 			for ( size_type i = zc_.b(), e = zc_.e(); i < e; ++i ) {
 				assert( observers_[ i ]->is_ZC() );
 				zc_vars_.push_back( observers_[ i ]->var().ref() );
@@ -539,14 +572,7 @@ private: // Methods
 
 		// QSS observer observees set up
 		if ( qss_.have() ) {
-			qss_observees_.clear();
-			for ( size_type i = qss_.b(), e = qss_.e(); i < e; ++i ) {
-				Variable * observer( observers_[ i ] );
-				for ( auto observee : observer->observees() ) {
-					qss_observees_.push_back( observee );
-				}
-			}
-			uniquify( qss_observees_ );
+			set_observees( qss_, qss_observees_, variables_pool );
 			n_qss_observees_ = qss_observees_.size();
 		} else {
 			n_qss_observees_ = 0u;
@@ -554,15 +580,7 @@ private: // Methods
 
 		// Real observer observees set up
 		if ( r_.have() ) {
-			r_observees_.clear();
-			for ( size_type i = r_.b(), e = r_.e(); i < e; ++i ) {
-				Variable * observer( observers_[ i ] );
-				assert( !observer->self_observee() );
-				for ( auto observee : observer->observees() ) {
-					r_observees_.push_back( observee );
-				}
-			}
-			uniquify( r_observees_ );
+			set_observees( r_, r_observees_, variables_pool );
 			n_r_observees_ = r_observees_.size();
 		} else {
 			n_r_observees_ = 0u;
@@ -586,15 +604,7 @@ private: // Methods
 
 		// Zero-crossing observer observees set up
 		if ( zc_.have() ) {
-			zc_observees_.clear();
-			for ( size_type i = zc_.b(), e = zc_.e(); i < e; ++i ) {
-				Variable * observer( observers_[ i ] );
-				assert( !observer->self_observee() );
-				for ( auto observee : observer->observees() ) {
-					zc_observees_.push_back( observee );
-				}
-			}
-			uniquify( zc_observees_ );
+			set_observees( zc_, zc_observees_, variables_pool );
 			n_zc_observees_ = zc_observees_.size();
 		} else {
 			n_zc_observees_ = 0u;
@@ -604,9 +614,9 @@ private: // Methods
 
 		// QSS observers
 		if ( qss_.have() ) {
-			qss_observees_v_ref_.clear(); qss_observees_v_ref_.reserve( n_qss_observees_ );
-			qss_observees_v_.clear(); qss_observees_v_.resize( n_qss_observees_ );
-			if ( options::d2d ) { qss_observees_dv_.clear(); qss_observees_dv_.resize( n_qss_observees_ ); }
+			clear_and_reserve( qss_observees_v_ref_, n_qss_observees_, refs_pool );
+			clear_and_reserve( qss_observees_v_, n_qss_observees_, reals_pool ); qss_observees_v_.resize( n_qss_observees_ );
+			if ( options::d2d ) { clear_and_reserve( qss_observees_dv_, n_qss_observees_, reals_pool ); qss_observees_dv_.resize( n_qss_observees_ ); }
 			for ( auto observee : qss_observees_ ) {
 				qss_observees_v_ref_.push_back( observee->var().ref() );
 			}
@@ -614,9 +624,9 @@ private: // Methods
 
 		// Real observers
 		if ( r_.have() ) {
-			r_observees_v_ref_.clear(); r_observees_v_ref_.reserve( n_r_observees_ );
-			r_observees_v_.clear(); r_observees_v_.resize( n_r_observees_ );
-			r_observees_dv_.clear(); r_observees_dv_.resize( n_r_observees_ );
+			clear_and_reserve( r_observees_v_ref_, n_r_observees_, refs_pool );
+			clear_and_reserve( r_observees_v_, n_r_observees_, reals_pool ); r_observees_v_.resize( n_r_observees_ );
+			clear_and_reserve( r_observees_dv_, n_r_observees_, reals_pool ); r_observees_dv_.resize( n_r_observees_ );
 			for ( auto observee : r_observees_ ) {
 				r_observees_v_ref_.push_back( observee->var().ref() );
 			}
@@ -624,15 +634,74 @@ private: // Methods
 
 		// Zero-crossing observers
 		if ( zc_.have() ) {
-			zc_observees_v_ref_.clear(); zc_observees_v_ref_.reserve( n_zc_observees_ );
-			zc_observees_v_.clear(); zc_observees_v_.resize( n_zc_observees_ );
-			zc_observees_dv_.clear(); zc_observees_dv_.resize( n_zc_observees_ );
+			clear_and_reserve( zc_observees_v_ref_, n_zc_observees_, refs_pool );
+			clear_and_reserve( zc_observees_v_, n_zc_observees_, reals_pool ); zc_observees_v_.resize( n_zc_observees_ );
+			clear_and_reserve( zc_observees_dv_, n_zc_observees_, reals_pool ); zc_observees_dv_.resize( n_zc_observees_ );
 			for ( auto observee : zc_observees_ ) {
 				zc_observees_v_ref_.push_back( observee->var().ref() );
 			}
 		}
 	}
 
+	// Set Unique Observees of an Observer Range: In a Pool if Given
+	void
+	set_observees(
+	 Range const & range,
+	 PooledVariables & observees,
+	 Pool< Variable * > * const pool
+	)
+	{
+		static thread_local Variables collected; // Reused scratch: Observees are then assigned in one segment
+		collected.clear();
+		for ( size_type i = range.b(), e = range.e(); i < e; ++i ) {
+			Variable * observer( observers_[ i ] );
+			assert( ( &range == &qss_ ) || ( !observer->self_observee() ) );
+			for ( auto observee : observer->observees() ) {
+				collected.push_back( observee );
+			}
+		}
+		uniquify( collected );
+		clear_and_reserve( observees, collected.size(), pool );
+		observees.assign( collected.begin(), collected.end() );
+	}
+
+	// Clear and Reserve an Array: In a Pool if Given
+	template< typename T >
+	static
+	void
+	clear_and_reserve(
+	 Pooled< T > & a,
+	 size_type const n,
+	 Pool< T > * const pool
+	)
+	{
+		a.clear();
+		if ( pool != nullptr ) {
+			a.reserve( *pool, n );
+		} else {
+			a.reserve( n );
+		}
+	}
+
+	// Clear and Reserve FMU Arrays: In Pools if Given
+	template< typename Arrays >
+	static
+	void
+	clear_and_reserve(
+	 Arrays & arrays,
+	 size_type const n,
+	 Pool< VariableRef > * const refs_pool,
+	 Pool< Real > * const reals_pool
+	)
+	{
+		if ( refs_pool != nullptr ) {
+			assert( reals_pool != nullptr );
+			arrays.clear_and_reserve( n, *refs_pool, *reals_pool );
+		} else {
+			arrays.clear_and_reserve( n );
+		}
+	}
+
 	// Advance QSS State Observers
 	void
 	advance_QSS( Time const t )
@@ -1341,7 +1410,7 @@ private: // Methods
 		if ( ( max_threads_ > 1u ) && ( observers_.size() >= max_threads_ * 64u ) ) { // Parallel
 
 		#pragma omp parallel for schedule(static)
-		for ( typename Variables::iterator observer = observers_.begin(); observer != observers_.end(); ++observer ) { // OpenMP 3.0+ supports this form
+		for ( iterator observer = observers_.begin(); observer != observers_.end(); ++observer ) { // OpenMP 3.0+ supports this form
 		// for ( Variable * observer : observers_ ) { // OpenMP 5.0+ supports this form
 			(*observer)->advance_observer_F_parallel();
 		}
@@ -1350,6 +1419,8 @@ private: // Methods
 			observer->advance_observer_F_serial();
 		}
 
+		} else if ( !qss_batch_.empty() ) { // Serial with batched QSS root solves
+			advance_F_batch();
 		} else { // Serial
 #endif // _OPENMP
 		for ( Variable * observer : observers_ ) {
@@ -1360,6 +1431,26 @@ private: // Methods
 #endif // _OPENMP
 	}
 
+	// Advance: Stage Final: Batched QSS Root Solves
+	void
+	advance_F_batch()
+	{
+		assert( !qss_batch_.empty() );
+		static thread_local RootBatch roots;
+		roots.clear();
+		for ( size_type const i : qss_batch_ ) {
+			observers_[ i ]->advance_observer_F_root_add( roots );
+		}
+		roots.solve();
+		for ( size_type i = 0u, e = all_.e(), k = 0u, n = qss_batch_.size(); i < e; ++i ) { // Shifts in observer order to preserve event queue ordering
+			if ( ( k < n ) && ( qss_batch_[ k ] == i ) ) { // Batched
+				observers_[ i ]->advance_observer_F_root( roots[ k++ ] );
+			} else {
+				observers_[ i ]->advance_observer_F();
+			}
+		}
+	}
+
 	// Advance: Stage d
 	void
 	advance_d() const
@@ -1532,10 +1623,11 @@ private: // Data
 
 	Variable * trigger_{ nullptr }; // Trigger variable
 
-	Variables observers_; // Observers
-	Variables computational_observers_; // Computational observers
+	PooledVariables observers_; // Observers
+	PooledVariables computational_observers_; // Computational observers
 
 	bool connected_output_observer_{ false }; // Output connection observer to another FMU?
+	std::vector< size_type > qss_batch_; // QSS observers with batched requantization root solves
 
 	// Observer order
 	int order_{ 0 };
@@ -1556,24 +1648,24 @@ private: // Data
 
 	// QSS state observers observees
 	size_type n_qss_observees_{ 0u }; // Number of QSS observers observees
-	Variables qss_observees_; // QSS observers observees
-	VariableRefs qss_observees_v_ref_; // QSS observers observees value references
-	Reals qss_observees_v_; // QSS handlers observees values
-	Reals qss_observees_dv_; // QSS observers observees derivatives
+	PooledVariables qss_observees_; // QSS observers observees
+	PooledVariableRefs qss_observees_v_ref_; // QSS observers observees value references
+	PooledReals qss_observees_v_; // QSS handlers observees values
+	PooledReals qss_observees_dv_; // QSS observers observees derivatives
 
 	// Real observers observees
 	size_type n_r_observees_{ 0u }; // Number of Real observers observees
-	Variables r_observees_; // Real observers observees
-	VariableRefs r_observees_v_ref_; // Real observers observees value references
-	Reals r_observees_v_; // Real handlers observees values
-	Reals r_observees_dv_; // Real observers observees derivatives
+	PooledVariables r_observees_; // Real observers observees
+	PooledVariableRefs r_observees_v_ref_; // Real observers observees value references
+	PooledReals r_observees_v_; // Real handlers observees values
+	PooledReals r_observees_dv_; // Real observers observees derivatives
 
 	// Zero-crossing observers observees
 	size_type n_zc_observees_{ 0u }; // Number of Real observers observees
-	Variables zc_observees_; // Zero-crossing observers observees
-	VariableRefs zc_observees_v_ref_; // Zero-crossing observers observees value references
-	Reals zc_observees_v_; // Zero-crossing handlers observees values
-	Reals zc_observees_dv_; // Zero-crossing observers observees derivatives
+	PooledVariables zc_observees_; // Zero-crossing observers observees
+	PooledVariableRefs zc_observees_v_ref_; // Zero-crossing observers observees value references
+	PooledReals zc_observees_v_; // Zero-crossing handlers observees values
+	PooledReals zc_observees_dv_; // Zero-crossing observers observees derivatives
 
 	// QSS advance method pointer
 	void (Observers::*advance_QSS_ptr)( Time const t ){ nullptr };
@@ -37,6 +37,7 @@
 #define QSS_Output_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/OutputPool.hh>
 #include <QSS/path.hh>
 
 // C++ Headers
@@ -44,9 +45,11 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <new>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 #if ( __cplusplus >= 201703L ) && ( ( _MSC_VER >= 1924 ) || ( ( __GNUC__ >= 11 ) && !defined(__llvm__) ) || ( defined(__llvm__) && ( !defined(__APPLE_CC__) && ( __clang_major__ >= 14 ) ) || ( defined( __APPLE_CC__ ) && ( __clang_major__ >= 15 ) ) ) ) // C++17+
 #include <charconv>
@@ -56,16 +59,34 @@
 namespace QSS {
 
 // QSS Variable Output Signal Class
+//
+// Buffered entries are held in chunks checked out from the thread's OutputPool
+// so buffer memory scales with output activity instead of output count
+// File creation and header lines are deferred to the first flush so setup doesn't create a file per output
+// An explicit flush creates the file even without entries: Owners flush at the end of a run so each output has a file
+// Destruction only writes buffered entries: An output that is never flushed and never has entries creates no file
 template< typename Value = double >
-class Output final
+class Output final : public OutputPool::Client
 {
 
 public: // Types
 
 	using Time = double;
-	using Times = std::vector< Time >;
-	using Values = std::vector< Value >;
-	using size_type = Times::size_type;
+	using size_type = OutputPool::size_type;
+
+private: // Types
+
+	// Time and Value Entry
+	struct Entry final
+	{
+		Time t; // Time
+		Value v; // Value
+	};
+
+	using Entries = OutputPool::Chunks;
+
+	static_assert( std::is_trivially_destructible_v< Value >, "Output Value type must be trivially destructible" );
+	static_assert( sizeof( Entry ) <= OutputPool::chunk_bytes, "Output Value type too large for pool chunks" );
 
 public: // Creation
 
@@ -78,14 +99,9 @@ public: // Creation
 	 char const flag,
 	 bool const do_init = true
 	) :
-	 file_( var + '.' + flag + ".out" )
-	{
-		if ( do_init ) {
-			t_.reserve( capacity_ );
-			v_.reserve( capacity_ );
-			std::ofstream( file_, std::ios_base::binary | std::ios_base::out );
-		}
-	}
+	 file_( var + '.' + flag + ".out" ),
+	 pending_( do_init )
+	{}
 
 	// Name + Flag + Decoration Constructor
 	Output(
@@ -95,14 +111,9 @@ public: // Creation
 	 bool const do_init = true
 	) :
 	 dec_( dec ),
-	 file_( var + dec + '.' + flag + ".out" )
-	{
-		if ( do_init ) {
-			t_.reserve( capacity_ );
-			v_.reserve( capacity_ );
-			std::ofstream( file_, std::ios_base::binary | std::ios_base::out );
-		}
-	}
+	 file_( var + dec + '.' + flag + ".out" ),
+	 pending_( do_init )
+	{}
 
 	// Directory + Name + Flag Constructor
 	Output(
@@ -112,26 +123,46 @@ public: // Creation
 	 std::string const & dec = std::string()
 	) :
 	 dec_( dec ),
-	 file_( var + dec + '.' + flag + ".out" )
+	 file_( var + dec + '.' + flag + ".out" ),
+	 pending_( true )
 	{
-		t_.reserve( capacity_ );
-		v_.reserve( capacity_ );
 		if ( !dir.empty() ) {
-			if ( !path::make_dir( dir ) ) { // Model name must be valid directory name
-				std::cerr << "\nError: Output directory creation failed: " << dir << std::endl;
-				std::exit( EXIT_FAILURE );
-			}
+			make_dir( dir );
 			file_ = dir + path::sep + file_;
 		}
-		std::ofstream( file_, std::ios_base::binary | std::ios_base::out );
 	}
 
+	// Copy Constructor
+	Output( Output const & ) = delete;
+
+	// Move Constructor
+	Output( Output && o ) noexcept :
+	 OutputPool::Client( std::move( o ) ),
+	 dec_( std::move( o.dec_ ) ),
+	 file_( std::move( o.file_ ) ),
+	 head_( std::move( o.head_ ) ),
+	 entries_( std::move( o.entries_ ) ),
+	 n_( o.n_ ),
+	 pending_( o.pending_ )
+	{
+		o.entries_.clear();
+		o.n_ = 0u;
+		o.pending_ = false;
+	}
+
+	// Copy Assignment
+	Output &
+	operator =( Output const & ) = delete;
+
+	// Move Assignment
+	Output &
+	operator =( Output && ) = delete;
+
 	// Destructor
 	~Output()
 	{
-		assert( t_.size() == v_.size() );
-		assert( t_.size() < capacity_ );
-		if ( t_.size() > 0u ) flush();
+		assert( n_ < capacity_ );
+		if ( n_ > 0u ) flush();
 	}
 
 public: // Property
@@ -143,6 +174,20 @@ public: // Property
 		return file_;
 	}
 
+	// File Creation Pending?
+	bool
+	pending() const
+	{
+		return pending_;
+	}
+
+	// Number of Buffered Entries
+	size_type
+	pooled() const override
+	{
+		return n_;
+	}
+
 public: // Methods
 
 	// Decoration Set
@@ -162,11 +207,9 @@ public: // Methods
 	{
 		if ( !dec.empty() ) dec_ = dec;
 		file_ = var + dec_ + '.' + flag + ".out";
-		t_.clear();
-		v_.clear();
-		t_.reserve( capacity_ );
-		v_.reserve( capacity_ );
-		std::ofstream( file_, std::ios_base::binary | std::ios_base::out );
+		discard();
+		head_.clear();
+		pending_ = true;
 	}
 
 	// Initialize With Output Directory
@@ -180,18 +223,13 @@ public: // Methods
 	{
 		if ( !dec.empty() ) dec_ = dec;
 		file_ = var + dec_ + '.' + flag + ".out";
-		t_.clear();
-		v_.clear();
-		t_.reserve( capacity_ );
-		v_.reserve( capacity_ );
+		discard();
+		head_.clear();
+		pending_ = true;
 		if ( !dir.empty() ) {
-			if ( !path::make_dir( dir ) ) { // Model name must be valid directory name
-				std::cerr << "\nError: Output directory creation failed: " << dir << std::endl;
-				std::exit( EXIT_FAILURE );
-			}
+			make_dir( dir );
 			file_ = dir + path::sep + file_;
 		}
-		std::ofstream( file_, std::ios_base::binary | std::ios_base::out );
 	}
 
 	// Write Header Lines
@@ -201,9 +239,13 @@ public: // Methods
 	 std::string const & v_unit = std::string()
 	)
 	{
-		std::ofstream s( file_, std::ios_base::binary | std::ios_base::out | std::ios_base::app );
-		s << "Time " << v_type << '\n' << "s " << v_unit << '\n';
-		s.close();
+		if ( pending_ ) { // Write with the deferred file creation
+			head_ += "Time " + v_type + '\n' + "s " + v_unit + '\n';
+		} else {
+			std::ofstream s( file_, std::ios_base::binary | std::ios_base::out | std::ios_base::app );
+			s << "Time " << v_type << '\n' << "s " << v_unit << '\n';
+			s.close();
+		}
 	}
 
 	// Append Time and Value Pair
@@ -213,11 +255,13 @@ public: // Methods
 	 Value const & v
 	)
 	{
-		assert( t_.size() == v_.size() );
-		assert( t_.size() < capacity_ );
-		t_.push_back( t );
-		v_.push_back( v );
-		if ( t_.size() == capacity_ ) flush();
+		assert( n_ < capacity_ );
+		if ( n_ == entries_.size() * chunk_entries_ ) { // Check out another chunk
+			OutputPool::Chunk const chunk( ( pool() != nullptr ? *pool() : OutputPool::instance() ).acquire( *this ) ); // Can spill this Output
+			entries_.push_back( chunk );
+		}
+		::new ( static_cast< Entry * >( entries_[ n_ / chunk_entries_ ] ) + ( n_ % chunk_entries_ ) ) Entry{ t, v };
+		if ( ++n_ == capacity_ ) flush();
 	}
 
 	// Append Time and Value Pair
@@ -228,40 +272,93 @@ public: // Methods
 	 V const v
 	)
 	{
-		assert( t_.size() == v_.size() );
-		assert( t_.size() < capacity_ );
-		t_.push_back( t );
-		v_.push_back( Value( v ) );
-		if ( t_.size() == capacity_ ) flush();
+		append( t, Value( v ) );
 	}
 
 	// Flush Buffers to File
 	void
 	flush()
 	{
-		assert( t_.size() == v_.size() );
-		assert( t_.size() <= capacity_ );
-		if ( t_.size() == 0u ) return;
-		std::ofstream s( file_, std::ios_base::binary | std::ios_base::out | std::ios_base::app );
+		assert( n_ <= capacity_ );
+		if ( ( n_ == 0u ) && !pending_ ) return;
+		std::ofstream s( open() );
 		s << std::right << std::scientific << std::setprecision( 15 );
-		for ( size_type i = 0, e = t_.size(); i < e; ++i ) {
-			s << std::setw( 23 ) << t_[ i ] << ' ' << std::setw( 23 ) << v_[ i ] << '\n';
+		for ( size_type i = 0; i < n_; ++i ) {
+			Entry const & e( entry( i ) );
+			s << std::setw( 23 ) << e.t << ' ' << std::setw( 23 ) << e.v << '\n';
 		}
 		s.close();
-		t_.clear();
-		v_.clear();
+		discard();
+	}
+
+	// Spill Buffers to File for Pool
+	void
+	spill() override
+	{
+		flush();
+	}
+
+private: // Methods
+
+	// Open File for Appending: Creates it with any header lines on first use
+	std::ofstream
+	open()
+	{
+		if ( pending_ ) {
+			std::ofstream s( file_, std::ios_base::binary | std::ios_base::out ); // Create or truncate
+			s << head_;
+			std::string().swap( head_ );
+			pending_ = false;
+			return s;
+		}
+		return std::ofstream( file_, std::ios_base::binary | std::ios_base::out | std::ios_base::app );
+	}
+
+	// Buffered Entry i
+	Entry const &
+	entry( size_type const i ) const
+	{
+		assert( i < n_ );
+		return static_cast< Entry const * >( entries_[ i / chunk_entries_ ] )[ i % chunk_entries_ ];
+	}
+
+	// Discard Buffered Entries and Release Chunks to Pool
+	void
+	discard()
+	{
+		if ( !entries_.empty() ) {
+			assert( pool() != nullptr );
+			pool()->release( *this, entries_ ); // Pool the chunks came from
+		}
+		n_ = 0u;
+	}
+
+private: // Static Methods
+
+	// Make Output Directory
+	static
+	void
+	make_dir( std::string const & dir )
+	{
+		if ( !path::make_dir( dir ) ) { // Model name must be valid directory name
+			std::cerr << "\nError: Output directory creation failed: " << dir << std::endl;
+			std::exit( EXIT_FAILURE );
+		}
 	}
 
 private: // Static Data
 
-	static constexpr size_type capacity_{ 2048 }; // Buffer size
+	static constexpr size_type capacity_{ 2048 }; // Max buffered entries before flushing
+	static constexpr size_type chunk_entries_{ OutputPool::chunk_bytes / sizeof( Entry ) }; // Entries per pool chunk
 
 private: // Data
 
 	std::string dec_; // File name decoration
 	std::string file_; // File name
-	Times t_; // Time buffer
-	Values v_; // Value buffer
+	std::string head_; // Header lines pending file creation
+	Entries entries_; // Pool chunks holding buffered entries
+	size_type n_{ 0u }; // Number of buffered entries
+	bool pending_{ false }; // File creation pending?
 
 }; // Output
 
@@ -274,27 +371,27 @@ private: // Data
 	Output< double >::
 	flush()
 	{
-		assert( t_.size() == v_.size() );
-		assert( t_.size() <= capacity_ );
-		if ( t_.size() == 0u ) return;
-		std::ofstream s( file_, std::ios_base::binary | std::ios_base::out | std::ios_base::app );
+		assert( n_ <= capacity_ );
+		if ( ( n_ == 0u ) && !pending_ ) return;
+		std::ofstream s( open() );
 		std::string tv_string( 48u, ' ' );
 		tv_string[ 47 ] = '\n';
 		char * const t0( tv_string.data() );
 		char * const te( t0 + 23u );
 		char * const v0( t0 + 24u );
 		char * const ve( v0 + 23u );
-		for ( size_type i = 0, e = t_.size(); i < e; ++i ) {
+		for ( size_type i = 0; i < n_; ++i ) {
+			Entry const & e( entry( i ) );
 			tv_string[ 0 ] = tv_string[ 1 ] = tv_string[ 24 ] = tv_string[ 25 ] = ' ';
 
-			Time const t( t_[ i ] );
+			Time const t( e.t );
 			std::string::size_type const t_off( ( std::signbit( t ) ? 0u : 1u ) + ( ( t != 0.0 ) && ( ( std::abs( t ) >= 1.0e100 ) || ( std::abs( t ) < 1.0e-99 ) ) ? 0u : 1u ) );
 			std::to_chars_result const t_res( std::to_chars( t0 + t_off, te, t, std::chars_format::scientific, 15 ) );
 			assert( t_res.ec == std::errc{} );
 			char * tp( t_res.ptr );
 			while ( tp < te ) *(tp++) = ' ';
 
-			double const v( v_[ i ] );
+			double const v( e.v );
 			std::string::size_type const v_off( ( std::signbit( v ) ? 0u : 1u ) + ( ( v != 0.0 ) && ( ( std::abs( v ) >= 1.0e100 ) || ( std::abs( v ) < 1.0e-99 ) ) ? 0u : 1u ) );
 			std::to_chars_result const v_res( std::to_chars( v0 + v_off, ve, v, std::chars_format::scientific, 15 ) );
 			assert( v_res.ec == std::errc{} );
@@ -304,8 +401,7 @@ private: // Data
 			s << tv_string;
 		}
 		s.close();
-		t_.clear();
-		v_.clear();
+		discard();
 	}
 
 #endif
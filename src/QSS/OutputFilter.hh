@@ -37,10 +37,10 @@
 #define QSS_OutputFilter_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/Glob.hh>
 #include <QSS/string.hh>
 
 // C++ Headers
-#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <regex>
@@ -55,8 +55,8 @@ class OutputFilter final
 
 public: // Types
 
-	using Filter = std::regex;
-	using Filters = std::vector< Filter >;
+	using Filter = Glob;
+	using Filters = Globs;
 	using size_type = Filters::size_type;
 
 public: // Creation
@@ -71,7 +71,7 @@ public: // Creation
 		for ( std::string var_spec : var_specs ) {
 			if ( !strip( var_spec ).empty() ) { // Add to filter
 				try {
-					filters_.push_back( std::regex( regex_string( var_spec ) ) );
+					filters_.add( var_spec );
 				} catch (...) {
 					std::cerr << "\nError: Skipping output filter spec that yields invalid regex: " << var_spec << std::endl;
 				}
@@ -89,7 +89,7 @@ public: // Creation
 			while ( std::getline( var_stream, line ) ) {
 				if ( ( !strip( line ).empty() ) && ( line[ 0 ] != '#' ) ) { // Add to filter
 					try {
-						filters_.push_back( std::regex( regex_string( line ) ) );
+						filters_.add( line );
 					} catch (...) {
 						std::cerr << "\nError: Skipping --var filter line that yields invalid regex: " << line << std::endl;
 					}
@@ -112,7 +112,7 @@ public: // Predicate
 			if ( has_prefix( var_name, "temp_" ) && is_int( var_name.substr( 5u ) ) ) return false; // Omit temporary variables
 			return true;
 		}
-		return std::any_of( filters_.begin(), filters_.end(), [ &var_name ]( Filter const & filter ){ return std::regex_match( var_name, filter ); } ); // Name matches filter?
+		return filters_.any( var_name ); // Name matches filter?
 	}
 
 	// Generate QSS Outputs for a Variable with Given Name?
@@ -126,7 +126,7 @@ public: // Predicate
 			if ( has_prefix( var_name, "temp_" ) && is_int( var_name.substr( 5u ) ) ) return false; // Omit temporary variables
 			return true;
 		}
-		return std::any_of( filters_.begin(), filters_.end(), [ &var_name ]( Filter const & filter ){ return std::regex_match( var_name, filter ); } ); // Name matches filter?
+		return filters_.any( var_name ); // Name matches filter?
 	}
 
 	// Generate FMU Outputs for a Variable with Given Name?
@@ -140,7 +140,7 @@ public: // Predicate
 			if ( has_prefix( var_name, "temp_" ) && is_int( var_name.substr( 5u ) ) ) return false; // Omit temporary variables
 			return true;
 		}
-		return std::any_of( filters_.begin(), filters_.end(), [ &var_name ]( Filter const & filter ){ return std::regex_match( var_name, filter ); } ); // Name matches filter?
+		return filters_.any( var_name ); // Name matches filter?
 	}
 
 	// Generate Results Outputs for a Variable with Given Name?
@@ -149,7 +149,7 @@ public: // Predicate
 	{
 		if ( filters_.empty() ) return true; // Default to all signals
 		if ( var_name == "time" ) return true; // Always include time in results outputs
-		return std::any_of( filters_.begin(), filters_.end(), [ &var_name ]( Filter const & filter ){ return std::regex_match( var_name, filter ); } ); // Name matches filter?
+		return filters_.any( var_name ); // Name matches filter?
 	}
 
 public: // Static Methods
@@ -159,24 +159,7 @@ public: // Static Methods
 	std::string
 	regex_string( std::string const & spec )
 	{
-		// Convert glob usage to regex (imperfect)
-		std::string re_spec;
-		for ( char const c : spec ) {
-			if ( c == '?' ) {
-				re_spec.push_back( '.' );
-			} else if ( c == '*' ) {
-				re_spec.append( ".*" );
-			} else if ( c == '.' ) {
-				re_spec.append( "\\." );
-			} else if ( c == '[' ) {
-				re_spec.append( "\\[" );
-			} else if ( c == ']' ) {
-				re_spec.append( "\\]" );
-			} else {
-				re_spec.push_back( c );
-			}
-		}
-		return re_spec;
+		return Glob::regex_string( spec );
 	}
 
 	// Regex of a Variable Spec
@@ -0,0 +1,135 @@
+// QSS Output Buffer Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/OutputPool.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+
+namespace QSS {
+
+	// Static Data Definitions
+	OutputPool::size_type OutputPool::budget_{ 64u * 1024u * 1024u }; // Budget per simulation thread (bytes)
+
+	// Thread's Pool
+	OutputPool &
+	OutputPool::
+	instance()
+	{
+		static thread_local OutputPool pool;
+		return pool;
+	}
+
+	// Check Out a Chunk for a Client
+	OutputPool::Chunk
+	OutputPool::
+	acquire( Client & client )
+	{
+		assert( ( client.pool_ == nullptr ) || ( client.pool_ == this ) );
+		if ( free_.empty() && !allocate() ) reclaim(); // May spill client
+		if ( free_.empty() ) { // Budget too small to hold one chunk per client: Go over budget
+			slabs_.emplace_back( new unsigned char[ chunk_bytes ] );
+			free_.push_back( slabs_.back().get() );
+			++n_chunks_;
+		}
+		if ( client.slot_ == npos ) { // Register client
+			client.pool_ = this;
+			client.slot_ = clients_.size();
+			clients_.push_back( &client );
+		}
+		Chunk const chunk( free_.back() );
+		free_.pop_back();
+		return chunk;
+	}
+
+	// Release a Client's Chunks
+	void
+	OutputPool::
+	release(
+	 Client & client,
+	 Chunks & chunks
+	)
+	{
+		free_.insert( free_.end(), chunks.begin(), chunks.end() );
+		chunks.clear();
+		if ( client.slot_ != npos ) { // Unregister client
+			assert( client.pool_ == this );
+			assert( client.slot_ < clients_.size() );
+			assert( clients_[ client.slot_ ] == &client );
+			Client * const back( clients_.back() );
+			back->slot_ = client.slot_;
+			clients_[ client.slot_ ] = back;
+			clients_.pop_back();
+			client.pool_ = nullptr;
+			client.slot_ = npos;
+		}
+	}
+
+	// Allocate a Slab of Chunks within Budget: Returns Whether Any Chunks were Added
+	bool
+	OutputPool::
+	allocate()
+	{
+		size_type const n_avail( budget_ / chunk_bytes > n_chunks_ ? budget_ / chunk_bytes - n_chunks_ : 0u );
+		size_type const n_slab( std::min( n_avail, slab_chunks ) );
+		if ( n_slab == 0u ) return false;
+		slabs_.emplace_back( new unsigned char[ n_slab * chunk_bytes ] );
+		unsigned char * const slab( slabs_.back().get() );
+		for ( size_type i = n_slab; i > 0u; --i ) { // Reverse order so chunks are checked out in address order
+			free_.push_back( slab + ( ( i - 1u ) * chunk_bytes ) );
+		}
+		n_chunks_ += n_slab;
+		return true;
+	}
+
+	// Spill Fullest Clients to Free Chunks
+	void
+	OutputPool::
+	reclaim()
+	{
+		if ( clients_.empty() ) return;
+		size_type const n_spill( std::max( clients_.size() / 8u, size_type( 1u ) ) ); // Spill a batch to amortize the selection
+		spill_ = clients_;
+		std::nth_element( spill_.begin(), spill_.begin() + ( n_spill - 1u ), spill_.end(), []( Client const * c1, Client const * c2 ){ return c1->pooled() > c2->pooled(); } );
+		for ( size_type i = 0; i < n_spill; ++i ) {
+			spill_[ i ]->spill(); // Releases client's chunks
+			++n_spills_;
+		}
+		spill_.clear();
+	}
+
+} // QSS
@@ -0,0 +1,242 @@
+// QSS Output Buffer Pool
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_OutputPool_hh_INCLUDED
+#define QSS_OutputPool_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace QSS {
+
+// QSS Output Buffer Pool
+//
+// Output buffers are checked out in small chunks as outputs produce data
+// Chunks are carved from slabs allocated on demand up to the pool budget
+// When the budget is reached the fullest clients are spilled (flushed) to free chunks
+// One pool per simulation thread so clients don't need synchronization
+class OutputPool final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Chunk = void *;
+	using Chunks = std::vector< Chunk >;
+
+	// Pool Client Interface
+	class Client
+	{
+
+		friend class OutputPool;
+
+	protected: // Creation
+
+		// Default Constructor
+		Client() = default;
+
+		// Copy Constructor
+		Client( Client const & ) = delete;
+
+		// Move Constructor: Takes Over Pool Registration
+		Client( Client && c ) noexcept :
+		 pool_( c.pool_ ),
+		 slot_( c.slot_ )
+		{
+			if ( slot_ != npos ) pool_->clients_[ slot_ ] = this;
+			c.pool_ = nullptr;
+			c.slot_ = npos;
+		}
+
+		// Copy Assignment
+		Client &
+		operator =( Client const & ) = delete;
+
+		// Move Assignment
+		Client &
+		operator =( Client && ) = delete;
+
+		// Destructor
+		~Client() = default;
+
+	public: // Property
+
+		// Pool Holding Chunks (nullptr if Unregistered)
+		OutputPool *
+		pool() const
+		{
+			return pool_;
+		}
+
+		// Number of Pooled Entries Buffered
+		virtual
+		size_type
+		pooled() const = 0;
+
+	public: // Methods
+
+		// Spill Buffered Entries and Release Chunks
+		virtual
+		void
+		spill() = 0;
+
+	private: // Data
+
+		OutputPool * pool_{ nullptr }; // Pool holding chunks
+		size_type slot_{ npos }; // Index in pool's client list
+
+	}; // Client
+
+public: // Creation
+
+	// Default Constructor
+	OutputPool() = default;
+
+	// Copy Constructor
+	OutputPool( OutputPool const & ) = delete;
+
+	// Copy Assignment
+	OutputPool &
+	operator =( OutputPool const & ) = delete;
+
+public: // Static Methods
+
+	// Thread's Pool
+	static
+	OutputPool &
+	instance();
+
+	// Budget (Bytes) per Simulation Thread
+	static
+	size_type
+	budget()
+	{
+		return budget_;
+	}
+
+	// Budget (Bytes) per Simulation Thread Set
+	static
+	void
+	budget( size_type const bytes )
+	{
+		budget_ = bytes;
+	}
+
+public: // Property
+
+	// Bytes Allocated
+	size_type
+	allocated() const
+	{
+		return n_chunks_ * chunk_bytes;
+	}
+
+	// Chunks Allocated
+	size_type
+	n_chunks() const
+	{
+		return n_chunks_;
+	}
+
+	// Chunks Checked Out
+	size_type
+	n_used() const
+	{
+		return n_chunks_ - free_.size();
+	}
+
+	// Clients Holding Chunks
+	size_type
+	n_clients() const
+	{
+		return clients_.size();
+	}
+
+	// Spills Forced by Budget
+	size_type
+	n_spills() const
+	{
+		return n_spills_;
+	}
+
+public: // Methods
+
+	// Check Out a Chunk for a Client
+	Chunk
+	acquire( Client & client );
+
+	// Release a Client's Chunks
+	void
+	release(
+	 Client & client,
+	 Chunks & chunks
+	);
+
+private: // Methods
+
+	// Allocate a Slab of Chunks within Budget: Returns Whether Any Chunks were Added
+	bool
+	allocate();
+
+	// Spill Fullest Clients to Free Chunks
+	void
+	reclaim();
+
+public: // Static Data
+
+	static constexpr size_type chunk_bytes{ 4096u }; // Chunk size (bytes)
+	static constexpr size_type slab_chunks{ 64u }; // Chunks per slab
+
+private: // Static Data
+
+	static constexpr size_type npos{ static_cast< size_type >( -1 ) }; // Unregistered client slot
+	static size_type budget_; // Budget per simulation thread (bytes)
+
+private: // Data
+
+	std::vector< std::unique_ptr< unsigned char[] > > slabs_; // Slab memory
+	Chunks free_; // Free chunks
+	std::vector< Client * > clients_; // Clients holding chunks
+	std::vector< Client * > spill_; // Spill candidates scratch
+	size_type n_chunks_{ 0u }; // Chunks allocated
+	size_type n_spills_{ 0u }; // Client spills forced by budget
+
+}; // OutputPool
+
+} // QSS
+
+#endif
@@ -0,0 +1,279 @@
+// QSS Trigger Plan LRU Cache
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_PlanCache_hh_INCLUDED
+#define QSS_PlanCache_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <type_traits>
+#include <unordered_map>
+
+namespace QSS {
+
+// Binned/Simultaneous Triggers Plan: Triggers and Their Observers Set Up
+template< typename T, typename O >
+struct TriggersPlan final
+{
+
+	using Variables = typename T::Variables;
+
+	// Constructor
+	template< typename A >
+	explicit
+	TriggersPlan( A * a ) :
+	 triggers( a ),
+	 observers( a )
+	{}
+
+	// Assign a Triggers Collection
+	void
+	assign( Variables const & trigs )
+	{
+		triggers.assign( trigs );
+		observers.assign( trigs );
+	}
+
+	T triggers; // Triggers
+	O observers; // Observers
+
+}; // TriggersPlan
+
+// Trigger Plan LRU Cache
+//
+// Plans for binned/simultaneous trigger sets are keyed by a hash of the sorted trigger set
+// so revisited sets skip the observer and observee set up work
+// Plan type P must be constructible from an A pointer and provide assign( Variables const & triggers )
+template< typename P, typename A >
+class PlanCache final
+{
+
+public: // Types
+
+	using Plan = P;
+	using Variables = typename Plan::Variables;
+	using Variable = typename std::remove_pointer< typename Variables::value_type >::type;
+	using size_type = std::size_t;
+	using Key = std::uint64_t;
+
+private: // Types
+
+	// Cache Entry
+	struct Entry final
+	{
+
+		explicit
+		Entry( A * a ) :
+		 plan( a )
+		{}
+
+		Key key{ 0u }; // Trigger set hash
+		Variables set; // Sorted trigger set
+		Variables triggers; // Triggers in plan order
+		Plan plan; // Plan
+		std::uint64_t used{ 0u }; // Last use stamp
+
+	}; // Entry
+
+	using Index = std::unordered_map< Key, size_type >;
+
+public: // Creation
+
+	// Constructor
+	PlanCache(
+	 A * a,
+	 size_type const capacity
+	) :
+	 a_( a ),
+	 capacity_( capacity )
+	{}
+
+	// Copy Constructor
+	PlanCache( PlanCache const & ) = delete;
+
+	// Move Constructor
+	PlanCache( PlanCache && ) = delete;
+
+public: // Assignment
+
+	// Copy Assignment
+	PlanCache &
+	operator =( PlanCache const & ) = delete;
+
+	// Move Assignment
+	PlanCache &
+	operator =( PlanCache && ) = delete;
+
+public: // Predicate
+
+	// Caching On?
+	bool
+	on() const
+	{
+		return capacity_ > 0u;
+	}
+
+public: // Property
+
+	// Capacity
+	size_type
+	capacity() const
+	{
+		return capacity_;
+	}
+
+	// Size
+	size_type
+	size() const
+	{
+		return on() ? entries_.size() : 0u;
+	}
+
+	// Hits
+	size_type
+	n_hits() const
+	{
+		return n_hits_;
+	}
+
+	// Misses
+	size_type
+	n_misses() const
+	{
+		return n_misses_;
+	}
+
+public: // Methods
+
+	// Plan for a Triggers Collection
+	//  Hit: Triggers are reordered to the order the plan was built with
+	//  Miss: A new or the least recently used plan is assigned the triggers
+	Plan &
+	operator ()( Variables & triggers )
+	{
+		if ( !on() ) { // Single plan rebuilt on every call
+			if ( entries_.empty() ) entries_.emplace_back( a_ );
+			Plan & plan( entries_.front().plan );
+			plan.assign( triggers );
+			++n_misses_;
+			return plan;
+		}
+
+		// Lookup
+		set_.assign( triggers.begin(), triggers.end() );
+		std::sort( set_.begin(), set_.end() );
+		Key const key( hash( set_ ) );
+		++clock_;
+		typename Index::iterator const i( index_.find( key ) );
+		if ( i != index_.end() ) {
+			Entry & entry( entries_[ i->second ] );
+			if ( entry.set == set_ ) { // Hit
+				entry.used = clock_;
+				triggers.assign( entry.triggers.begin(), entry.triggers.end() );
+				++n_hits_;
+				return entry.plan;
+			}
+		}
+
+		// Miss: Use the colliding entry, a new entry, or the least recently used entry
+		size_type k( 0u );
+		if ( i != index_.end() ) { // Hash collision
+			k = i->second;
+		} else if ( entries_.size() < capacity_ ) { // Room for a new entry
+			k = entries_.size();
+			entries_.emplace_back( a_ );
+		} else { // Evict least recently used entry
+			for ( size_type j = 1u, e = entries_.size(); j < e; ++j ) {
+				if ( entries_[ j ].used < entries_[ k ].used ) k = j;
+			}
+			index_.erase( entries_[ k ].key );
+		}
+		Entry & entry( entries_[ k ] );
+		entry.key = key;
+		entry.set.swap( set_ );
+		entry.triggers.assign( triggers.begin(), triggers.end() );
+		entry.used = clock_;
+		index_[ key ] = k;
+		entry.plan.assign( entry.triggers );
+		++n_misses_;
+		return entry.plan;
+	}
+
+	// Clear
+	void
+	clear()
+	{
+		entries_.clear();
+		index_.clear();
+		clock_ = 0u;
+		n_hits_ = n_misses_ = 0u;
+	}
+
+private: // Static Methods
+
+	// Trigger Set Hash
+	static
+	Key
+	hash( Variables const & set )
+	{
+		Key h( 14695981039346656037ull ); // FNV-1a offset basis
+		for ( Variable const * var : set ) {
+			h ^= static_cast< Key >( reinterpret_cast< std::uintptr_t >( var ) );
+			h *= 1099511628211ull; // FNV-1a prime
+		}
+		return h;
+	}
+
+private: // Data
+
+	A * a_{ nullptr }; // Plan constructor argument
+	size_type capacity_{ 0u }; // Max plans
+	std::deque< Entry > entries_; // Plans: Deque keeps plan references stable
+	Index index_; // Key to entry index
+	Variables set_; // Sorted trigger set work array
+	std::uint64_t clock_{ 0u }; // Use stamp clock
+	size_type n_hits_{ 0u }; // Hits
+	size_type n_misses_{ 0u }; // Misses
+
+}; // PlanCache
+
+} // QSS
+
+#endif
@@ -0,0 +1,545 @@
+// Pooled Arrays in a Model-Level Store
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_Pooled_hh_INCLUDED
+#define QSS_Pooled_hh_INCLUDED
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace QSS {
+
+// Model-Level Pool of Contiguous Array Segments
+//
+// Segments are carved from blocks in the order taken so arrays pooled in model order are streamed together
+// Blocks are never reallocated so segment pointers remain valid until the pool is cleared
+template< typename T >
+class Pool final
+{
+
+	static_assert( std::is_trivially_copyable_v< T >, "Pool element type must be trivially copyable" );
+
+public: // Types
+
+	using value_type = T;
+	using size_type = std::size_t;
+
+	static constexpr size_type block_min{ 4096u }; // Minimum block size (elements)
+
+public: // Creation
+
+	// Default Constructor
+	Pool() = default;
+
+	// Copy Constructor
+	Pool( Pool const & ) = delete;
+
+	// Move Constructor
+	Pool( Pool && ) noexcept = default;
+
+public: // Assignment
+
+	// Copy Assignment
+	Pool &
+	operator =( Pool const & ) = delete;
+
+	// Move Assignment
+	Pool &
+	operator =( Pool && ) noexcept = default;
+
+public: // Property
+
+	// Size (Elements Taken)
+	size_type
+	size() const
+	{
+		return size_;
+	}
+
+	// Capacity (Elements Allocated)
+	size_type
+	capacity() const
+	{
+		return capacity_;
+	}
+
+	// Bytes Allocated
+	size_type
+	bytes() const
+	{
+		return capacity_ * sizeof( T );
+	}
+
+	// Blocks
+	size_type
+	blocks() const
+	{
+		return blocks_.size();
+	}
+
+public: // Methods
+
+	// Reserve a Block for the Next n Elements
+	void
+	reserve( size_type const n )
+	{
+		if ( n > avail_ ) new_block( n );
+	}
+
+	// Take a Segment of n Elements
+	T *
+	take( size_type const n )
+	{
+		if ( n == 0u ) return nullptr;
+		if ( n > avail_ ) new_block( std::max( n, block_min ) );
+		assert( n <= avail_ );
+		T * const p( next_ );
+		next_ += n;
+		avail_ -= n;
+		size_ += n;
+		return p;
+	}
+
+	// Clear
+	void
+	clear()
+	{
+		blocks_.clear();
+		next_ = nullptr;
+		avail_ = size_ = capacity_ = 0u;
+	}
+
+private: // Methods
+
+	// Start a New Block of n Elements
+	void
+	new_block( size_type const n )
+	{
+		blocks_.emplace_back( new T[ n ] );
+		next_ = blocks_.back().get();
+		avail_ = n;
+		capacity_ += n;
+	}
+
+private: // Data
+
+	std::vector< std::unique_ptr< T[] > > blocks_; // Blocks
+	T * next_{ nullptr }; // Next free element in the current block
+	size_type avail_{ 0u }; // Free elements in the current block
+	size_type size_{ 0u }; // Elements taken
+	size_type capacity_{ 0u }; // Elements allocated
+
+}; // Pool
+
+// Vector-Like Array That Can Be Built In or Relocated Into a Pool
+//
+// Owns a heap buffer while it is being built and after any growth unless a pool segment is reserved for it up front
+// Once pooled it is a non-owning offset + length segment of the pool: In-place element changes stay in the pool
+template< typename T >
+class Pooled final
+{
+
+	static_assert( std::is_trivially_copyable_v< T >, "Pooled element type must be trivially copyable" );
+
+public: // Types
+
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T &;
+	using const_reference = T const &;
+	using pointer = T *;
+	using const_pointer = T const *;
+	using iterator = T *;
+	using const_iterator = T const *;
+
+private: // Types
+
+	using Index = std::uint32_t;
+
+	static constexpr Index pooled_bit{ Index( 1u ) << 31 }; // Capacity flag for a pooled (non-owning) segment
+
+public: // Creation
+
+	// Default Constructor
+	Pooled() = default;
+
+	// Copy Constructor
+	Pooled( Pooled const & a )
+	{
+		assign( a.begin(), a.end() );
+	}
+
+	// Move Constructor
+	Pooled( Pooled && a ) noexcept :
+	 data_( a.data_ ),
+	 size_( a.size_ ),
+	 capacity_( a.capacity_ )
+	{
+		a.data_ = nullptr;
+		a.size_ = a.capacity_ = 0u;
+	}
+
+	// Vector Constructor
+	explicit
+	Pooled( std::vector< T > const & v )
+	{
+		assign( v.begin(), v.end() );
+	}
+
+	// Destructor
+	~Pooled()
+	{
+		release();
+	}
+
+public: // Assignment
+
+	// Copy Assignment
+	Pooled &
+	operator =( Pooled const & a )
+	{
+		if ( this != &a ) assign( a.begin(), a.end() );
+		return *this;
+	}
+
+	// Move Assignment
+	Pooled &
+	operator =( Pooled && a ) noexcept
+	{
+		if ( this != &a ) {
+			release();
+			data_ = a.data_;
+			size_ = a.size_;
+			capacity_ = a.capacity_;
+			a.data_ = nullptr;
+			a.size_ = a.capacity_ = 0u;
+		}
+		return *this;
+	}
+
+	// Vector Assignment
+	Pooled &
+	operator =( std::vector< T > const & v )
+	{
+		assign( v.begin(), v.end() );
+		return *this;
+	}
+
+public: // Predicate
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return size_ == 0u;
+	}
+
+	// Pooled?
+	bool
+	pooled() const
+	{
+		return ( capacity_ & pooled_bit ) != 0u;
+	}
+
+public: // Property
+
+	// Size
+	size_type
+	size() const
+	{
+		return size_;
+	}
+
+	// Capacity
+	size_type
+	capacity() const
+	{
+		return capacity_ & ~pooled_bit;
+	}
+
+	// Data
+	T const *
+	data() const
+	{
+		return data_;
+	}
+
+	// Data
+	T *
+	data()
+	{
+		return data_;
+	}
+
+	// Front
+	T const &
+	front() const
+	{
+		assert( size_ > 0u );
+		return data_[ 0 ];
+	}
+
+	// Front
+	T &
+	front()
+	{
+		assert( size_ > 0u );
+		return data_[ 0 ];
+	}
+
+	// Back
+	T const &
+	back() const
+	{
+		assert( size_ > 0u );
+		return data_[ size_ - 1u ];
+	}
+
+	// Back
+	T &
+	back()
+	{
+		assert( size_ > 0u );
+		return data_[ size_ - 1u ];
+	}
+
+public: // Subscript
+
+	// Pooled[ i ]
+	T const &
+	operator []( size_type const i ) const
+	{
+		assert( i < size_ );
+		return data_[ i ];
+	}
+
+	// Pooled[ i ]
+	T &
+	operator []( size_type const i )
+	{
+		assert( i < size_ );
+		return data_[ i ];
+	}
+
+public: // Iterator
+
+	// Begin Iterator
+	const_iterator
+	begin() const
+	{
+		return data_;
+	}
+
+	// Begin Iterator
+	iterator
+	begin()
+	{
+		return data_;
+	}
+
+	// End Iterator
+	const_iterator
+	end() const
+	{
+		return data_ + size_;
+	}
+
+	// End Iterator
+	iterator
+	end()
+	{
+		return data_ + size_;
+	}
+
+public: // Methods
+
+	// Clear: Keeps an owned buffer and drops a pooled segment
+	void
+	clear()
+	{
+		if ( pooled() ) {
+			data_ = nullptr;
+			capacity_ = 0u;
+		}
+		size_ = 0u;
+	}
+
+	// Reserve
+	void
+	reserve( size_type const n )
+	{
+		if ( n > capacity() ) reallocate( n );
+	}
+
+	// Reserve a Pool Segment of Capacity n: Elements Are Dropped
+	void
+	reserve( Pool< T > & pool, size_type const n )
+	{
+		release();
+		if ( n == 0u ) return;
+		assert( n < pooled_bit );
+		data_ = pool.take( n );
+		capacity_ = Index( n ) | pooled_bit;
+	}
+
+	// Resize
+	void
+	resize( size_type const n, T const & t = T() )
+	{
+		if ( n > capacity() ) reallocate( n );
+		std::fill( data_ + std::min( size_type( size_ ), n ), data_ + n, t );
+		size_ = Index( n );
+	}
+
+	// Push Back
+	void
+	push_back( T const t )
+	{
+		if ( size_ == capacity() ) reallocate( std::max( 2u * size_type( size_ ), size_type( 4u ) ) );
+		data_[ size_++ ] = t;
+	}
+
+	// Assign from an Iterator Range
+	template< typename Iterator >
+	void
+	assign( Iterator const b, Iterator const e )
+	{
+		size_type const n( static_cast< size_type >( std::distance( b, e ) ) );
+		size_ = 0u;
+		if ( n > capacity() ) reallocate( n );
+		std::copy( b, e, data_ );
+		size_ = Index( n );
+	}
+
+	// Erase an Element
+	iterator
+	erase( const_iterator const i )
+	{
+		return erase( i, i + 1 );
+	}
+
+	// Erase a Range
+	iterator
+	erase( const_iterator const b, const_iterator const e )
+	{
+		assert( ( data_ <= b ) && ( b <= e ) && ( e <= data_ + size_ ) );
+		iterator const i( data_ + ( b - data_ ) );
+		std::copy( e, const_iterator( data_ + size_ ), i );
+		size_ -= Index( e - b );
+		return i;
+	}
+
+	// Shrink Capacity to Size
+	void
+	shrink_to_fit()
+	{
+		if ( !pooled() && ( capacity_ > size_ ) ) {
+			if ( size_ == 0u ) {
+				release();
+			} else {
+				reallocate( size_ );
+			}
+		}
+	}
+
+	// Swap
+	void
+	swap( Pooled & a ) noexcept
+	{
+		std::swap( data_, a.data_ );
+		std::swap( size_, a.size_ );
+		std::swap( capacity_, a.capacity_ );
+	}
+
+	// Relocate Into a Pool Segment and Release the Owned Buffer
+	void
+	pool( Pool< T > & pool )
+	{
+		if ( pooled() ) return; // Already pooled
+		if ( size_ == 0u ) {
+			release();
+			return;
+		}
+		T * const p( pool.take( size_ ) );
+		std::copy( data_, data_ + size_, p );
+		delete[] data_;
+		data_ = p;
+		capacity_ = size_ | pooled_bit;
+	}
+
+private: // Methods
+
+	// Reallocate to an Owned Buffer of Capacity n
+	void
+	reallocate( size_type const n )
+	{
+		assert( n >= size_ );
+		assert( n < pooled_bit );
+		T * const p( new T[ n ] );
+		std::copy( data_, data_ + size_, p );
+		if ( !pooled() ) delete[] data_;
+		data_ = p;
+		capacity_ = Index( n );
+	}
+
+	// Release Owned Buffer
+	void
+	release()
+	{
+		if ( !pooled() ) delete[] data_;
+		data_ = nullptr;
+		size_ = capacity_ = 0u;
+	}
+
+private: // Data
+
+	T * data_{ nullptr }; // Elements: Owned or pooled segment
+	Index size_{ 0u }; // Size
+	Index capacity_{ 0u }; // Capacity + pooled bit
+
+}; // Pooled
+
+} // QSS
+
+#endif
@@ -36,11 +36,13 @@
 // QSS Headers
 #include <QSS/QSS_main.hh>
 #include <QSS/options.hh>
+#include <QSS/OutputPool.hh>
 #include <QSS/path.hh>
 #include <QSS/version.hh>
 #include <QSS/simulate_fmu_me.hh>
 #include <QSS/simulate_fmu_me_con.hh>
 #include <QSS/simulate_fmu_me_con_perfect.hh>
+#include <QSS/Timing.hh>
 
 // C++ Headers
 #include <algorithm>
@@ -88,6 +90,7 @@ QSS_main( std::vector< std::string > const & args )
 		std::cerr << "Error: No model name or FMU file specified" << std::endl;
 		std::exit( EXIT_FAILURE );
 	}
+	OutputPool::budget( options::outBuf * 1024u * 1024u ); // Output buffer pool budget (bytes)
 
 	// Check model names/types
 	ModelType model_type( ModelType::UNK );
@@ -141,6 +144,11 @@ QSS_main( std::vector< std::string > const & args )
 			assert( false );
 		}
 	}
+
+	// Setup timing report: Once for all models after any concurrent runs are done
+	Timing & timing( Timing::instance() );
+	timing.report();
+	timing.clear();
 }
 
 } // QSS
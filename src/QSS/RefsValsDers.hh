@@ -36,6 +36,9 @@
 #ifndef QSS_RefsValsDers_hh_INCLUDED
 #define QSS_RefsValsDers_hh_INCLUDED
 
+// QSS Headers
+#include <QSS/Pooled.hh>
+
 // C++ Headers
 #include <cassert>
 
@@ -51,11 +54,11 @@ public: // Types
 	using Variable = V;
 	using Variables = typename Variable::Variables;
 	using Ref = typename Variable::VariableRef;
-	using Refs = typename Variable::VariableRefs;
+	using Refs = Pooled< Ref >;
 	using Val = typename Variable::Real;
-	using Vals = typename Variable::Reals;
+	using Vals = Pooled< Val >;
 	using Der = typename Variable::Real;
-	using Ders = typename Variable::Reals;
+	using Ders = Pooled< Der >;
 	using size_type = typename Variables::size_type;
 
 public: // Property
@@ -92,6 +95,16 @@ public: // Methods
 		ders_p.clear(); ders_p.reserve( n );
 	}
 
+	// Clear and Reserve Pool Segments
+	void
+	clear_and_reserve( size_type const n, Pool< Ref > & ref_pool, Pool< Der > & real_pool )
+	{
+		refs.reserve( ref_pool, n );
+		vals.reserve( real_pool, n );
+		ders.reserve( real_pool, n );
+		ders_p.reserve( real_pool, n );
+	}
+
 	// Push Back
 	void
 	push_back( Ref const & ref )
@@ -40,10 +40,12 @@
 #include <QSS/path.hh>
 
 // C++ Headers
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -51,6 +53,7 @@
 #if ( __cplusplus >= 201703L ) && ( ( _MSC_VER >= 1924 ) || ( ( __GNUC__ >= 11 ) && !defined(__llvm__) ) || ( defined(__llvm__) && ( !defined(__APPLE_CC__) && ( __clang_major__ >= 14 ) ) || ( defined( __APPLE_CC__ ) && ( __clang_major__ >= 15 ) ) ) ) // C++17+
 #include <charconv>
 #include <cmath>
+#include <cstdint>
 #endif
 
 namespace QSS {
@@ -67,6 +70,9 @@ public: // Types
 	using Values = std::vector< Value >;
 	using size_type = typename Values::size_type;
 
+	static size_type constexpr block_bytes = 1u << 20; // Values block size (bytes) written at once
+	static size_type constexpr column_bytes = 24u; // Fixed-width column size (bytes) including separator
+
 public: // Creation
 
 	// Default Constructor
@@ -91,7 +97,10 @@ public: // Creation
 	// Destructor
 	~Results_CSV()
 	{
-		if ( csv_stream_.is_open() ) csv_stream_.close();
+		if ( csv_stream_.is_open() ) {
+			flush();
+			csv_stream_.close();
+		}
 	}
 
 public: // Property
@@ -109,6 +118,8 @@ public: // Methods
 	void
 	init( std::string const & nam )
 	{
+		if ( csv_stream_.is_open() ) flush();
+		n_buf_ = 0u;
 		csv_file_ = nam + ".csv";
 		csv_stream_ = std::ofstream( csv_file_, std::ios_base::binary | std::ios_base::out );
 	}
@@ -120,6 +131,8 @@ public: // Methods
 	 std::string const & nam
 	)
 	{
+		if ( csv_stream_.is_open() ) flush();
+		n_buf_ = 0u;
 		csv_file_ = dir + path::sep + nam + ".csv";
 		csv_stream_ = std::ofstream( csv_file_, std::ios_base::binary | std::ios_base::out );
 	}
@@ -129,6 +142,7 @@ public: // Methods
 	labels( Labels const & labels )
 	{
 		if ( labels.empty() ) return;
+		flush();
 		csv_stream_ << '"' << labels[ 0 ] << '"';
 		for ( size_type i = 1, n = labels.size(); i < n; ++i ) csv_stream_ << ",\"" << labels[ i ] << '"';
 		csv_stream_ << '\n';
@@ -139,22 +153,55 @@ public: // Methods
 	values( Values const & values )
 	{
 		if ( values.empty() ) return;
+		flush(); // Keep any buffered values ahead of this line
 		csv_stream_ << std::right << std::scientific << std::setprecision( 15 );
 		csv_stream_ << std::setw( 23 ) << values[ 0 ];
 		for ( size_type i = 1, n = values.size(); i < n; ++i ) csv_stream_ << ',' << std::setw( 23 ) << values[ i ];
 		csv_stream_ << '\n';
 	}
 
+	// Write Buffered Values
+	void
+	flush()
+	{
+		if ( n_buf_ > 0u ) {
+			csv_stream_.write( buf_.get(), static_cast< std::streamsize >( n_buf_ ) );
+			n_buf_ = 0u;
+		}
+	}
+
+private: // Methods
+
+	// Reserve Buffer Space for n Bytes
+	char *
+	reserve( size_type const n )
+	{
+		if ( n_buf_ + n > c_buf_ ) { // Write the block and grow if a row is larger than the buffer
+			flush();
+			if ( n > c_buf_ ) {
+				c_buf_ = std::max( n, block_bytes );
+				buf_.reset( new char[ c_buf_ ] );
+			}
+		}
+		char * const p( buf_.get() + n_buf_ );
+		n_buf_ += n;
+		return p;
+	}
+
 private: // Data
 
 	std::string csv_file_; // CSV file name
 	std::ofstream csv_stream_; // CSV file stream
+	std::unique_ptr< char[] > buf_; // Values buffer
+	size_type c_buf_{ 0u }; // Values buffer capacity (bytes)
+	size_type n_buf_{ 0u }; // Values buffer size (bytes)
 
 }; // Results_CSV
 
 #if ( __cplusplus >= 201703L ) && ( ( _MSC_VER >= 1924 ) || ( ( __GNUC__ >= 11 ) && !defined(__llvm__) ) || ( defined(__llvm__) && ( !defined(__APPLE_CC__) && ( __clang_major__ >= 14 ) ) || ( defined( __APPLE_CC__ ) && ( __clang_major__ >= 15 ) ) ) ) // C++17+
 
 	// Write Values Line: double Specialization
+	//  Columns are fixed-width so they are formatted independently (in parallel for wide rows) into the block buffer
 	template<>
 	inline
 	void
@@ -162,21 +209,22 @@ private: // Data
 	values( Values const & values )
 	{
 		if ( values.empty() ) return;
-		std::string v_string( 23u, ' ' );
-		char * const v0( v_string.data() );
-		char * const ve( v0 + 23u );
-		for ( size_type i = 0, n = values.size(); i < n; ++i ) {
-			v_string[ 0 ] = v_string[ 1 ] = ' ';
+		std::int64_t const n( values.size() );
+		char * const row( reserve( n * column_bytes ) );
+		#pragma omp parallel for schedule(static) if ( n >= 4096 )
+		for ( std::int64_t i = 0; i < n; ++i ) {
+			char * const v0( row + ( i * column_bytes ) );
+			char * const ve( v0 + ( column_bytes - 1u ) );
+			v0[ 0 ] = v0[ 1 ] = ' ';
 			double const v( values[ i ] );
-			std::string::size_type const off( ( std::signbit( v ) ? 0u : 1u ) + ( ( v != 0.0 ) && ( ( std::abs( v ) >= 1.0e100 ) || ( std::abs( v ) < 1.0e-99 ) ) ? 0u : 1u ) );
+			std::size_t const off( ( std::signbit( v ) ? 0u : 1u ) + ( ( v != 0.0 ) && ( ( std::abs( v ) >= 1.0e100 ) || ( std::abs( v ) < 1.0e-99 ) ) ? 0u : 1u ) );
 			std::to_chars_result const v_res( std::to_chars( v0 + off, ve, v, std::chars_format::scientific, 15 ) );
 			assert( v_res.ec == std::errc{} );
 			char * vp( v_res.ptr );
 			while ( vp < ve ) *(vp++) = ' ';
-			if ( i > 0u ) csv_stream_ << ',';
-			csv_stream_ << v_string;
+			*ve = ( i + 1 < n ? ',' : '\n' );
 		}
-		csv_stream_ << '\n';
+		if ( n_buf_ >= block_bytes ) flush();
 	}
 
 #endif
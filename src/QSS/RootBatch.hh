@@ -0,0 +1,387 @@
+// QSS Batched Root Solvers
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_RootBatch_hh_INCLUDED
+#define QSS_RootBatch_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/math.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+namespace QSS {
+
+// Batched root solvers for observer fan-out: Branch-free lane kernels compute every case and select the result,
+// giving the same results as the scalar math.hh solvers they mirror, with an AVX kernel processing 4 lanes at a time
+
+// Min Nonnegative Root of Both Boundary Quadratic Equations a x^2 + b x + c: Branch-Free Lane
+template< typename T, class = typename std::enable_if< std::is_floating_point< T >::value >::type >
+inline
+T
+min_root_quadratic_both_lane( T const a, T const b, T const cl, T const cu )
+{
+	T const infinity( inf< T >() );
+	T const a_s( a == T( 0 ) ? T( 1 ) : a ); // Safe divisors: Every operation is computed for every case so the selects vectorize
+	T const b_s( b == T( 0 ) ? T( 1 ) : b );
+	T const bb( b * b );
+	T const a4( T( 4 ) * a );
+	T const sb( b < T( 0 ) ? T( -1 ) : T( +1 ) );
+
+	// Linear
+	T const cl_b( -( cl / b_s ) );
+	T const cu_b( -( cu / b_s ) );
+	T const root_linear( b == T( 0 ) ? infinity : ( b < T( 0 ) ? cl_b : cu_b ) );
+
+	// Critical point at x=0
+	T const cl_a( -( cl / a_s ) );
+	T const cu_a( -( cu / a_s ) );
+	T const root_critical( std::sqrt( std::max( a < T( 0 ) ? cl_a : cu_a, T( 0 ) ) ) );
+
+	// General case: Double root
+	T const r2( -b / ( T( 2 ) * a_s ) );
+	T const root_double( r2 > T( 0 ) ? r2 : infinity );
+
+	// General case: Lower boundary
+	T const discl( bb - ( a4 * cl ) );
+	T const ql( -T( 0.5 ) * ( b + ( sb * std::sqrt( std::max( discl, T( 0 ) ) ) ) ) );
+	T const ql_a( ql / a_s );
+	T const cl_q( cl / ( ql == T( 0 ) ? T( 1 ) : ql ) );
+	T const rootl( discl < T( 0 ) ? infinity : ( discl == T( 0 ) ? root_double : ( ( T( 2 ) * ql ) + b <= T( 0 ) ? ql_a : cl_q ) ) );
+
+	// General case: Upper boundary
+	T const discu( bb - ( a4 * cu ) );
+	T const qu( -T( 0.5 ) * ( b + ( sb * std::sqrt( std::max( discu, T( 0 ) ) ) ) ) );
+	T const qu_a( qu / a_s );
+	T const cu_q( cu / ( qu == T( 0 ) ? T( 1 ) : qu ) );
+	T const rootu( discu < T( 0 ) ? infinity : ( discu == T( 0 ) ? root_double : ( ( T( 2 ) * qu ) + b >= T( 0 ) ? qu_a : cu_q ) ) );
+
+	// General case: Select root
+	T const root_min( rootl >= T( 0 ) ? ( rootu >= T( 0 ) ? std::min( rootl, rootu ) : rootl ) : ( rootu >= T( 0 ) ? rootu : T( 0 ) ) ); // min_nonnegative_or_zero
+	T const root_general( ( rootl == infinity ) && ( rootu == infinity ) ? T( 0 ) : root_min );
+
+	return ( ( cl <= T( 0 ) ) || ( cu >= T( 0 ) ) ? T( 0 ) : ( a == T( 0 ) ? root_linear : ( b == T( 0 ) ? root_critical : root_general ) ) );
+}
+
+// Min Nonnegative Root of Quadratic Requantization Boundaries a x^2 + b x + c: Branch-Free Lane
+// Upper boundary only if a,b >= 0, lower boundary only if a,b <= 0, and both boundaries otherwise
+template< typename T, class = typename std::enable_if< std::is_floating_point< T >::value >::type >
+inline
+T
+min_root_quadratic_bounds_lane( T const a, T const b, T const cl, T const cu )
+{
+	bool const upper( ( b >= T( 0 ) ) && ( a >= T( 0 ) ) );
+	bool const lower( ( b <= T( 0 ) ) && ( a <= T( 0 ) ) );
+
+	// Single boundary: Upper or lower
+	T const c( upper ? cu : cl );
+	T const s( upper ? T( +1 ) : T( -1 ) );
+	T const a_s( a == T( 0 ) ? T( 1 ) : a ); // Safe divisors
+	T const b_s( b == T( 0 ) ? T( 1 ) : b );
+	T const disc( ( b * b ) - ( T( 4 ) * a * c ) );
+	T const q( -T( 0.5 ) * ( b + ( s * std::sqrt( std::max( disc, T( 0 ) ) ) ) ) );
+	T const c_b( -( c / b_s ) );
+	T const c_a( std::sqrt( std::max( -( c / a_s ), T( 0 ) ) ) );
+	T const c_q( c / ( q == T( 0 ) ? T( 1 ) : q ) );
+	T const root_single(
+	 ( s * c >= T( 0 ) ) ? T( 0 ) : // Precision loss
+	 ( a == T( 0 ) ) ? ( b == T( 0 ) ? inf< T >() : c_b ) : // Linear
+	 ( b == T( 0 ) ) ? c_a : // Critical point at x=0
+	 ( disc <= T( 0 ) ) ? T( 0 ) : // Zero or one real root(s) => Precision loss
+	 c_q // Two real roots
+	);
+
+	T const root_both( min_root_quadratic_both_lane( a, b, cl, cu ) );
+	return ( upper || lower ? root_single : root_both );
+}
+
+#if defined(__AVX__)
+namespace simd {
+
+// AVX Select: m ? x : y
+inline
+__m256d
+sel( __m256d const m, __m256d const x, __m256d const y )
+{
+	return _mm256_blendv_pd( y, x, m );
+}
+
+// AVX Comparisons: Ordered as for C++ double comparisons
+inline __m256d eq( __m256d const x, __m256d const y ) { return _mm256_cmp_pd( x, y, _CMP_EQ_OQ ); }
+inline __m256d lt( __m256d const x, __m256d const y ) { return _mm256_cmp_pd( x, y, _CMP_LT_OQ ); }
+inline __m256d le( __m256d const x, __m256d const y ) { return _mm256_cmp_pd( x, y, _CMP_LE_OQ ); }
+inline __m256d gt( __m256d const x, __m256d const y ) { return _mm256_cmp_pd( x, y, _CMP_GT_OQ ); }
+inline __m256d ge( __m256d const x, __m256d const y ) { return _mm256_cmp_pd( x, y, _CMP_GE_OQ ); }
+
+// AVX Negation: Sign Flip as for C++ Unary Minus
+inline
+__m256d
+neg( __m256d const x )
+{
+	return _mm256_xor_pd( x, _mm256_set1_pd( -0.0 ) );
+}
+
+// AVX std::max( x, 0 )
+inline
+__m256d
+max0( __m256d const x )
+{
+	__m256d const zero( _mm256_setzero_pd() );
+	return sel( lt( x, zero ), zero, x );
+}
+
+// Min Nonnegative Root of Both Boundary Quadratic Equations: AVX Lanes
+inline
+__m256d
+min_root_quadratic_both( __m256d const a, __m256d const b, __m256d const cl, __m256d const cu )
+{
+	__m256d const zero( _mm256_setzero_pd() );
+	__m256d const one( _mm256_set1_pd( 1.0 ) );
+	__m256d const two( _mm256_set1_pd( 2.0 ) );
+	__m256d const infinity( _mm256_set1_pd( inf< double >() ) );
+	__m256d const m_half( _mm256_set1_pd( -0.5 ) );
+	__m256d const a_zero( eq( a, zero ) );
+	__m256d const b_zero( eq( b, zero ) );
+	__m256d const b_neg( lt( b, zero ) );
+	__m256d const a_s( sel( a_zero, one, a ) );
+	__m256d const b_s( sel( b_zero, one, b ) );
+	__m256d const bb( _mm256_mul_pd( b, b ) );
+	__m256d const a4( _mm256_mul_pd( _mm256_set1_pd( 4.0 ), a ) );
+	__m256d const sb( sel( b_neg, _mm256_set1_pd( -1.0 ), one ) );
+
+	// Linear
+	__m256d const root_linear( sel( b_zero, infinity, sel( b_neg, neg( _mm256_div_pd( cl, b_s ) ), neg( _mm256_div_pd( cu, b_s ) ) ) ) );
+
+	// Critical point at x=0
+	__m256d const root_critical( _mm256_sqrt_pd( max0( sel( lt( a, zero ), neg( _mm256_div_pd( cl, a_s ) ), neg( _mm256_div_pd( cu, a_s ) ) ) ) ) );
+
+	// General case: Double root
+	__m256d const r2( _mm256_div_pd( neg( b ), _mm256_mul_pd( two, a_s ) ) );
+	__m256d const root_double( sel( gt( r2, zero ), r2, infinity ) );
+
+	// General case: Lower boundary
+	__m256d const discl( _mm256_sub_pd( bb, _mm256_mul_pd( a4, cl ) ) );
+	__m256d const ql( _mm256_mul_pd( m_half, _mm256_add_pd( b, _mm256_mul_pd( sb, _mm256_sqrt_pd( max0( discl ) ) ) ) ) );
+	__m256d const rootl_2( sel( le( _mm256_add_pd( _mm256_mul_pd( two, ql ), b ), zero ), _mm256_div_pd( ql, a_s ), _mm256_div_pd( cl, sel( eq( ql, zero ), one, ql ) ) ) );
+	__m256d const rootl( sel( lt( discl, zero ), infinity, sel( eq( discl, zero ), root_double, rootl_2 ) ) );
+
+	// General case: Upper boundary
+	__m256d const discu( _mm256_sub_pd( bb, _mm256_mul_pd( a4, cu ) ) );
+	__m256d const qu( _mm256_mul_pd( m_half, _mm256_add_pd( b, _mm256_mul_pd( sb, _mm256_sqrt_pd( max0( discu ) ) ) ) ) );
+	__m256d const rootu_2( sel( ge( _mm256_add_pd( _mm256_mul_pd( two, qu ), b ), zero ), _mm256_div_pd( qu, a_s ), _mm256_div_pd( cu, sel( eq( qu, zero ), one, qu ) ) ) );
+	__m256d const rootu( sel( lt( discu, zero ), infinity, sel( eq( discu, zero ), root_double, rootu_2 ) ) );
+
+	// General case: Select root
+	__m256d const l_nn( ge( rootl, zero ) );
+	__m256d const u_nn( ge( rootu, zero ) );
+	__m256d const root_lu( sel( lt( rootu, rootl ), rootu, rootl ) ); // std::min( rootl, rootu )
+	__m256d const root_min( sel( l_nn, sel( u_nn, root_lu, rootl ), sel( u_nn, rootu, zero ) ) );
+	__m256d const root_general( sel( _mm256_and_pd( eq( rootl, infinity ), eq( rootu, infinity ) ), zero, root_min ) );
+
+	__m256d const loss( _mm256_or_pd( le( cl, zero ), ge( cu, zero ) ) );
+	return sel( loss, zero, sel( a_zero, root_linear, sel( b_zero, root_critical, root_general ) ) );
+}
+
+// Min Nonnegative Root of Quadratic Requantization Boundaries: AVX Lanes
+inline
+__m256d
+min_root_quadratic_bounds( __m256d const a, __m256d const b, __m256d const cl, __m256d const cu )
+{
+	__m256d const zero( _mm256_setzero_pd() );
+	__m256d const one( _mm256_set1_pd( 1.0 ) );
+	__m256d const a_zero( eq( a, zero ) );
+	__m256d const b_zero( eq( b, zero ) );
+	__m256d const upper( _mm256_and_pd( ge( b, zero ), ge( a, zero ) ) );
+	__m256d const lower( _mm256_and_pd( le( b, zero ), le( a, zero ) ) );
+
+	// Single boundary: Upper or lower
+	__m256d const c( sel( upper, cu, cl ) );
+	__m256d const s( sel( upper, one, _mm256_set1_pd( -1.0 ) ) );
+	__m256d const a_s( sel( a_zero, one, a ) );
+	__m256d const b_s( sel( b_zero, one, b ) );
+	__m256d const disc( _mm256_sub_pd( _mm256_mul_pd( b, b ), _mm256_mul_pd( _mm256_mul_pd( _mm256_set1_pd( 4.0 ), a ), c ) ) );
+	__m256d const q( _mm256_mul_pd( _mm256_set1_pd( -0.5 ), _mm256_add_pd( b, _mm256_mul_pd( s, _mm256_sqrt_pd( max0( disc ) ) ) ) ) );
+	__m256d const c_b( neg( _mm256_div_pd( c, b_s ) ) );
+	__m256d const c_a( _mm256_sqrt_pd( max0( neg( _mm256_div_pd( c, a_s ) ) ) ) );
+	__m256d const c_q( _mm256_div_pd( c, sel( eq( q, zero ), one, q ) ) );
+	__m256d const root_single(
+	 sel( ge( _mm256_mul_pd( s, c ), zero ), zero,
+	 sel( a_zero, sel( b_zero, _mm256_set1_pd( inf< double >() ), c_b ),
+	 sel( b_zero, c_a,
+	 sel( le( disc, zero ), zero, c_q ) ) ) )
+	);
+
+	return sel( _mm256_or_pd( upper, lower ), root_single, min_root_quadratic_both( a, b, cl, cu ) );
+}
+
+} // simd
+#endif
+
+// Min Nonnegative Roots of Both Boundary Quadratic Equations a x^2 + b x + c: Batched
+inline
+void
+min_root_quadratic_both(
+ std::size_t const n,
+ double const * const a,
+ double const * const b,
+ double const * const cl,
+ double const * const cu,
+ double * const root
+)
+{
+	std::size_t i( 0u );
+#if defined(__AVX__)
+	for ( std::size_t const e( n & ~std::size_t( 3u ) ); i < e; i += 4u ) {
+		_mm256_storeu_pd( root + i, simd::min_root_quadratic_both( _mm256_loadu_pd( a + i ), _mm256_loadu_pd( b + i ), _mm256_loadu_pd( cl + i ), _mm256_loadu_pd( cu + i ) ) );
+	}
+#endif
+	for ( ; i < n; ++i ) { // Remainder (or portable fallback)
+		root[ i ] = min_root_quadratic_both_lane( a[ i ], b[ i ], cl[ i ], cu[ i ] );
+	}
+}
+
+// Min Nonnegative Roots of Quadratic Requantization Boundaries a x^2 + b x + c: Batched
+inline
+void
+min_root_quadratic_bounds(
+ std::size_t const n,
+ double const * const a,
+ double const * const b,
+ double const * const cl,
+ double const * const cu,
+ double * const root
+)
+{
+	std::size_t i( 0u );
+#if defined(__AVX__)
+	for ( std::size_t const e( n & ~std::size_t( 3u ) ); i < e; i += 4u ) {
+		_mm256_storeu_pd( root + i, simd::min_root_quadratic_bounds( _mm256_loadu_pd( a + i ), _mm256_loadu_pd( b + i ), _mm256_loadu_pd( cl + i ), _mm256_loadu_pd( cu + i ) ) );
+	}
+#endif
+	for ( ; i < n; ++i ) { // Remainder (or portable fallback)
+		root[ i ] = min_root_quadratic_bounds_lane( a[ i ], b[ i ], cl[ i ], cu[ i ] );
+	}
+}
+
+// Batch of Quadratic Requantization Boundary Root Problems
+class RootBatch final
+{
+
+public: // Types
+
+	using Real = double;
+	using Reals = std::vector< Real >;
+	using size_type = Reals::size_type;
+
+public: // Predicate
+
+	// Empty?
+	bool
+	empty() const
+	{
+		return a_.empty();
+	}
+
+public: // Property
+
+	// Size
+	size_type
+	size() const
+	{
+		return a_.size();
+	}
+
+public: // Subscript
+
+	// Root i
+	Real
+	operator []( size_type const i ) const
+	{
+		assert( i < root_.size() );
+		return root_[ i ];
+	}
+
+public: // Methods
+
+	// Add a Problem: Quadratic a x^2 + b x + c with Lower Boundary c = cl and Upper Boundary c = cu
+	void
+	add( Real const a, Real const b, Real const cl, Real const cu )
+	{
+		a_.push_back( a );
+		b_.push_back( b );
+		cl_.push_back( cl );
+		cu_.push_back( cu );
+	}
+
+	// Solve for the Min Nonnegative Roots
+	void
+	solve()
+	{
+		root_.resize( a_.size() ); // Grow-only capacity after warm-up
+		min_root_quadratic_bounds( a_.size(), a_.data(), b_.data(), cl_.data(), cu_.data(), root_.data() );
+	}
+
+	// Clear: Retains Capacity
+	void
+	clear()
+	{
+		a_.clear();
+		b_.clear();
+		cl_.clear();
+		cu_.clear();
+		root_.clear();
+	}
+
+private: // Data
+
+	Reals a_; // Quadratic coefficients
+	Reals b_; // Linear coefficients
+	Reals cl_; // Lower boundary constant coefficients
+	Reals cu_; // Upper boundary constant coefficients
+	Reals root_; // Min nonnegative roots
+
+}; // RootBatch
+
+} // QSS
+
+#endif
@@ -0,0 +1,149 @@
+// QSS Shared-Memory Ring Buffer Output Sink
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// QSS Headers
+#include <QSS/ShmRing.hh>
+
+// C++ Headers
+#include <cstring>
+#include <iostream>
+#include <new>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace QSS {
+
+	// Name + Capacity + Variables Constructor
+	ShmRing::
+	ShmRing(
+	 std::string const & name,
+	 size_type const capacity,
+	 Vars const & vars
+	) :
+	 name_( name )
+	{
+		// Capacity: Power of 2
+		capacity_ = 1u;
+		while ( capacity_ < capacity ) capacity_ <<= 1;
+		mask_ = capacity_ - 1u;
+
+		// Layout
+		size_type vars_bytes( 0u );
+		for ( auto const & var : vars ) vars_bytes += sizeof( Id ) + sizeof( std::uint32_t ) + var.second.length();
+		size_type const vars_offset( sizeof( Header ) );
+		size_type const records_offset( ( ( vars_offset + vars_bytes + alignof( Record ) - 1u ) / alignof( Record ) ) * alignof( Record ) );
+		bytes_ = records_offset + ( capacity_ * sizeof( Record ) );
+
+#ifndef _WIN32
+		::shm_unlink( name_.c_str() ); // Remove stale object from an earlier run
+		int const fd( ::shm_open( name_.c_str(), O_CREAT | O_RDWR | O_EXCL, 0644 ) );
+		if ( fd == -1 ) {
+			std::cerr << "\nError: Shared-memory object creation failed: " << name_ << std::endl;
+			return;
+		}
+		if ( ::ftruncate( fd, static_cast< off_t >( bytes_ ) ) != 0 ) {
+			std::cerr << "\nError: Shared-memory object sizing failed: " << name_ << std::endl;
+			::close( fd );
+			::shm_unlink( name_.c_str() );
+			return;
+		}
+		void * const mem( ::mmap( nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 ) );
+		::close( fd );
+		if ( mem == MAP_FAILED ) {
+			std::cerr << "\nError: Shared-memory object mapping failed: " << name_ << std::endl;
+			::shm_unlink( name_.c_str() );
+			return;
+		}
+		unsigned char * const base( static_cast< unsigned char * >( mem ) );
+
+		// Variable table
+		unsigned char * p( base + vars_offset );
+		for ( auto const & var : vars ) {
+			Id const id( var.first );
+			std::uint32_t const len( static_cast< std::uint32_t >( var.second.length() ) );
+			std::memcpy( p, &id, sizeof( Id ) );
+			p += sizeof( Id );
+			std::memcpy( p, &len, sizeof( std::uint32_t ) );
+			p += sizeof( std::uint32_t );
+			std::memcpy( p, var.second.data(), len );
+			p += len;
+		}
+
+		// Records: Mapping is zero-filled so sequences start invalid
+		records_ = ::new ( base + records_offset ) Record[ capacity_ ];
+
+		// Header: Published last
+		header_ = ::new ( base ) Header;
+		std::memcpy( header_->magic, "QSSRING", 8u );
+		header_->version = 1u;
+		header_->record_bytes = static_cast< std::uint32_t >( sizeof( Record ) );
+		header_->capacity = capacity_;
+		header_->n_vars = vars.size();
+		header_->vars_offset = vars_offset;
+		header_->records_offset = records_offset;
+		header_->head.store( 0u, std::memory_order_relaxed );
+		header_->pad = 0u;
+		header_->done.store( 0u, std::memory_order_release );
+#else
+		std::cerr << "\nError: Shared-memory output is not supported on this platform" << std::endl;
+#endif
+	}
+
+	// Destructor
+	ShmRing::
+	~ShmRing()
+	{
+#ifndef _WIN32
+		if ( header_ != nullptr ) {
+			finish();
+			::munmap( header_, bytes_ ); // Object persists until unlinked so readers can finish
+		}
+#endif
+	}
+
+	// Shared-Memory Object Name for a Model
+	std::string
+	ShmRing::
+	object_name( std::string const & model )
+	{
+		std::string name( "/QSS." );
+		for ( char const c : model ) name.push_back( c == '/' ? '_' : c );
+		return name;
+	}
+
+} // QSS
@@ -0,0 +1,222 @@
+// QSS Shared-Memory Ring Buffer Output Sink
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef QSS_ShmRing_hh_INCLUDED
+#define QSS_ShmRing_hh_INCLUDED
+
+// C++ Headers
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace QSS {
+
+// QSS Shared-Memory Ring Buffer Output Sink
+//
+// Publishes (variable id, time, value) records to a POSIX shared-memory object (/dev/shm on Linux)
+// Layout: Header | Variable table (id, name length, name) | Records ring
+// Single producer protocol is lock-free and never waits on readers:
+//  Each record carries a sequence number that is odd while being written and 2*(i+1) when record i is complete
+//  The header head count is published after each record so readers poll head and validate each record's sequence
+//  Readers that fall more than the ring capacity behind see overwritten records fail validation and skip ahead
+class ShmRing final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+	using Id = std::uint32_t;
+	using Time = double;
+	using Real = double;
+	using Vars = std::vector< std::pair< Id, std::string > >; // Variable ids and names
+
+	// Header
+	struct Header final
+	{
+		char magic[ 8 ]; // "QSSRING"
+		std::uint32_t version; // Layout version
+		std::uint32_t record_bytes; // Record size (bytes)
+		std::uint64_t capacity; // Ring capacity (records): Power of 2
+		std::uint64_t n_vars; // Number of variables in table
+		std::uint64_t vars_offset; // Variable table offset (bytes)
+		std::uint64_t records_offset; // Records ring offset (bytes)
+		std::atomic< std::uint64_t > head; // Records published
+		std::atomic< std::uint32_t > done; // Producer finished?
+		std::uint32_t pad; // Padding
+	}; // Header
+
+	// Record
+	struct Record final
+	{
+		std::atomic< std::uint64_t > seq; // Sequence: Odd while writing, 2*(i+1) when record i is complete
+		Id id; // Variable id
+		std::uint32_t kind; // Record kind
+		Time t; // Time
+		Real v; // Value
+	}; // Record
+
+	static_assert( std::atomic< std::uint64_t >::is_always_lock_free, "Shared-memory ring needs lock-free 64-bit atomics" );
+
+	// Record Kind
+	enum class Kind : std::uint32_t { x = 0u, q = 1u }; // Continuous or quantized value
+
+public: // Creation
+
+	// Name + Capacity + Variables Constructor
+	ShmRing(
+	 std::string const & name,
+	 size_type const capacity,
+	 Vars const & vars
+	);
+
+	// Copy Constructor
+	ShmRing( ShmRing const & ) = delete;
+
+	// Copy Assignment
+	ShmRing &
+	operator =( ShmRing const & ) = delete;
+
+	// Destructor
+	~ShmRing();
+
+public: // Predicate
+
+	// Open?
+	bool
+	is_open() const
+	{
+		return header_ != nullptr;
+	}
+
+public: // Property
+
+	// Shared-Memory Object Name
+	std::string const &
+	name() const
+	{
+		return name_;
+	}
+
+	// Capacity (Records)
+	size_type
+	capacity() const
+	{
+		return capacity_;
+	}
+
+	// Records Published
+	std::uint64_t
+	head() const
+	{
+		return head_;
+	}
+
+public: // Methods
+
+	// Publish a Record
+	void
+	append(
+	 Id const id,
+	 Time const t,
+	 Real const v,
+	 Kind const kind = Kind::x
+	) noexcept
+	{
+		assert( is_open() );
+		Record & r( records_[ head_ & mask_ ] );
+		r.seq.store( ( head_ << 1 ) + 1u, std::memory_order_relaxed ); // Mark writing
+		std::atomic_thread_fence( std::memory_order_release );
+		r.id = id;
+		r.kind = static_cast< std::uint32_t >( kind );
+		r.t = t;
+		r.v = v;
+		r.seq.store( ( head_ + 1u ) << 1, std::memory_order_release ); // Mark complete
+		header_->head.store( ++head_, std::memory_order_release );
+	}
+
+	// Mark Producer Finished
+	void
+	finish() noexcept
+	{
+		if ( is_open() ) header_->done.store( 1u, std::memory_order_release );
+	}
+
+public: // Static Methods
+
+	// Shared-Memory Object Name for a Model
+	static
+	std::string
+	object_name( std::string const & model );
+
+	// Read Record i from a Mapped Ring: Returns Whether Record is Valid (Complete and Not Overwritten)
+	static
+	bool
+	read(
+	 Header const * header,
+	 std::uint64_t const i,
+	 Record & rec
+	) noexcept
+	{
+		Record const * records( reinterpret_cast< Record const * >( reinterpret_cast< unsigned char const * >( header ) + header->records_offset ) );
+		Record const & r( records[ i & ( header->capacity - 1u ) ] );
+		std::uint64_t const seq( ( i + 1u ) << 1 );
+		if ( r.seq.load( std::memory_order_acquire ) != seq ) return false;
+		rec.id = r.id;
+		rec.kind = r.kind;
+		rec.t = r.t;
+		rec.v = r.v;
+		std::atomic_thread_fence( std::memory_order_acquire );
+		return r.seq.load( std::memory_order_relaxed ) == seq;
+	}
+
+private: // Data
+
+	std::string name_; // Shared-memory object name
+	size_type capacity_{ 0u }; // Ring capacity (records)
+	std::uint64_t mask_{ 0u }; // Ring index mask
+	size_type bytes_{ 0u }; // Mapped size (bytes)
+	Header * header_{ nullptr }; // Mapped header
+	Record * records_{ nullptr }; // Mapped records
+	std::uint64_t head_{ 0u }; // Records published
+
+}; // ShmRing
+
+} // QSS
+
+#endif
@@ -39,6 +39,7 @@
 // QSS Headers
 #include <QSS/Target.fwd.hh>
 #include <QSS/EventQueue.hh>
+#include <QSS/NameTable.hh>
 #include <QSS/SuperdenseTime.hh>
 
 // C++ Headers
@@ -70,7 +71,8 @@ protected: // Creation
 	// Name Constructor
 	explicit
 	Target( std::string const & name ) :
-	 name_( name )
+	 name_id_( NameTable::instance().intern( name ) ),
+	 name_( &NameTable::instance()[ name_id_ ] )
 	{}
 
 public: // Creation
@@ -96,12 +98,21 @@ public: // Property
 	std::string const &
 	name() const
 	{
-		return name_;
+		assert( name_ != nullptr );
+		return *name_; // Stored names don't move: No table lookup or lock
+	}
+
+	// Name Id
+	NameTable::Id
+	name_id() const
+	{
+		return name_id_;
 	}
 
 private: // Data
 
-	std::string name_;
+	NameTable::Id name_id_{ 0u }; // Interned name id
+	std::string const * name_{ &NameTable::instance()[ 0u ] }; // Interned name
 
 public: // Data
 
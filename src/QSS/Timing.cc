@@ -0,0 +1,349 @@
+// Setup Phase Timing
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// QSS Headers
+#include <QSS/Timing.hh>
+#include <QSS/cpu_time.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else // Posix
+#include <sys/resource.h>
+#endif
+
+namespace QSS {
+
+namespace {
+
+// Wall Time (s)
+double
+wall_time()
+{
+	return std::chrono::duration< double >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+// JSON String
+std::string
+json_string( std::string const & s )
+{
+	std::string j( 1u, '"' );
+	for ( char const c : s ) {
+		switch ( c ) {
+		case '"':
+			j += "\\\"";
+			break;
+		case '\\':
+			j += "\\\\";
+			break;
+		case '\n':
+			j += "\\n";
+			break;
+		case '\t':
+			j += "\\t";
+			break;
+		default:
+			if ( static_cast< unsigned char >( c ) < 0x20u ) {
+				char u[ 8 ];
+				std::snprintf( u, sizeof( u ), "\\u%04x", static_cast< unsigned >( c ) );
+				j += u;
+			} else {
+				j += c;
+			}
+		}
+	}
+	j += '"';
+	return j;
+}
+
+// Open Phases of a Thread
+struct Open final
+{
+	std::vector< Timing::size_type > i; // Record indexes
+	std::vector< double > wall_beg; // Wall begin times
+	std::vector< double > cpu_beg; // CPU begin times
+	std::vector< std::size_t > rss_beg; // Peak RSS at begin
+};
+
+// Thread's Open Phases
+Open &
+open_phases()
+{
+	static thread_local Open open;
+	return open;
+}
+
+} // namespace
+
+	// Model + Phase Name Constructor
+	Timing::Phase::
+	Phase(
+	 std::string const & model,
+	 std::string const & name
+	)
+	{
+		if ( Timing::on() ) {
+			model_ = model;
+			phase_ = Timing::instance().begin( model, name );
+		}
+	}
+
+	// Destructor
+	Timing::Phase::
+	~Phase()
+	{
+		end();
+	}
+
+	// End Any Current Sub-Phase and Begin the Named Sub-Phase
+	void
+	Timing::Phase::
+	sub( std::string const & name )
+	{
+		if ( phase_ != npos ) {
+			sub_end();
+			sub_ = Timing::instance().begin( model_, name );
+		}
+	}
+
+	// End Any Current Sub-Phase
+	void
+	Timing::Phase::
+	sub_end()
+	{
+		if ( sub_ != npos ) {
+			Timing::instance().end( sub_ );
+			sub_ = npos;
+		}
+	}
+
+	// End Phase Before Destruction
+	void
+	Timing::Phase::
+	end()
+	{
+		if ( phase_ != npos ) {
+			sub_end();
+			Timing::instance().end( phase_ );
+			phase_ = npos;
+		}
+	}
+
+	// Process Timing
+	Timing &
+	Timing::
+	instance()
+	{
+		static Timing timing;
+		return timing;
+	}
+
+	// Recording On?
+	bool
+	Timing::
+	on()
+	{
+		return !options::timing.empty();
+	}
+
+	// Peak Resident Set Size (KB)
+	std::size_t
+	Timing::
+	peak_rss()
+	{
+#ifdef _WIN32
+		PROCESS_MEMORY_COUNTERS pmc;
+		if ( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) != 0 ) {
+			return static_cast< std::size_t >( pmc.PeakWorkingSetSize / 1024u );
+		} else {
+			return 0u;
+		}
+#else // Posix
+		struct rusage usage;
+		if ( getrusage( RUSAGE_SELF, &usage ) == 0 ) {
+#ifdef __APPLE__
+			return static_cast< std::size_t >( usage.ru_maxrss / 1024 ); // Bytes on macOS
+#else
+			return static_cast< std::size_t >( usage.ru_maxrss ); // KB on Linux
+#endif
+		} else {
+			return 0u;
+		}
+#endif
+	}
+
+	// Begin a Phase: Returns its record index
+	Timing::size_type
+	Timing::
+	begin(
+	 std::string const & model,
+	 std::string const & name
+	)
+	{
+		Open & open( open_phases() );
+		size_type i;
+		{
+			std::lock_guard< std::mutex > const lock( mutex_ );
+			i = records_.size();
+			Record & record( records_.emplace_back() );
+			record.model = model;
+			record.phase = open.i.empty() ? name : records_[ open.i.back() ].phase + '/' + name;
+			record.depth = open.i.size();
+		}
+		open.i.push_back( i );
+		open.rss_beg.push_back( peak_rss() );
+		open.cpu_beg.push_back( cpu_time() );
+		open.wall_beg.push_back( wall_time() ); // Last so the bookkeeping above isn't timed
+		return i;
+	}
+
+	// End a Phase
+	void
+	Timing::
+	end( size_type const i )
+	{
+		double const wall( wall_time() );
+		double const cpu( cpu_time() );
+		std::size_t const rss( peak_rss() );
+		Open & open( open_phases() );
+		assert( !open.i.empty() );
+		assert( open.i.back() == i ); // Phases end in nesting order
+		{
+			std::lock_guard< std::mutex > const lock( mutex_ );
+			Record & record( records_[ i ] );
+			record.wall = wall - open.wall_beg.back();
+			record.cpu = cpu - open.cpu_beg.back();
+			record.rss = rss;
+			record.rss_growth = rss - std::min( rss, open.rss_beg.back() );
+		}
+		open.i.pop_back();
+		open.wall_beg.pop_back();
+		open.cpu_beg.pop_back();
+		open.rss_beg.pop_back();
+	}
+
+	// Report to Stream
+	void
+	Timing::
+	report( std::ostream & stream ) const
+	{
+		std::lock_guard< std::mutex > const lock( mutex_ );
+		std::ios_base::fmtflags const flags( stream.flags() );
+		std::streamsize const precision( stream.precision() );
+		stream << "\nSetup Timing =====\n";
+		stream << "     Wall (s)      CPU (s)  Peak RSS (MB)   Growth (MB)  Model: Phase\n";
+		stream << "CPU and peak RSS are process-wide: They include any models running concurrently\n";
+		stream << std::fixed;
+		for ( Record const & record : records_ ) {
+			std::string::size_type const slash( record.phase.rfind( '/' ) );
+			std::string const name( slash == std::string::npos ? record.phase : record.phase.substr( slash + 1u ) );
+			stream << std::setprecision( 3 ) << std::setw( 13 ) << record.wall << std::setw( 13 ) << record.cpu;
+			stream << std::setprecision( 1 ) << std::setw( 15 ) << record.rss / 1024.0 << std::setw( 14 ) << record.rss_growth / 1024.0;
+			stream << "  " << record.model << ": " << std::string( 2u * record.depth, ' ' ) << name << '\n';
+		}
+		stream.flags( flags );
+		stream.precision( precision );
+		stream << std::flush;
+	}
+
+	// Write JSON to Stream
+	void
+	Timing::
+	json( std::ostream & stream ) const
+	{
+		std::lock_guard< std::mutex > const lock( mutex_ );
+		std::ios_base::fmtflags const flags( stream.flags() );
+		std::streamsize const precision( stream.precision() );
+		stream << "{\n  \"units\": { \"wall\": \"s\", \"cpu\": \"s\", \"peak_rss\": \"KB\", \"rss_growth\": \"KB\" },\n  \"process_wide\": [ \"cpu\", \"peak_rss\", \"rss_growth\" ],\n  \"phases\": [";
+		stream << std::setprecision( 6 ) << std::fixed;
+		for ( size_type i = 0, n = records_.size(); i < n; ++i ) {
+			Record const & record( records_[ i ] );
+			stream << ( i == 0u ? "\n" : ",\n" );
+			stream << "    { \"model\": " << json_string( record.model ) << ", \"phase\": " << json_string( record.phase ) << ", \"depth\": " << record.depth;
+			stream << ", \"wall\": " << record.wall << ", \"cpu\": " << record.cpu << ", \"peak_rss\": " << record.rss << ", \"rss_growth\": " << record.rss_growth << " }";
+		}
+		stream << "\n  ]\n}\n";
+		stream.flags( flags );
+		stream.precision( precision );
+	}
+
+	// Report to std::cout and Write JSON File if Recording
+	void
+	Timing::
+	report() const
+	{
+		if ( !on() ) return;
+		{
+			std::lock_guard< std::mutex > const lock( mutex_ );
+			if ( records_.empty() ) return;
+		}
+		report( std::cout );
+		std::ofstream json_stream( options::timing, std::ios_base::binary | std::ios_base::out );
+		if ( json_stream ) {
+			json( json_stream );
+			std::cout << "Setup timing JSON written to " << options::timing << std::endl;
+		} else {
+			std::cerr << "\nError: Setup timing JSON file open failed: " << options::timing << std::endl;
+		}
+	}
+
+	// Clear
+	void
+	Timing::
+	clear()
+	{
+		{
+			std::lock_guard< std::mutex > const lock( mutex_ );
+			records_.clear();
+		}
+		Open & open( open_phases() );
+		open.i.clear();
+		open.wall_beg.clear();
+		open.cpu_beg.clear();
+		open.rss_beg.clear();
+	}
+
+} // QSS
@@ -0,0 +1,205 @@
+// Setup Phase Timing
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_Timing_hh_INCLUDED
+#define QSS_Timing_hh_INCLUDED
+
+// C++ Headers
+#include <cstddef>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace QSS {
+
+// Setup Phase Timing: Wall time, CPU time, and peak RSS of named setup phases of each model
+//
+// Phases nest: A phase begun while another is open on the same thread is its sub-phase
+// Concurrent model runs can record phases: Each thread has its own open phase stack and records are appended under a lock
+// CPU time and peak RSS are process-wide so phases of concurrent model runs include each other's usage
+// The report is made once after all models have run
+// Recording is off unless the --timing option is specified
+class Timing final
+{
+
+public: // Types
+
+	using size_type = std::size_t;
+
+	static constexpr size_type npos{ static_cast< size_type >( -1 ) };
+
+	// Phase Record
+	struct Record final
+	{
+		std::string model; // Model name
+		std::string phase; // Phase path: Sub-phase names appended with '/'
+		size_type depth{ 0u }; // Nesting depth
+		double wall{ 0.0 }; // Wall time (s)
+		double cpu{ 0.0 }; // CPU time (s)
+		std::size_t rss{ 0u }; // Peak RSS at phase end (KB)
+		std::size_t rss_growth{ 0u }; // Peak RSS growth during phase (KB)
+	};
+
+	using Records = std::vector< Record >;
+
+	// Scoped Phase Timer with Sequential Sub-Phases: Ends on destruction or end()
+	class Phase final
+	{
+
+	public: // Creation
+
+		// Model + Phase Name Constructor
+		Phase(
+		 std::string const & model,
+		 std::string const & name
+		);
+
+		// Copy Constructor
+		Phase( Phase const & ) = delete;
+
+		// Destructor
+		~Phase();
+
+	public: // Assignment
+
+		// Copy Assignment
+		Phase &
+		operator =( Phase const & ) = delete;
+
+	public: // Methods
+
+		// End Any Current Sub-Phase and Begin the Named Sub-Phase
+		void
+		sub( std::string const & name );
+
+		// End Any Current Sub-Phase
+		void
+		sub_end();
+
+		// End Phase Before Destruction
+		void
+		end();
+
+	private: // Data
+
+		std::string model_; // Model name
+		size_type phase_{ npos }; // Phase record index
+		size_type sub_{ npos }; // Current sub-phase record index
+
+	}; // Phase
+
+private: // Creation
+
+	// Default Constructor
+	Timing() = default;
+
+public: // Creation
+
+	// Copy Constructor
+	Timing( Timing const & ) = delete;
+
+public: // Assignment
+
+	// Copy Assignment
+	Timing &
+	operator =( Timing const & ) = delete;
+
+public: // Static Methods
+
+	// Process Timing
+	static
+	Timing &
+	instance();
+
+	// Recording On?
+	static
+	bool
+	on();
+
+	// Peak Resident Set Size (KB)
+	static
+	std::size_t
+	peak_rss();
+
+public: // Property
+
+	// Records: Not for use while phases are being recorded on other threads
+	Records const &
+	records() const
+	{
+		return records_;
+	}
+
+public: // Methods
+
+	// Begin a Phase: Returns its record index
+	size_type
+	begin(
+	 std::string const & model,
+	 std::string const & name
+	);
+
+	// End a Phase
+	void
+	end( size_type const i );
+
+	// Report to Stream
+	void
+	report( std::ostream & stream ) const;
+
+	// Write JSON to Stream
+	void
+	json( std::ostream & stream ) const;
+
+	// Report to std::cout and Write JSON File if Recording
+	void
+	report() const;
+
+	// Clear
+	void
+	clear();
+
+private: // Data
+
+	Records records_; // Phase records in begin order
+	mutable std::mutex mutex_; // Guards records_
+
+}; // Timing
+
+} // QSS
+
+#endif
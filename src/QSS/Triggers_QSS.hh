@@ -91,15 +91,28 @@ public: // Predicate
 		return t >= fmu_me_->t0;
 	}
 
+public: // Property
+
+	// Number of Triggers
+	size_type
+	n_triggers() const
+	{
+		return n_triggers_;
+	}
+
+	// Number of Triggers Observees
+	size_type
+	n_observees() const
+	{
+		return n_observees_;
+	}
+
 public: // Methods
 
-	// QSS Advance Triggers
+	// Assign a Triggers Collection: FMU Pooled Data and Observees Set Up
 	void
-	advance( Variables & triggers, Time const t, SuperdenseTime const & s )
+	assign( Variables const & triggers )
 	{
-		assert( fmu_me_ != nullptr );
-		assert( fmu_me_->get_time() == t );
-
 		if ( triggers.empty() ) {
 			clear();
 			return;
@@ -142,6 +155,24 @@ public: // Methods
 		for ( Variable const * observee : observees_ ) {
 			observees_v_ref_.push_back( observee->var().ref() );
 		}
+	}
+
+	// QSS Advance Triggers
+	void
+	advance( Variables & triggers, Time const t, SuperdenseTime const & s )
+	{
+		assign( triggers );
+		advance_assigned( triggers, t, s );
+	}
+
+	// QSS Advance Assigned Triggers: Triggers Must be Those of the Last assign Call
+	void
+	advance_assigned( Variables & triggers, Time const t, SuperdenseTime const & s )
+	{
+		assert( fmu_me_ != nullptr );
+		assert( fmu_me_->get_time() == t );
+		assert( triggers.size() == n_triggers_ );
+		if ( n_triggers_ == 0u ) return;
 
 		(this->*advance_ptr)( triggers, t, s );
 	}
@@ -107,7 +107,7 @@ namespace QSS {
 		std::vector< VariableRef > observees_refs;
 		observees_refs.reserve( observees_.size() );
 		for ( Variable const * observee : observees_ ) {
-			observees_refs.push_back( observee->var_.ref() );
+			observees_refs.push_back( observee->ref_ );
 		}
 		std::sort( observees_refs.begin(), observees_refs.end() );
 		assert( std::adjacent_find( observees_refs.begin(), observees_refs.end() ) == observees_refs.end() ); // No repeat value references
@@ -120,7 +120,7 @@ namespace QSS {
 		n_observees_ = observees_.size();
 		observees_v_ref_.reserve( n_observees_ );
 		for ( Variable const * observee : observees_ ) {
-			observees_v_ref_.push_back( observee->var_.ref() );
+			observees_v_ref_.push_back( observee->ref_ );
 		}
 		observees_v_.resize( n_observees_ );
 		if ( options::d2d || ( is_R() && is_Active() ) || is_ZC() ) observees_dv_.resize( n_observees_ );
@@ -142,6 +142,14 @@ namespace QSS {
 		observers_.set_computational_observers();
 	}
 
+	// Initialize Observers from Precomputed Computational Observers
+	void
+	Variable::
+	init_observers( Variables && computational_observers )
+	{
+		observers_.set_computational_observers( std::move( computational_observers ) );
+	}
+
 	// Finalize Observers
 	void
 	Variable::
@@ -164,7 +172,7 @@ namespace QSS {
 	Variable::
 	advance_connections()
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->advance_connection( tQ );
 		}
 	}
@@ -174,7 +182,7 @@ namespace QSS {
 	Variable::
 	advance_connections_observer()
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->advance_connection_observer();
 		}
 	}
@@ -184,12 +192,12 @@ namespace QSS {
 	Variable::
 	decorate_out( std::string const & dec )
 	{
-		dec_ = dec;
+		cold_->dec = dec;
 		if ( out_on_ ) {
-			if ( options::output::X ) out_x_.decorate( dec );
+			if ( options::output::X ) cold_->out_x.decorate( dec );
 			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.decorate( dec );
-				if ( options::output::T ) out_t_.decorate( dec );
+				if ( options::output::Q ) cold_->out_q.decorate( dec );
+				if ( options::output::T ) cold_->out_t.decorate( dec );
 			}
 		}
 	}
@@ -200,33 +208,33 @@ namespace QSS {
 	init_out( std::string const & dir, std::string const & dec )
 	{
 		if ( out_on_ ) {
-			if ( options::output::X ) out_x_.init( dir, name(), 'x', dec );
+			if ( options::output::X ) cold_->out_x.init( dir, name(), 'x', dec );
 			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.init( dir, name(), 'q', dec );
-				if ( options::output::T ) out_t_.init( dir, name(), 't', dec );
+				if ( options::output::Q ) cold_->out_q.init( dir, name(), 'q', dec );
+				if ( options::output::T ) cold_->out_t.init( dir, name(), 't', dec );
 			}
 			if ( options::output::h ) {
-				if ( var_.is_Real() ) {
-					char const * var_type_char( fmi2_import_get_real_variable_quantity( var_.rvr ) );
+				if ( cold_->var.is_Real() ) {
+					char const * var_type_char( fmi2_import_get_real_variable_quantity( cold_->var.rvr ) );
 					std::string const var_type( var_type_char == nullptr ? "" : var_type_char );
-					fmi2_import_unit_t * const var_unit_ptr( fmi2_import_get_real_variable_unit( var_.rvr ) );
+					fmi2_import_unit_t * const var_unit_ptr( fmi2_import_get_real_variable_unit( cold_->var.rvr ) );
 					std::string const var_unit( var_unit_ptr == nullptr ? "" : fmi2_import_get_unit_name( var_unit_ptr ) );
-					if ( options::output::X ) out_x_.header( var_type, var_unit );
+					if ( options::output::X ) cold_->out_x.header( var_type, var_unit );
 					if ( is_Active() ) {
-						if ( options::output::Q ) out_q_.header( var_type, var_unit );
-						if ( options::output::T ) out_t_.header( "Time", "s" );
+						if ( options::output::Q ) cold_->out_q.header( var_type, var_unit );
+						if ( options::output::T ) cold_->out_t.header( "Time", "s" );
 					}
-				} else if ( var_.is_Integer() ) { // Integer variables have no unit
-					char const * var_type_char( fmi2_import_get_integer_variable_quantity( var_.ivr ) );
+				} else if ( cold_->var.is_Integer() ) { // Integer variables have no unit
+					char const * var_type_char( fmi2_import_get_integer_variable_quantity( cold_->var.ivr ) );
 					std::string const var_type( var_type_char == nullptr ? "" : var_type_char );
-					if ( options::output::X ) out_x_.header( var_type );
+					if ( options::output::X ) cold_->out_x.header( var_type );
 					if ( is_Active() ) {
-						if ( options::output::Q ) out_q_.header( var_type );
+						if ( options::output::Q ) cold_->out_q.header( var_type );
 					}
 				} else { // Modelica Boolean variables can have a quantity but there is no FMIL API for getting it
-					if ( options::output::X ) out_x_.header();
+					if ( options::output::X ) cold_->out_x.header();
 					if ( is_Active() ) {
-						if ( options::output::Q ) out_q_.header();
+						if ( options::output::Q ) cold_->out_q.header();
 					}
 				}
 			}
@@ -238,7 +246,7 @@ namespace QSS {
 	Variable::
 	connections_out( Time const t )
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->out( t );
 		}
 	}
@@ -248,7 +256,7 @@ namespace QSS {
 	Variable::
 	connections_out_q( Time const t )
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->out_q( t );
 		}
 	}
@@ -258,7 +266,7 @@ namespace QSS {
 	Variable::
 	connections_observer_out_pre( Time const t )
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->observer_out_pre( t );
 		}
 	}
@@ -268,7 +276,7 @@ namespace QSS {
 	Variable::
 	connections_observer_out_post( Time const t )
 	{
-		for ( Variable_Con * connection : connections_ ) {
+		for ( Variable_Con * connection : cold_->connections ) {
 			connection->observer_out_post( t );
 		}
 	}
@@ -39,6 +39,7 @@
 // QSS Headers
 #include <QSS/Variable.fwd.hh>
 #include <QSS/Target.hh>
+#include <QSS/Aggregate.hh>
 #include <QSS/container.hh>
 #include <QSS/FMU_ME.hh>
 #include <QSS/FMU_Variable.hh>
@@ -49,6 +50,7 @@
 //#include <QSS/Observers.serial.hh> // Serial
 #include <QSS/options.hh>
 #include <QSS/Output.hh>
+#include <QSS/RootBatch.hh>
 #include <QSS/SmoothToken.hh>
 #include <QSS/string.hh>
 
@@ -63,6 +65,7 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -110,7 +113,7 @@ public: // Types
 protected: // Creation
 
 	// Copy Constructor
-	Variable( Variable const & ) = default;
+	Variable( Variable const & ) = delete;
 
 	// Move Constructor
 	Variable( Variable && ) noexcept = default;
@@ -128,23 +131,22 @@ protected: // Creation
 	 FMU_Variable const & der = FMU_Variable()
 	) :
 	 Target( name ),
-	 order_( order ),
-	 is_time_( name == "time" ),
 	 rTol( std::max( rTol_, 0.0 ) ),
 	 aTol( std::max( aTol_, std::numeric_limits< Real >::min() ) ),
 	 zTol( std::max( zTol_, 0.0 ) ),
-	 xIni( xIni_ ),
 	 dt_min( options::dtMin ),
 	 dt_max( options::dtMax ),
 	 dt_inf_rlx_( options::dtInf == infinity ? infinity : options::dtInf ),
-	 observers_( fmu_me, this ),
 	 fmu_me_( fmu_me ),
-	 var_( var ),
-	 der_( der ),
 	 eventq_( fmu_me->eventq ),
-	 out_x_( name, 'x', false ),
-	 out_q_( name, 'q', false ),
-	 out_t_( name, 't', false )
+	 ref_( var.ref() ),
+	 der_ref_( der.ref() ),
+	 is_handler_( var.is_handler ),
+	 order_( order ),
+	 is_time_( name == "time" ),
+	 xIni( xIni_ ),
+	 observers_( fmu_me, this ),
+	 cold_( std::make_unique< Cold >( name, var, der ) )
 	{}
 
 	// Name + Tolerance + Value Constructor
@@ -159,22 +161,21 @@ protected: // Creation
 	 FMU_Variable const & der = FMU_Variable()
 	) :
 	 Target( name ),
-	 order_( order ),
-	 is_time_( name == "time" ),
 	 rTol( std::max( rTol_, 0.0 ) ),
 	 aTol( std::max( aTol_, std::numeric_limits< Real >::min() ) ),
-	 xIni( xIni_ ),
 	 dt_min( options::dtMin ),
 	 dt_max( options::dtMax ),
 	 dt_inf_rlx_( options::dtInf == infinity ? infinity : options::dtInf ),
-	 observers_( fmu_me, this ),
 	 fmu_me_( fmu_me ),
-	 var_( var ),
-	 der_( der ),
 	 eventq_( fmu_me->eventq ),
-	 out_x_( name, 'x', false ),
-	 out_q_( name, 'q', false ),
-	 out_t_( name, 't', false )
+	 ref_( var.ref() ),
+	 der_ref_( der.ref() ),
+	 is_handler_( var.is_handler ),
+	 order_( order ),
+	 is_time_( name == "time" ),
+	 xIni( xIni_ ),
+	 observers_( fmu_me, this ),
+	 cold_( std::make_unique< Cold >( name, var, der ) )
 	{}
 
 	// Name + Value Constructor
@@ -187,27 +188,26 @@ protected: // Creation
 	 FMU_Variable const & der = FMU_Variable()
 	) :
 	 Target( name ),
-	 order_( order ),
-	 is_time_( name == "time" ),
-	 xIni( xIni_ ),
 	 dt_min( options::dtMin ),
 	 dt_max( options::dtMax ),
 	 dt_inf_rlx_( options::dtInf == infinity ? infinity : options::dtInf ),
-	 observers_( fmu_me, this ),
 	 fmu_me_( fmu_me ),
-	 var_( var ),
-	 der_( der ),
 	 eventq_( fmu_me->eventq ),
-	 out_x_( name, 'x', false ),
-	 out_q_( name, 'q', false ),
-	 out_t_( name, 't', false )
+	 ref_( var.ref() ),
+	 der_ref_( der.ref() ),
+	 is_handler_( var.is_handler ),
+	 order_( order ),
+	 is_time_( name == "time" ),
+	 xIni( xIni_ ),
+	 observers_( fmu_me, this ),
+	 cold_( std::make_unique< Cold >( name, var, der ) )
 	{}
 
 protected: // Assignment
 
 	// Copy Assignment
 	Variable &
-	operator =( Variable const & ) = default;
+	operator =( Variable const & ) = delete;
 
 	// Move Assignment
 	Variable &
@@ -349,6 +349,14 @@ public: // Predicate
 		return !is_LIQSS();
 	}
 
+	// Batched Requantization Root Variable?
+	virtual
+	bool
+	is_root_batch() const
+	{
+		return false;
+	}
+
 	// Zero-Crossing Variable?
 	virtual
 	bool
@@ -428,7 +436,7 @@ public: // Predicate
 	bool
 	handler() const
 	{
-		return var_.is_handler;
+		return is_handler_;
 	}
 
 	// Observed?
@@ -489,7 +497,21 @@ public: // Property
 	VariableRef
 	ref() const
 	{
-		return var_.ref();
+		return ref_;
+	}
+
+	// Binning Locality Signature: Observee and Cluster Bit Set
+	std::uint64_t
+	locality() const
+	{
+		return locality_;
+	}
+
+	// Binning Locality Bit
+	std::uint64_t
+	locality_bit() const
+	{
+		return std::uint64_t( 1u ) << ( ( std::uint64_t( ref_ ) * 0x9E3779B97F4A7C15ull ) >> 58 ); // Fibonacci hash of value reference into [0,63]
 	}
 
 	// Variable Sorting Index
@@ -506,11 +528,20 @@ public: // Property
 		return is_state() ? 0 : 1;
 	}
 
+	// Cold Data Size (bytes)
+	static
+	constexpr
+	std::size_t
+	cold_sizeof()
+	{
+		return sizeof( Cold );
+	}
+
 	// Output File Name Decoration
 	std::string const &
 	decoration() const
 	{
-		return dec_;
+		return cold_->dec;
 	}
 
 	// Boolean Value
@@ -692,42 +723,42 @@ public: // Property
 	FMU_Variable const &
 	var() const
 	{
-		return var_;
+		return cold_->var;
 	}
 
 	// FMU Variable Specs
 	FMU_Variable &
 	var()
 	{
-		return var_;
+		return cold_->var;
 	}
 
 	// FMU Derivative Specs
 	FMU_Variable const &
 	der() const
 	{
-		return der_;
+		return cold_->der;
 	}
 
 	// FMU Derivative Specs
 	FMU_Variable &
 	der()
 	{
-		return der_;
+		return cold_->der;
 	}
 
 	// Connections
 	Variable_Cons const &
 	connections() const
 	{
-		return connections_;
+		return cold_->connections;
 	}
 
 	// Connections
 	Variable_Cons &
 	connections()
 	{
-		return connections_;
+		return cold_->connections;
 	}
 
 	// Event Queue
@@ -744,8 +775,36 @@ public: // Property
 		return eventq_;
 	}
 
+	// Requantization Event Count
+	std::size_t
+	n_QSS_events() const
+	{
+		return n_QSS_events_;
+	}
+
+	// Zero-Crossing Event Count
+	std::size_t
+	n_ZC_events() const
+	{
+		return n_ZC_events_;
+	}
+
 public: // Methods
 
+	// Count a Requantization Event
+	void
+	count_QSS_event()
+	{
+		++n_QSS_events_;
+	}
+
+	// Count a Zero-Crossing Event
+	void
+	count_ZC_event()
+	{
+		++n_ZC_events_;
+	}
+
 	// Self-Observe
 	void
 	self_observe()
@@ -776,10 +835,29 @@ public: // Methods
 	void
 	uniquify_observers();
 
+	// Initialize Binning Locality Signature from Observees
+	void
+	init_locality()
+	{
+		locality_ = 0u;
+		for ( Variable const * observee : observees_ ) locality_ |= observee->locality_bit();
+	}
+
+	// Add a Variable to Binning Locality Signature
+	void
+	add_locality( Variable const * var )
+	{
+		locality_ |= var->locality_bit();
+	}
+
 	// Initialize Observers
 	void
 	init_observers();
 
+	// Initialize Observers from Precomputed Computational Observers
+	void
+	init_observers( Variables && computational_observers );
+
 	// Finalize Observers
 	void
 	finalize_observers();
@@ -1306,6 +1384,22 @@ public: // Methods
 		assert( false );
 	}
 
+	// Observer Advance: Stage Final: Add Requantization Root Problem to Batch
+	virtual
+	void
+	advance_observer_F_root_add( RootBatch & )
+	{
+		assert( false );
+	}
+
+	// Observer Advance: Stage Final: Given Batched Requantization Root
+	virtual
+	void
+	advance_observer_F_root( Real const )
+	{
+		assert( false );
+	}
+
 	// Observer Advance: Stage d
 	virtual
 	void
@@ -1338,6 +1432,13 @@ public: // Methods: Output
 		out_on_ = true;
 	}
 
+	// Output On?
+	bool
+	out_on() const
+	{
+		return out_on_;
+	}
+
 	// Decorate Outputs
 	void
 	decorate_out( std::string const & dec = std::string() );
@@ -1351,21 +1452,29 @@ public: // Methods: Output
 	out( Time const t )
 	{
 		if ( out_on_ ) {
-			if ( options::output::X ) out_x_.append( t, x( t ) );
+			if ( options::output::X ) cold_->out_x.append( t, x( t ) );
 			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.append( t, q( t ) );
+				if ( options::output::Q ) cold_->out_q.append( t, q( t ) );
 			}
+			shm_out( t );
 		}
 		if ( connected_ ) connections_out( t );
 	}
 
+	// Shared-Memory Output at Time t
+	void
+	shm_out( Time const t ) const
+	{
+		if ( ( fmu_me_ != nullptr ) && ( fmu_me_->shm != nullptr ) ) fmu_me_->shm->append( ShmRing::Id( cold_->var.idx ), t, x( t ) );
+	}
+
 	// Output Quantized at Time t
 	void
 	out_q( Time const t )
 	{
 		if ( out_on_ ) {
 			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.append( t, q( t ) );
+				if ( options::output::Q ) cold_->out_q.append( t, q( t ) );
 			}
 		}
 		if ( connected_ ) connections_out_q( t );
@@ -1377,7 +1486,7 @@ public: // Methods: Output
 	{
 		if ( out_on_ ) {
 			if ( is_Active() ) {
-				if ( options::output::T ) out_t_.append( t, tS );
+				if ( options::output::T ) cold_->out_t.append( t, tS );
 			}
 		}
 	}
@@ -1387,10 +1496,11 @@ public: // Methods: Output
 	observer_out_pre( Time const t )
 	{
 		if ( out_on_ ) {
-			if ( options::output::X ) out_x_.append( t, x( t ) );
+			if ( options::output::X ) cold_->out_x.append( t, x( t ) );
 			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.append( t, q( t ) );
+				if ( options::output::Q ) cold_->out_q.append( t, q( t ) );
 			}
+			shm_out( t );
 		}
 		if ( connected_ ) connections_observer_out_pre( t );
 	}
@@ -1401,10 +1511,11 @@ public: // Methods: Output
 	{
 		if ( not_state() ) { // State observers derivative may change but not value
 			if ( out_on_ ) {
-				if ( options::output::X ) out_x_.append( t, x( t ) );
+				if ( options::output::X ) cold_->out_x.append( t, x( t ) );
 				if ( is_Active() ) {
-					if ( options::output::Q ) out_q_.append( t, q( t ) );
+					if ( options::output::Q ) cold_->out_q.append( t, q( t ) );
 				}
+				shm_out( t );
 			}
 			if ( connected_ ) connections_observer_out_post( t );
 		}
@@ -1448,15 +1559,37 @@ public: // Methods: Output
 	void
 	connections_observer_out_post( Time const t );
 
-	// Flush Outputs
+	// Flush Outputs: Creates the files of initialized outputs without entries
 	void
 	flush_out()
 	{
-		if ( out_on_ ) {
-			if ( options::output::X ) out_x_.flush();
-			if ( is_Active() ) {
-				if ( options::output::Q ) out_q_.flush();
-			}
+		cold_->out_x.flush();
+		cold_->out_q.flush();
+		cold_->out_t.flush();
+	}
+
+public: // Methods: Aggregate
+
+	// Aggregate Set
+	void
+	aggregate( Aggregate * agg )
+	{
+		agg_ = agg;
+	}
+
+	// Aggregate Update at Time t: Call After Continuous Trajectory Changes
+	void
+	aggregate( Time const t ) const
+	{
+		if ( agg_ != nullptr ) agg_->update( t, x( t ), x1( t ), one_half * x2( t ), one_sixth * x3( t ) );
+	}
+
+	// Observers Aggregate Update at Time t
+	void
+	observers_aggregate( Time const t ) const
+	{
+		for ( Variable const * observer : observers_ ) {
+			observer->aggregate( t );
 		}
 	}
 
@@ -1470,6 +1603,14 @@ public: // Methods: FMU
 		return fmu_me_->get_time();
 	}
 
+	// Get FMU Simulation End Time
+	Time
+	fmu_get_tE() const
+	{
+		assert( fmu_me_ != nullptr );
+		return fmu_me_->tE;
+	}
+
 	// Set FMU Time
 	void
 	fmu_set_time( Time const t ) const
@@ -1483,7 +1624,7 @@ public: // Methods: FMU
 	fmu_get_real() const
 	{
 		assert( fmu_me_ != nullptr );
-		return fmu_me_->get_real( var_.ref() );
+		return fmu_me_->get_real( ref_ );
 	}
 
 	// Set FMU Real Variable to a Value
@@ -1492,7 +1633,7 @@ public: // Methods: FMU
 	{
 		assert( fmu_me_ != nullptr );
 		assert( is_QSS() || is_Input() );
-		fmu_me_->set_real( var_.ref(), v );
+		fmu_me_->set_real( ref_, v );
 	}
 
 	// Get FMU Real Variable Derivative
@@ -1500,7 +1641,7 @@ public: // Methods: FMU
 	fmu_get_derivative() const
 	{
 		assert( fmu_me_ != nullptr );
-		return fmu_me_->get_real( der_.ref() );
+		return fmu_me_->get_real( der_ref_ );
 	}
 
 	// Get FMU Integer Variable Value
@@ -1508,7 +1649,7 @@ public: // Methods: FMU
 	fmu_get_integer() const
 	{
 		assert( fmu_me_ != nullptr );
-		return fmu_me_->get_integer( var_.ref() );
+		return fmu_me_->get_integer( ref_ );
 	}
 
 	// Set FMU Integer Variable to a Value
@@ -1517,7 +1658,7 @@ public: // Methods: FMU
 	{
 		assert( fmu_me_ != nullptr );
 		assert( is_Input() );
-		fmu_me_->set_integer( var_.ref(), v );
+		fmu_me_->set_integer( ref_, v );
 	}
 
 	// Get FMU Boolean Variable Value
@@ -1525,7 +1666,7 @@ public: // Methods: FMU
 	fmu_get_boolean() const
 	{
 		assert( fmu_me_ != nullptr );
-		return fmu_me_->get_boolean( var_.ref() );
+		return fmu_me_->get_boolean( ref_ );
 	}
 
 	// Set FMU Boolean Variable to a Value
@@ -1534,7 +1675,7 @@ public: // Methods: FMU
 	{
 		assert( fmu_me_ != nullptr );
 		assert( is_Input() );
-		fmu_me_->set_boolean( var_.ref(), v );
+		fmu_me_->set_boolean( ref_, v );
 	}
 
 	// Get FMU Variable Value as Real
@@ -1542,7 +1683,7 @@ public: // Methods: FMU
 	fmu_get_as_real() const
 	{
 		assert( fmu_me_ != nullptr );
-		return fmu_me_->get_as_real( var_ );
+		return fmu_me_->get_as_real( cold_->var );
 	}
 
 	// Set FMU Variable to Continuous Value at Time t
@@ -1551,7 +1692,7 @@ public: // Methods: FMU
 	fmu_set_x( Time const t ) const
 	{
 		assert( fmu_me_ != nullptr );
-		fmu_me_->set_real( var_.ref(), x( t ) );
+		fmu_me_->set_real( ref_, x( t ) );
 	}
 
 	// Set FMU Variable to Quantized Value at Time t
@@ -1560,7 +1701,7 @@ public: // Methods: FMU
 	fmu_set_q( Time const t ) const
 	{
 		assert( fmu_me_ != nullptr );
-		fmu_me_->set_real( var_.ref(), q( t ) );
+		fmu_me_->set_real( ref_, q( t ) );
 	}
 
 	// Set FMU Variable to Appropriate Value at Time t
@@ -1570,9 +1711,9 @@ public: // Methods: FMU
 	{
 		assert( fmu_me_ != nullptr );
 #ifndef QSS_PROPAGATE_CONTINUOUS
-		fmu_me_->set_real( var_.ref(), q( t ) ); // Quantized: Traditional QSS
+		fmu_me_->set_real( ref_, q( t ) ); // Quantized: Traditional QSS
 #else
-		fmu_me_->set_real( var_.ref(), x( t ) ); // Continuous: Modified QSS
+		fmu_me_->set_real( ref_, x( t ) ); // Continuous: Modified QSS
 #endif
 	}
 
@@ -1885,7 +2026,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_dv_.size() );
 		fmu_set_observees_x( tQ ); // Modelon indicates that observee state matters for Jacobian computation
 		set_observees_dv_x( tQ );
-		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, var_.ref(), observees_dv_.data() );
+		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, ref_, observees_dv_.data() );
 	}
 
 	// Coefficient 1 at Time t: X-Based R or ZC Variable
@@ -1901,7 +2042,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_dv_.size() );
 		fmu_set_observees_x( t ); // Modelon indicates that observee state matters for Jacobian computation
 		set_observees_dv_x( t );
-		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, var_.ref(), observees_dv_.data() );
+		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, ref_, observees_dv_.data() );
 	}
 
 	// Coefficient 1 at Time tQ: X-Based R or ZC Variable: Don't Set Observee Values
@@ -1916,7 +2057,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_v_ref_.size() );
 		assert( n_observees_ == observees_dv_.size() );
 		set_observees_dv_x( tQ );
-		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, var_.ref(), observees_dv_.data() );
+		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, ref_, observees_dv_.data() );
 	}
 
 	// Coefficient 1 at Time t: X-Based R or ZC Variable: Don't Set Observee Values
@@ -1931,7 +2072,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_v_ref_.size() );
 		assert( n_observees_ == observees_dv_.size() );
 		set_observees_dv_x( t );
-		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, var_.ref(), observees_dv_.data() );
+		return fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, ref_, observees_dv_.data() );
 	}
 
 	// Coefficient 2 at Time t
@@ -1955,7 +2096,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_v_ref_.size() );
 		assert( n_observees_ == observees_dv_.size() );
 		set_observees_dv( tQ );
-		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_.ref(), observees_dv_.data() ); // Precondition: Observees already set to value at tQ
+		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_ref_, observees_dv_.data() ); // Precondition: Observees already set to value at tQ
 	}
 
 	// Coefficient 2 Directional Derivative at Time t
@@ -1968,7 +2109,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_v_ref_.size() );
 		assert( n_observees_ == observees_dv_.size() );
 		set_observees_dv( t );
-		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_.ref(), observees_dv_.data() ); // Precondition: Observees values set
+		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_ref_, observees_dv_.data() ); // Precondition: Observees values set
 	}
 
 	// Coefficient 2 Directional Derivative: Use Seed Vector
@@ -1979,7 +2120,7 @@ protected: // Methods: FMU
 		assert( n_observees_ == observees_.size() );
 		assert( n_observees_ == observees_v_ref_.size() );
 		assert( n_observees_ == observees_dv_.size() );
-		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_.ref(), observees_dv_.data() ); // Precondition: Observee values set
+		return one_half * fmu_me_->get_directional_derivative( observees_v_ref_.data(), n_observees_, der_ref_, observees_dv_.data() ); // Precondition: Observee values set
 	}
 
 	// Coefficient 2 at Time tQ: X-Based R or ZC Variable
@@ -2034,39 +2175,87 @@ private: // Methods
 		}
 	}
 
-private: // Data
+private: // Types
 
-	int order_{ 0 }; // Method order
-	bool is_time_{ false }; // Time variable?
+	// Cold Data: Specs, Connections, and Outputs Kept Off the Hot Cache Lines
+	struct Cold final
+	{
+
+		// Constructor
+		Cold(
+		 std::string const & name,
+		 FMU_Variable const & var_,
+		 FMU_Variable const & der_
+		) :
+		 var( var_ ),
+		 der( der_ ),
+		 out_x( name, 'x', false ),
+		 out_q( name, 'q', false ),
+		 out_t( name, 't', false )
+		{}
+
+		Variable_Cons connections; // Input connection variables this one outputs to
+		FMU_Variable var; // FMU variables specs
+		FMU_Variable der; // FMU derivative specs
+		std::string dec; // Output file name decoration
+		Output<> out_x; // Continuous trajectory output
+		Output<> out_q; // Quantized trajectory output
+		Output<> out_t; // Time step output
+
+	}; // Cold
 
 public: // Data
 
-	Real rTol{ 1.0e-4 }; // Relative tolerance
-	Real aTol{ 1.0e-6 }; // Absolute tolerance
-	Real zTol{ 0.0 }; // Zero-crossing/root tolerance
-	Real qTol{ 1.0e-6 }; // Quantization tolerance
-	Real xIni{ 0.0 }; // Initial value
+	// Hot integration state: Follows the Target base in cache lines 1-2 of a cache line aligned object
 	Time tQ{ 0.0 }; // Quantized time range begin
 	Time tX{ 0.0 }; // Continuous time range begin
 	Time tE{ 0.0 }; // Time range end: tQ <= tE and tX <= tE
 	Time tD{ infinity }; // Discrete event time: tQ <= tD and tX <= tD
 	Time tS{ 0.0 }; // Time step
+	Real qTol{ 1.0e-6 }; // Quantization tolerance
+	Real rTol{ 1.0e-4 }; // Relative tolerance
+	Real aTol{ 1.0e-6 }; // Absolute tolerance
+	Real zTol{ 0.0 }; // Zero-crossing/root tolerance
 	Time dt_min{ 0.0 }; // Time step min
 	Time dt_max{ infinity }; // Time step max
-	Real x_0_bump{ 0.0 }; // Bumped value
 
 private: // Data
 
 	// Time steps
 	mutable Time dt_inf_rlx_{ infinity }; // Relaxed time step inf
 
-	// Observers
+	// Event counts: Updated with the hot state at each event
+	std::size_t n_QSS_events_{ 0u }; // Requantization event count
+	std::size_t n_ZC_events_{ 0u }; // Zero-crossing event count
+
+	// FMU
+	FMU_ME * fmu_me_{ nullptr }; // FMU-ME
+	EventQ * eventq_{ nullptr }; // FMU event queue
+	VariableRef ref_{ 0u }; // FMU value reference
+	VariableRef der_ref_{ 0u }; // FMU derivative value reference
+	std::uint64_t locality_{ 0u }; // Binning locality signature
+
+	// Flags
+	bool is_handler_{ false }; // Handler?
 	bool observed_{ false }; // Has observers?
 	bool self_observer_{ false }; // Appears in its function/derivative?
+	bool observes_{ false }; // Has observees?
+	bool connected_{ false }; // Have connection(s)?
+	bool out_on_{ true }; // Output on?
+	int order_{ 0 }; // Method order
+	bool is_time_{ false }; // Time variable?
+
+public: // Data
+
+	Real xIni{ 0.0 }; // Initial value
+	Real x_0_bump{ 0.0 }; // Bumped value
+
+private: // Data
+
+	// Observers: Advanced at each requantization
 	Observers< Variable > observers_; // Variables dependent on this one
 
 	// Observees
-	bool observes_{ false }; // Has observees?
 	Variables observees_; // State and input variable downstream dependencies to set in FMU to get value and directional derivatives
 	VariableRefs observees_v_ref_; // Observee value references for FMU directional derivative lookup
 	mutable Reals observees_v_; // Observee values for FMU derivative lookup
@@ -2074,22 +2263,11 @@ private: // Data
 	std::size_t n_observees_{ 0u }; // Observee count for FMU derivative lookup
 	std::size_t i_self_observee_{ 0u }; // Observee index of this variable if self-observee
 
-	// Connections
-	bool connected_{ false }; // Have connection(s)?
-	Variable_Cons connections_; // Input connection variables this one outputs to
+	// Aggregate
+	Aggregate * agg_{ nullptr }; // Trajectory aggregate
 
-	// FMU
-	FMU_ME * fmu_me_{ nullptr }; // FMU-ME
-	FMU_Variable var_; // FMU variables specs
-	FMU_Variable der_; // FMU derivative specs
-	EventQ * eventq_{ nullptr }; // FMU event queue
-
-	// Outputs
-	bool out_on_{ true }; // Output on?
-	std::string dec_; // Output file name decoration
-	Output<> out_x_; // Continuous trajectory output
-	Output<> out_q_; // Quantized trajectory output
-	Output<> out_t_; // Time step output
+	// Cold data
+	std::unique_ptr< Cold > cold_; // Cold data
 
 private: // Static Data
 
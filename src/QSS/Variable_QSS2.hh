@@ -69,6 +69,15 @@ public: // Creation
 		set_qTol();
 	}
 
+public: // Predicate
+
+	// Batched Requantization Root Variable?
+	bool
+	is_root_batch() const override
+	{
+		return true;
+	}
+
 public: // Property
 
 	// Continuous Value at Time t
@@ -314,6 +323,22 @@ public: // Methods
 		if ( connected() ) advance_connections_observer();
 	}
 
+	// Observer Advance: Stage Final: Add Requantization Root Problem to Batch
+	void
+	advance_observer_F_root_add( RootBatch & roots ) override
+	{
+		set_tE_unaligned_root( roots );
+	}
+
+	// Observer Advance: Stage Final: Given Batched Requantization Root
+	void
+	advance_observer_F_root( Real const dt ) override
+	{
+		set_tE_unaligned( dt );
+		shift_QSS( tE );
+		if ( connected() ) advance_connections_observer();
+	}
+
 	// Observer Advance: Stage d
 	void
 	advance_observer_d() const override
@@ -376,6 +401,25 @@ private: // Methods
 		} else { // Both boundaries can have crossings
 			dt = min_root_quadratic_both( x_2_, d_1, d_0 + qTol, d_0 - qTol );
 		}
+		set_tE_unaligned( dt );
+	}
+
+	// Add End Time Root Problem to Batch: Quantized and Continuous Unaligned
+	void
+	set_tE_unaligned_root( RootBatch & roots )
+	{
+		assert( tQ <= tX );
+		clip_x();
+		Real const d_0( x_0_ - ( q_0_ + ( q_1_ * ( tX - tQ ) ) ) );
+		Real const d_1( x_1_ - q_1_ );
+		roots.add( x_2_, d_1, d_0 + qTol, d_0 - qTol );
+	}
+
+	// Set End Time Given Requantization Root: Quantized and Continuous Unaligned
+	void
+	set_tE_unaligned( Time dt )
+	{
+		assert( dt_min <= dt_max );
 		dt = dt_infinity( dt );
 		assert( dt > 0.0 ); // Might be infinity
 		if ( options::inflection ) {
@@ -43,26 +43,47 @@ namespace QSS {
 	Variable_ZC::
 	refine_root_ZC( Time const tBeg )
 	{
+		// Bracketed Illinois refinement using the continuous trajectory as a proxy: FMU evaluations only validate and narrow the bracket
 		assert( options::refine );
-		Time t( tZ );
+		assert( options::refineCalls > 0u );
+		assert( tBeg <= tZ );
 		Time const t_fmu( fmu_get_time() );
-		fmu_set_time( tZ );
-		Real const vZ( z_0( tZ ) );
-		Real v( vZ ), v_p( vZ );
-		Real m( 1.0 ); // Multiplier
-		std::size_t j( 0u );
-		std::size_t const n( 10u ); // Max iterations
-		while ( ( ++j <= n ) && ( ( std::abs( v ) > aTol ) || ( std::abs( v ) < std::abs( v_p ) ) ) ) {
-			Real const d( X_1( t ) );
-			if ( d == 0.0 ) break;
-			t -= m * ( v / d );
-			fmu_set_time( t );
-			v = z_0( t );
-			if ( std::abs( v ) >= std::abs( v_p ) ) m *= 0.5; // Non-converging step: Reduce step size
-			v_p = v;
+		std::size_t n( 0u ); // FMU evaluations
+		auto const z( [this,&n]( Time const t ) -> Real { ++n; fmu_set_time( t ); return z_0( t ); } ); // FMU zero-crossing function value
+		Real const vZ( z( tZ ) ); // Validate trajectory root
+		Root< Real > root( tZ, vZ, aTol );
+		if ( !root ) { // Refine
+			Time a( tBeg ), b( tZ );
+			Real fa( x( tBeg ) ), fb( vZ ); // Trajectory value before the root is a proxy for the function sign
+			if ( fa == 0.0 ) fa = x( a + ( 0.5 * ( b - a ) ) ); // Starting on a root: Use trajectory midway to the predicted root
+			bool bracketed( ( a < b ) && signs_differ( fa, fb ) );
+			if ( !bracketed ) { // Function not crossed by tZ: Step forward from tZ using the trajectory slope as a proxy
+				Real const s( x1( tZ ) );
+				Time dt( ( s != 0.0 ) && signs_differ( s, vZ ) ? -( vZ / s ) : tZ - tBeg ); // Proxy Newton step else prior interval
+				Time const tMax( std::min( tE, fmu_get_tE() ) ); // Search doesn't go past the variable or simulation end time
+				while ( ( n < options::refineCalls ) && ( dt > 0.0 ) && ( b < tMax ) ) {
+					Time const c( std::min( b + dt, tMax ) );
+					if ( c == b ) break; // Step below time resolution
+					Real const fc( z( c ) );
+					if ( std::abs( fc ) < std::abs( root.v ) ) root = Root< Real >( c, fc, aTol );
+					if ( root ) break; // Converged
+					a = b;
+					fa = fb;
+					b = c;
+					fb = fc;
+					if ( signs_differ( fa, fb ) ) {
+						bracketed = true;
+						break;
+					}
+					dt *= 2.0; // Expand search
+				}
+			}
+			if ( bracketed && !root && ( n < options::refineCalls ) ) root = illinois_root( z, a, b, fa, fb, root, aTol, options::refineCalls - n );
 		}
-		if ( ( t >= tBeg ) && ( std::abs( v ) < std::abs( vZ ) ) ) tZ = t;
-		if ( ( j == n ) && ( options::output::d ) ) std::cout << "   " << name() << '(' << t << ')' << " tZ may not have converged" << std::endl;
+		if ( ( root.x >= tBeg ) && ( std::abs( root.v ) < std::abs( vZ ) ) ) tZ = root.x;
+		if ( ( !root ) && ( options::output::d ) ) std::cout << "   " << name() << '(' << root.x << ')' << " tZ may not have converged" << std::endl;
+		++n_root_refines_;
+		n_root_refine_calls_ += n;
 		fmu_set_time( t_fmu );
 	}
 
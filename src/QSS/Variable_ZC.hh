@@ -38,6 +38,7 @@
 
 // QSS Headers
 #include <QSS/Variable.hh>
+#include <QSS/ChatterDetector.hh>
 #include <QSS/Conditional.hh>
 
 namespace QSS {
@@ -51,6 +52,7 @@ public: // Types
 	using Super = Variable;
 
 	using Crossings = std::vector< Crossing >;
+	using Variable_ZCs = std::vector< Variable_ZC * >;
 
 protected: // Creation
 
@@ -74,7 +76,9 @@ protected: // Creation
 	) :
 	 Super( fmu_me, order, name, rTol_, aTol_, zTol_, xIni_, var, der ),
 	 ei_index( var.iei ),
-	 zChatter_( zTol_ > 0.0 )
+	 zChatter_( zTol_ > 0.0 ),
+	 zHys_( zTol ),
+	 chatter_( options::zChatter, options::zChatterDt )
 	{
 		assert( var.is_EventIndicator() );
 		add_crossings_Dn_Up(); // FMI API doesn't currently expose crossing information
@@ -190,6 +194,62 @@ public: // Property
 	Time
 	tZC_bump( Time const t ) const = 0;
 
+	// Zero-Crossing Root Solves
+	size_type
+	n_root_solves() const
+	{
+		return n_root_solves_;
+	}
+
+	// Zero-Crossing Root Solves Culled by Interval Bound
+	size_type
+	n_root_culls() const
+	{
+		return n_root_culls_;
+	}
+
+	// Chattering Interventions
+	size_type
+	n_chatter() const
+	{
+		return n_chatter_;
+	}
+
+	// Anti-Chatter Hysteresis
+	Real
+	zHys() const
+	{
+		return zHys_;
+	}
+
+	// Zero-Crossing Root Refinements
+	size_type
+	n_root_refines() const
+	{
+		return n_root_refines_;
+	}
+
+	// Zero-Crossing Root Refinement FMU Evaluations
+	size_type
+	n_root_refine_calls() const
+	{
+		return n_root_refine_calls_;
+	}
+
+	// Zero-Crossing Variables Whose FMU Detection is Affected by Bumping this Variable
+	Variable_ZCs const &
+	bump_peers() const
+	{
+		return bump_peers_;
+	}
+
+	// Zero-Crossing Variables Whose FMU Detection is Affected by Bumping this Variable
+	Variable_ZCs &
+	bump_peers()
+	{
+		return bump_peers_;
+	}
+
 public: // Methods
 
 	// Add an Observer Variable
@@ -265,6 +325,49 @@ public: // Zero-Crossing Methods
 		( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
 	}
 
+protected: // Zero-Crossing Methods
+
+	// Zero-Crossing Root Solve on [tB,tE] Culled? Trajectory Coefficients Shifted to tB in Descending Order
+	template< typename... Coefficients >
+	bool
+	root_culled( Time const tB, Coefficients const... coefficients )
+	{
+		++n_root_solves_;
+		if ( ( tE != infinity ) && zc_root_excluded( coefficients..., std::nextafter( tE, infinity ) - tB ) ) { // No sign change possible before tE (including roots that round to tE)
+			++n_root_culls_;
+			return true;
+		}
+		return false;
+	}
+
+public: // Zero-Crossing Methods
+
+	// Chattering Check at Zero Crossing: Widen Anti-Chatter Hysteresis if Crossings Reverse Rapidly and Relax it Once They Stop
+	//  Only the crossing culling and root solves use the widened hysteresis: zTol and the FMU detection bump are unchanged
+	void
+	chatter_check()
+	{
+		if ( !chatter_.on() ) return;
+		Real const zHys_b( zTol > 0.0 ? zTol : aTol ); // Base hysteresis
+		if ( chatter_.crossing( tZ, crossing > Crossing::Flat ? +1 : ( crossing < Crossing::Flat ? -1 : 0 ) ) ) { // Chattering
+			zHys_ = std::min( ( zHys_ > 0.0 ? zHys_ * options::zChatterMul : zHys_b ), zHys_b * options::zChatterMax ); // Crossings are culled until the trajectory magnitude since the last crossing reaches zHys_
+			zChatter_ = true;
+			tChatter_ = tZ;
+			++n_chatter_;
+			if ( options::output::d ) std::cout << "Z  " << name() << '(' << tZ << ')' << " chattering: zHys=" << zHys_ << std::endl;
+		} else if ( ( zHys_ > zTol ) && ( tZ - tChatter_ > chatter_.dt() ) ) { // Quiet since last change: Relax
+			Real const zHys_r( zHys_ / options::zChatterMul );
+			if ( zHys_r < zHys_b ) { // Restore original hysteresis
+				zHys_ = zTol;
+				zChatter_ = ( zTol > 0.0 );
+			} else {
+				zHys_ = zHys_r;
+			}
+			tChatter_ = tZ;
+			if ( options::output::d ) std::cout << "Z  " << name() << '(' << tZ << ')' << " chattering relaxed: zHys=" << zHys_ << std::endl;
+		}
+	}
+
 public: // Crossing Methods
 
 	// Add Crossing Type
@@ -430,6 +533,7 @@ public: // Data
 protected: // Data
 
 	bool zChatter_{ false }; // Zero-crossing chatter control active?
+	Real zHys_{ 0.0 }; // Zero-crossing anti-chatter hysteresis: zTol widened by chattering interventions
 	bool passive_{ false }; // Passive?
 	Real x_mag_{ 0.0 }; // Max trajectory magnitude since last zero crossing
 	bool check_crossing_{ false }; // Check for zero crossing?
@@ -437,10 +541,18 @@ protected: // Data
 	int sign_old_{ 0 }; // Sign of zero-crossing function before advance
 	mutable bool handler_modified_{ false }; // Did last handler modify this value?
 	mutable Real x_0_bump_{ 0.0 }; // Last bumped value
+	size_type n_root_solves_{ 0u }; // Zero-crossing root solves
+	size_type n_root_culls_{ 0u }; // Zero-crossing root solves culled by interval bound
+	size_type n_root_refines_{ 0u }; // Zero-crossing root refinements
+	size_type n_root_refine_calls_{ 0u }; // Zero-crossing root refinement FMU evaluations
+	size_type n_chatter_{ 0u }; // Chattering interventions
+	ChatterDetector chatter_; // Chattering detector
+	Time tChatter_{ neg_infinity }; // Time of last chattering hysteresis change
 
 private: // Data
 
 	Crossings crossings_; // Zero-crossing types handled
+	Variable_ZCs bump_peers_; // Zero-crossing variables sharing observees with this variable or observing its handlers (including this variable)
 
 }; // Variable_ZC
 
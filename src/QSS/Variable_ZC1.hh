@@ -193,6 +193,7 @@ public: // Methods
 		assert( in_conditional() );
 		conditional->activity( tZ );
 		crossing_last = crossing;
+		chatter_check();
 		x_mag_zero();
 		set_tZ( tZ_last = tZ ); // Next zero-crossing: Might be in active segment
 		( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
@@ -293,7 +294,7 @@ private: // Methods
 	set_tZ()
 	{
 		// Find root of continuous trajectory: Only robust for small active segments with continuous trajectory close to function
-		Time const dt( zc_root_linear( x_1_, x_0_, zTol, x_mag_ ) );
+		Time const dt( zc_root_linear( x_1_, x_0_, zHys_, x_mag_ ) );
 		assert( dt > 0.0 );
 		if ( dt != infinity ) { // Root exists
 			tZ = tX + dt;
@@ -326,7 +327,7 @@ private: // Methods
 	void
 	crossing_detect()
 	{
-		if ( zChatter_ && ( x_mag_ < zTol ) ) { // Anti-chatter => Don't check for crossing
+		if ( zChatter_ && ( x_mag_ < zHys_ ) ) { // Anti-chatter => Don't check for crossing
 			set_tZ();
 			( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
 		} else { // Maybe check for crossing
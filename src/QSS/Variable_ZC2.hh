@@ -114,7 +114,7 @@ public: // Property
 	Time
 	tZC_bump( Time const t ) const override
 	{
-		if ( zChatter_ ) {
+		if ( zTol > 0.0 ) {
 			Real const x_1_t( x_1_ + ( two * x_2_ * ( t - tX ) ) );
 			Real const bTol( options::zMul * zTol ); // Hope FMU detects the crossing at this bump tolerance
 			Time dt_bump;
@@ -231,6 +231,7 @@ public: // Methods
 		assert( in_conditional() );
 		conditional->activity( tZ );
 		crossing_last = crossing;
+		chatter_check();
 		x_mag_zero();
 		set_tZ( tZ_last = tZ ); // Next zero-crossing: Might be in active segment
 		( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
@@ -361,7 +362,7 @@ private: // Methods
 	set_tZ()
 	{
 		// Find root of continuous trajectory: Only robust for small active segments with continuous trajectory close to function
-		Time const dt( zc_root_quadratic( x_2_, x_1_, x_0_, zTol, x_mag_ ) );
+		Time const dt( root_culled( tX, x_2_, x_1_, x_0_ ) ? infinity : zc_root_quadratic( x_2_, x_1_, x_0_, zHys_, x_mag_ ) ); // Skip solve if no crossing possible before tE
 		assert( dt > 0.0 );
 		if ( dt != infinity ) { // Root exists
 			tZ = tX + dt;
@@ -390,7 +391,7 @@ private: // Methods
 		assert( dB >= 0.0 );
 		Real const x_0( ( tB == tZ_last ) && !( handler_modified_ = fmu_get_real() != x_0_bump_ ) ? 0.0 : x_0_ + ( x_1_ * dB ) + ( x_2_ * square( dB ) ) );
 		Real const x_1( x_1_ + ( two * x_2_ * dB ) );
-		Time const dt( zc_root_quadratic( x_2_, x_1, x_0, zTol, x_mag_ ) ); // Positive root using trajectory shifted to tB
+		Time const dt( root_culled( tB, x_2_, x_1, x_0 ) ? infinity : zc_root_quadratic( x_2_, x_1, x_0, zHys_, x_mag_ ) ); // Positive root using trajectory shifted to tB
 		assert( dt > 0.0 );
 		if ( dt != infinity ) { // Root exists
 			tZ = tB + dt;
@@ -414,7 +415,7 @@ private: // Methods
 	void
 	crossing_detect()
 	{
-		if ( zChatter_ && ( x_mag_ < zTol ) ) { // Anti-chatter => Don't check for crossing
+		if ( zChatter_ && ( x_mag_ < zHys_ ) ) { // Anti-chatter => Don't check for crossing
 			set_tZ();
 			( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
 		} else { // Maybe check for crossing
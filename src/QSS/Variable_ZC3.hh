@@ -284,6 +284,7 @@ public: // Methods
 		assert( in_conditional() );
 		conditional->activity( tZ );
 		crossing_last = crossing;
+		chatter_check();
 		x_mag_zero();
 		set_tZ( tZ_last = tZ ); // Next zero-crossing: Might be in active segment
 		( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
@@ -433,7 +434,7 @@ private: // Methods
 	set_tZ()
 	{
 		// Find root of continuous trajectory: Only robust for small active segments with continuous trajectory close to function
-		Time const dt( zc_root_cubic( x_3_, x_2_, x_1_, x_0_, zTol, x_mag_ ) );
+		Time const dt( root_culled( tX, x_3_, x_2_, x_1_, x_0_ ) ? infinity : zc_root_cubic( x_3_, x_2_, x_1_, x_0_, zHys_, x_mag_ ) ); // Skip solve if no crossing possible before tE
 		assert( dt > 0.0 );
 		if ( dt != infinity ) { // Root exists
 			tZ = tX + dt;
@@ -462,7 +463,7 @@ private: // Methods
 		assert( dB >= 0.0 );
 		Real const x_0( ( tB == tZ_last ) && !( handler_modified_ = fmu_get_real() != x_0_bump_ ) ? 0.0 : x_0_ + ( x_1_ * dB ) + ( x_2_ * square( dB ) ) );
 		Real const x_1( x_1_ + ( two * x_2_ * dB ) );
-		Time const dt( zc_root_cubic( x_3_, x_2_, x_1, x_0, zTol, x_mag_ ) ); // Positive root using trajectory shifted to tB
+		Time const dt( root_culled( tB, x_3_, x_2_, x_1, x_0 ) ? infinity : zc_root_cubic( x_3_, x_2_, x_1, x_0, zHys_, x_mag_ ) ); // Positive root using trajectory shifted to tB
 		assert( dt > 0.0 );
 		if ( dt != infinity ) { // Root exists
 			tZ = tB + dt;
@@ -486,7 +487,7 @@ private: // Methods
 	void
 	crossing_detect()
 	{
-		if ( zChatter_ && ( x_mag_ < zTol ) ) { // Anti-chatter => Don't check for crossing
+		if ( zChatter_ && ( x_mag_ < zHys_ ) ) { // Anti-chatter => Don't check for crossing
 			set_tZ();
 			( tE < tZ ) ? shift_QSS_ZC( tE ) : shift_ZC( tZ );
 		} else { // Maybe check for crossing
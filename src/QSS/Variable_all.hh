@@ -110,4 +110,234 @@
 // QSS Connection Variable Headers
 #include <QSS/Variable_Con.hh>
 
+// QSS Headers
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+
+namespace QSS {
+
+// Largest Variable Object Size
+inline constexpr std::size_t Variable_max_sizeof( std::max( {
+ sizeof( Variable_QSS1 ),
+ sizeof( Variable_QSS2 ),
+ sizeof( Variable_QSS3 ),
+ sizeof( Variable_LIQSS1 ),
+ sizeof( Variable_LIQSS2 ),
+ sizeof( Variable_LIQSS3 ),
+ sizeof( Variable_fQSS1 ),
+ sizeof( Variable_fQSS2 ),
+ sizeof( Variable_fQSS3 ),
+ sizeof( Variable_fLIQSS1 ),
+ sizeof( Variable_fLIQSS2 ),
+ sizeof( Variable_fLIQSS3 ),
+ sizeof( Variable_iLIQSS1 ),
+ sizeof( Variable_iLIQSS2 ),
+ sizeof( Variable_iLIQSS3 ),
+ sizeof( Variable_ifLIQSS1 ),
+ sizeof( Variable_ifLIQSS2 ),
+ sizeof( Variable_ifLIQSS3 ),
+ sizeof( Variable_rQSS2 ),
+ sizeof( Variable_rQSS3 ),
+ sizeof( Variable_rfQSS2 ),
+ sizeof( Variable_rfQSS3 ),
+ sizeof( Variable_nQSS2 ),
+ sizeof( Variable_nQSS3 ),
+ sizeof( Variable_nLIQSS2 ),
+ sizeof( Variable_nLIQSS3 ),
+ sizeof( Variable_nfQSS2 ),
+ sizeof( Variable_nfQSS3 ),
+ sizeof( Variable_nfLIQSS2 ),
+ sizeof( Variable_nfLIQSS3 ),
+ sizeof( Variable_niLIQSS2 ),
+ sizeof( Variable_niLIQSS3 ),
+ sizeof( Variable_nifLIQSS2 ),
+ sizeof( Variable_nifLIQSS3 ),
+ sizeof( Variable_nrQSS2 ),
+ sizeof( Variable_nrQSS3 ),
+ sizeof( Variable_nrfQSS2 ),
+ sizeof( Variable_nrfQSS3 ),
+ sizeof( Variable_time ),
+ sizeof( Variable_ZC1 ),
+ sizeof( Variable_ZC2 ),
+ sizeof( Variable_ZC3 ),
+ sizeof( Variable_B ),
+ sizeof( Variable_I ),
+ sizeof( Variable_D ),
+ sizeof( Variable_R1 ),
+ sizeof( Variable_R2 ),
+ sizeof( Variable_R3 ),
+ sizeof( Variable_BP ),
+ sizeof( Variable_IP ),
+ sizeof( Variable_DP ),
+ sizeof( Variable_RP ),
+ sizeof( Variable_Inp1 ),
+ sizeof( Variable_Inp2 ),
+ sizeof( Variable_Inp3 ),
+ sizeof( Variable_fInp1 ),
+ sizeof( Variable_fInp2 ),
+ sizeof( Variable_fInp3 ),
+ sizeof( Variable_InpB ),
+ sizeof( Variable_InpD ),
+ sizeof( Variable_InpI ),
+ sizeof( Variable_Con )
+} ) );
+
+// Largest Variable Object Size Constructed for a QSS Method and Order
+inline
+std::size_t
+Variable_max_sizeof_of( options::QSS const qss, int const order, bool const fQSS )
+{
+	std::size_t s( std::max( { // Types constructed for any method
+	 sizeof( Variable_time ),
+	 sizeof( Variable_B ),
+	 sizeof( Variable_I ),
+	 sizeof( Variable_D ),
+	 sizeof( Variable_BP ),
+	 sizeof( Variable_IP ),
+	 sizeof( Variable_DP ),
+	 sizeof( Variable_RP ),
+	 sizeof( Variable_InpB ),
+	 sizeof( Variable_InpD ),
+	 sizeof( Variable_InpI ),
+	 sizeof( Variable_Con )
+	} ) );
+	switch ( order ) { // Zero-crossing, real, and input types of the method order
+	case 1:
+		s = std::max( { s, sizeof( Variable_ZC1 ), sizeof( Variable_R1 ), ( fQSS ? sizeof( Variable_fInp1 ) : sizeof( Variable_Inp1 ) ) } );
+		break;
+	case 2:
+		s = std::max( { s, sizeof( Variable_ZC2 ), sizeof( Variable_R2 ), ( fQSS ? sizeof( Variable_fInp2 ) : sizeof( Variable_Inp2 ) ) } );
+		break;
+	case 3:
+		s = std::max( { s, sizeof( Variable_ZC3 ), sizeof( Variable_R3 ), ( fQSS ? sizeof( Variable_fInp3 ) : sizeof( Variable_Inp3 ) ) } );
+		break;
+	default:
+		return Variable_max_sizeof;
+	}
+	switch ( qss ) { // State type of the method
+	case options::QSS::QSS1:
+		s = std::max( s, sizeof( Variable_QSS1 ) );
+		break;
+	case options::QSS::QSS2:
+		s = std::max( s, sizeof( Variable_QSS2 ) );
+		break;
+	case options::QSS::QSS3:
+		s = std::max( s, sizeof( Variable_QSS3 ) );
+		break;
+	case options::QSS::LIQSS1:
+		s = std::max( s, sizeof( Variable_LIQSS1 ) );
+		break;
+	case options::QSS::LIQSS2:
+		s = std::max( s, sizeof( Variable_LIQSS2 ) );
+		break;
+	case options::QSS::LIQSS3:
+		s = std::max( s, sizeof( Variable_LIQSS3 ) );
+		break;
+	case options::QSS::fQSS1:
+		s = std::max( s, sizeof( Variable_fQSS1 ) );
+		break;
+	case options::QSS::fQSS2:
+		s = std::max( s, sizeof( Variable_fQSS2 ) );
+		break;
+	case options::QSS::fQSS3:
+		s = std::max( s, sizeof( Variable_fQSS3 ) );
+		break;
+	case options::QSS::fLIQSS1:
+		s = std::max( s, sizeof( Variable_fLIQSS1 ) );
+		break;
+	case options::QSS::fLIQSS2:
+		s = std::max( s, sizeof( Variable_fLIQSS2 ) );
+		break;
+	case options::QSS::fLIQSS3:
+		s = std::max( s, sizeof( Variable_fLIQSS3 ) );
+		break;
+	case options::QSS::iLIQSS1:
+		s = std::max( s, sizeof( Variable_iLIQSS1 ) );
+		break;
+	case options::QSS::iLIQSS2:
+		s = std::max( s, sizeof( Variable_iLIQSS2 ) );
+		break;
+	case options::QSS::iLIQSS3:
+		s = std::max( s, sizeof( Variable_iLIQSS3 ) );
+		break;
+	case options::QSS::ifLIQSS1:
+		s = std::max( s, sizeof( Variable_ifLIQSS1 ) );
+		break;
+	case options::QSS::ifLIQSS2:
+		s = std::max( s, sizeof( Variable_ifLIQSS2 ) );
+		break;
+	case options::QSS::ifLIQSS3:
+		s = std::max( s, sizeof( Variable_ifLIQSS3 ) );
+		break;
+	case options::QSS::rQSS2:
+		s = std::max( s, sizeof( Variable_rQSS2 ) );
+		break;
+	case options::QSS::rQSS3:
+		s = std::max( s, sizeof( Variable_rQSS3 ) );
+		break;
+	case options::QSS::rfQSS2:
+		s = std::max( s, sizeof( Variable_rfQSS2 ) );
+		break;
+	case options::QSS::rfQSS3:
+		s = std::max( s, sizeof( Variable_rfQSS3 ) );
+		break;
+	case options::QSS::nQSS2:
+		s = std::max( s, sizeof( Variable_nQSS2 ) );
+		break;
+	case options::QSS::nQSS3:
+		s = std::max( s, sizeof( Variable_nQSS3 ) );
+		break;
+	case options::QSS::nLIQSS2:
+		s = std::max( s, sizeof( Variable_nLIQSS2 ) );
+		break;
+	case options::QSS::nLIQSS3:
+		s = std::max( s, sizeof( Variable_nLIQSS3 ) );
+		break;
+	case options::QSS::nfQSS2:
+		s = std::max( s, sizeof( Variable_nfQSS2 ) );
+		break;
+	case options::QSS::nfQSS3:
+		s = std::max( s, sizeof( Variable_nfQSS3 ) );
+		break;
+	case options::QSS::nfLIQSS2:
+		s = std::max( s, sizeof( Variable_nfLIQSS2 ) );
+		break;
+	case options::QSS::nfLIQSS3:
+		s = std::max( s, sizeof( Variable_nfLIQSS3 ) );
+		break;
+	case options::QSS::niLIQSS2:
+		s = std::max( s, sizeof( Variable_niLIQSS2 ) );
+		break;
+	case options::QSS::niLIQSS3:
+		s = std::max( s, sizeof( Variable_niLIQSS3 ) );
+		break;
+	case options::QSS::nifLIQSS2:
+		s = std::max( s, sizeof( Variable_nifLIQSS2 ) );
+		break;
+	case options::QSS::nifLIQSS3:
+		s = std::max( s, sizeof( Variable_nifLIQSS3 ) );
+		break;
+	case options::QSS::nrQSS2:
+		s = std::max( s, sizeof( Variable_nrQSS2 ) );
+		break;
+	case options::QSS::nrQSS3:
+		s = std::max( s, sizeof( Variable_nrQSS3 ) );
+		break;
+	case options::QSS::nrfQSS2:
+		s = std::max( s, sizeof( Variable_nrfQSS2 ) );
+		break;
+	case options::QSS::nrfQSS3:
+		s = std::max( s, sizeof( Variable_nrfQSS3 ) );
+		break;
+	default:
+		return Variable_max_sizeof;
+	}
+	return s;
+}
+
+} // QSS
+
 #endif
@@ -0,0 +1,229 @@
+// QSS Computational Observers and Observees
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_computational_hh_INCLUDED
+#define QSS_computational_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/CSR.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace QSS {
+
+// Computational observers and observees short-circuit the passive variables of the dependency graph
+// They are found here for all variables by per-variable traversals of a compact index graph that follow
+// the traversal rules of the recursive finders: Visit marks are epoch stamps so no per-query set is built
+
+// Variable Node Indexes
+template< typename Variable >
+std::unordered_map< Variable const *, std::uint32_t >
+variable_indexes( typename Variable::Variables const & vars )
+{
+	std::unordered_map< Variable const *, std::uint32_t > var_idx;
+	var_idx.reserve( vars.size() );
+	for ( std::uint32_t i = 0u, n = std::uint32_t( vars.size() ); i < n; ++i ) var_idx.emplace( vars[ i ], i );
+	return var_idx;
+}
+
+// Variables of Sorted Unique Node Indexes
+template< typename Variable >
+typename Variable::Variables
+indexed_variables(
+ typename Variable::Variables const & vars,
+ std::vector< std::uint32_t > & idxs
+)
+{
+	std::sort( idxs.begin(), idxs.end() );
+	idxs.erase( std::unique( idxs.begin(), idxs.end() ), idxs.end() );
+	typename Variable::Variables result;
+	result.reserve( idxs.size() );
+	for ( std::uint32_t const i : idxs ) result.push_back( vars[ i ] );
+	return result;
+}
+
+// Computational Observees of Variables: States and Inputs Reachable Through Non-State Non-Input Observees
+template< typename Variable >
+void
+computational_observees(
+ typename Variable::Variables const & vars, // All variables
+ std::vector< typename Variable::Variables > & observees // Computational observees of each variable
+)
+{
+	using Index = std::uint32_t;
+	using Graph = CSR< Index >;
+	using const_iterator = typename Graph::const_iterator;
+	Index const n( Index( vars.size() ) );
+	auto const var_idx( variable_indexes< Variable >( vars ) );
+
+	// Observee graph
+	std::vector< bool > marked( n ); // States and inputs: Traversal stops at them
+	typename Graph::Edges edges;
+	for ( Index i = 0u; i < n; ++i ) {
+		Variable const * var( vars[ i ] );
+		marked[ i ] = var->is_state() || var->is_Input();
+		for ( Variable const * observee : var->observees() ) {
+			auto const j( var_idx.find( observee ) );
+			assert( j != var_idx.end() );
+			if ( j != var_idx.end() ) edges.emplace_back( i, j->second );
+		}
+	}
+	Graph const g( n, edges );
+	edges.clear(); edges.shrink_to_fit();
+
+	// Computational observees of each variable from its direct observees
+	observees.clear();
+	observees.resize( n );
+	std::int64_t const n_vars( n );
+	#pragma omp parallel if ( n_vars >= 1024 )
+	{
+		std::vector< Index > stamp( n, 0u ); // Query that last visited each node
+		Index epoch( 0u );
+		struct Frame { const_iterator i, e; }; // Observees left to process
+		std::vector< Frame > stack;
+		std::vector< Index > idxs;
+		#pragma omp for schedule(static)
+		for ( std::int64_t i = 0; i < n_vars; ++i ) {
+			++epoch;
+			idxs.clear();
+			stack.push_back( Frame{ g.begin( Index( i ) ), g.end( Index( i ) ) } );
+			while ( !stack.empty() ) {
+				Frame & f( stack.back() );
+				if ( f.i == f.e ) {
+					stack.pop_back();
+					continue;
+				}
+				Index const w( *f.i++ );
+				if ( stamp[ w ] == epoch ) continue; // Already processed
+				stamp[ w ] = epoch;
+				if ( marked[ w ] ) { // State or input => Computational
+					idxs.push_back( w );
+				} else { // Traverse dependency sub-graph
+					stack.push_back( Frame{ g.begin( w ), g.end( w ) } );
+				}
+			}
+			observees[ i ] = indexed_variables< Variable >( vars, idxs ); // Self observee is kept
+		}
+	}
+}
+
+// Computational Observers of Triggers: Active Variables Reachable Through Observers
+//  Traversal follows find_computational_observers: Depth-first in observer order with one checked mark per variable,
+//  stopping at the trigger and at zero-crossing variables and extending only with x-based (non-state) observers past a QSS variable
+template< typename Variable >
+void
+computational_observers(
+ typename Variable::Variables const & vars, // All variables
+ typename Variable::Variables const & triggers, // Variables to find computational observers for
+ std::vector< typename Variable::Variables > & observers // Computational observers of each trigger
+)
+{
+	using Index = std::uint32_t;
+	using Graph = CSR< Index >;
+	using const_iterator = typename Graph::const_iterator;
+	Index const n( Index( vars.size() ) );
+	auto const var_idx( variable_indexes< Variable >( vars ) );
+
+	// Observer graph in observer order with variable traversal properties
+	std::vector< bool > active( n ), qss( n ), zc( n ), state( n );
+	typename Graph::Edges edges;
+	for ( Index i = 0u; i < n; ++i ) {
+		Variable const * var( vars[ i ] );
+		active[ i ] = var->is_Active();
+		qss[ i ] = var->is_QSS();
+		zc[ i ] = !var->not_ZC();
+		state[ i ] = !var->not_State();
+		for ( Variable const * observer : var->observers().observers() ) {
+			auto const j( var_idx.find( observer ) );
+			assert( j != var_idx.end() );
+			if ( j != var_idx.end() ) edges.emplace_back( i, j->second );
+		}
+	}
+	Graph const g( n, edges ); // Edge order within each node is kept
+	edges.clear(); edges.shrink_to_fit();
+
+	// Computational observers of each trigger: Trigger is not its own computational observer
+	observers.clear();
+	observers.resize( triggers.size() );
+	std::int64_t const n_triggers( triggers.size() );
+	#pragma omp parallel if ( n_triggers >= 1024 )
+	{
+		std::vector< Index > stamp( n, 0u ); // Query that last checked each node
+		Index epoch( 0u );
+		struct Frame { const_iterator i, e; bool x; }; // Observers left to process and x-based mode
+		std::vector< Frame > stack;
+		std::vector< Index > idxs;
+		#pragma omp for schedule(static)
+		for ( std::int64_t k = 0; k < n_triggers; ++k ) {
+			auto const tr( var_idx.find( triggers[ k ] ) );
+			assert( tr != var_idx.end() );
+			if ( tr == var_idx.end() ) continue;
+			Index const t( tr->second );
+			++epoch;
+			idxs.clear();
+			stack.push_back( Frame{ g.begin( t ), g.end( t ), false } );
+			while ( !stack.empty() ) {
+				Frame & f( stack.back() );
+				if ( f.i == f.e ) {
+					stack.pop_back();
+					continue;
+				}
+				Index const o( *f.i++ );
+				bool const x( f.x );
+				if ( x && state[ o ] ) continue; // Only x-based observers past a QSS variable
+				if ( stamp[ o ] == epoch ) continue; // Observer already processed
+				stamp[ o ] = epoch;
+				if ( o == t ) continue; // Trigger isn't a computational observer
+				if ( active[ o ] ) idxs.push_back( o ); // Active => Computational
+				if ( x || qss[ o ] ) { // Extend with its x-based observers
+					stack.push_back( Frame{ g.begin( o ), g.end( o ), true } );
+				} else if ( !zc[ o ] ) { // Extend with its observers
+					stack.push_back( Frame{ g.begin( o ), g.end( o ), false } );
+				}
+			}
+			observers[ k ] = indexed_variables< Variable >( vars, idxs );
+		}
+	}
+}
+
+} // QSS
+
+#endif
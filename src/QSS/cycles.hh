@@ -36,150 +36,89 @@
 #ifndef QSS_cycles_hh_INCLUDED
 #define QSS_cycles_hh_INCLUDED
 
+// QSS Headers
+#include <QSS/CSR.hh>
+#include <QSS/scc.hh>
+
 // C++ Headers
 #include <cassert>
-#include <deque>
+#include <cstdint>
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 namespace QSS {
 
 // QSS Dependency Cycle Detection
+//  Graph is built in CSR form via a variable index map: O( Variables + Dependencies )
+//  Strongly connected components prefilter the search: Acyclic graphs are done without a traversal
+//  The depth-first traversal visits each variable once and reports the active branch at each back edge
 template< typename Variable, typename Variable_ZC >
 void
 cycles( typename Variable::Variables const & vars )
 {
-
-	// Node Type
-	struct Node
-	{
-
-	public: // Types
-
-		using Observers = std::vector< Node * >;
-		enum class State { None, Stack, Done };
-
-	public: // Creation
-
-		// Constructor
-		explicit
-		Node( Variable const * var ) :
-		 var( var )
-		{}
-
-	public: // Property
-
-		// Active Child Node
-		Node *
-		child()
-		{
-			return i != observers.end() ? *i : nullptr;
-		}
-
-	public: // Methods
-
-		// Enter Node in DFS Traversal
-		void
-		enter()
-		{
-			state = Node::State::Stack; // Mark node as on active DFS branch
-			i = observers.begin(); // Initialize child iterator
-		}
-
-		// Advance Child Iterator in DFS Traversal
-		bool
-		advance_child()
-		{
-			assert( !observers.empty() );
-			return ++i != observers.end();
-		}
-
-	public: // Data
-
-		Variable const * var{ nullptr };
-		State state{ State::None };
-		Observers observers;
-		typename Observers::const_iterator i;
-
-	}; // Node
-
 	// Types
-	using Nodes = std::vector< Node >;
+	using Index = std::uint32_t;
+	using Graph = CSR< Index >;
+	using Indexes = std::vector< Index >;
+	using const_iterator = typename Graph::const_iterator;
 
 	// Create graph
-	Nodes nodes;
-	for ( Variable const * var : vars ) { // Add nodes
-		nodes.emplace_back( var );
-	}
-	for ( Node & node : nodes ) { // Add directed edges
-		for ( Variable const * obs : node.var->observers() ) {
-			node.observers.push_back( &*std::find_if( nodes.begin(), nodes.end(), [obs]( Node const & n ){ return n.var == obs; } ) );
+	Index const n( Index( vars.size() ) );
+	std::unordered_map< Variable const *, Index > var_idx; // Variable node indexes
+	var_idx.reserve( n );
+	for ( Index i = 0u; i < n; ++i ) var_idx.emplace( vars[ i ], i );
+	typename Graph::Edges edges; // Directed edges
+	bool self_loop( false ); // Any self-dependency?
+	auto add_edge = [ &var_idx, &edges, &self_loop ]( Index const i, Variable const * var ){
+		auto const j( var_idx.find( var ) );
+		assert( j != var_idx.end() );
+		if ( j != var_idx.end() ) {
+			edges.emplace_back( i, j->second );
+			if ( j->second == i ) self_loop = true;
 		}
-		if ( node.var->is_ZC() ) {
-			Variable_ZC const * zc( static_cast< Variable_ZC const * >( node.var ) );
+	};
+	for ( Index i = 0u; i < n; ++i ) { // Add directed edges
+		Variable const * var( vars[ i ] );
+		for ( Variable const * obs : var->observers() ) add_edge( i, obs );
+		if ( var->is_ZC() ) {
+			Variable_ZC const * zc( static_cast< Variable_ZC const * >( var ) );
 			if ( zc->in_conditional() ) { // Short-circuit conditional dependencies
-				for ( Variable const * mod : zc->conditional->observers() ) {
-					node.observers.push_back( &*std::find_if( nodes.begin(), nodes.end(), [mod]( Node const & n ){ return n.var == mod; } ) );
-				}
+				for ( Variable const * mod : zc->conditional->observers() ) add_edge( i, mod );
 			}
 		}
 	}
-
-	// Traverse graph via non-recursive DFS and detect cycles
-	enum class Step { Push, Pop };
-	Step step( Step::Push );
-	using Branch = std::deque< Node * >;
-	Branch branch;
-	for ( Node & root : nodes ) {
-		if ( root.state == Node::State::None ) { // DFS traversal from this root
-			assert( branch.empty() );
-			branch.push_front( &root );
-			step = Step::Push;
-			Node * node( &root );
-			while ( !branch.empty() ) {
-				if ( node->state == Node::State::None ) { // First visit to node
-					assert( step == Step::Push );
-					node->enter();
-					Node * child( node->child() );
-					if ( child != nullptr ) { // Move down branch to first child
-						node = child;
-						branch.push_front( node );
-					} else { // No more children: Move up
-						node->state = Node::State::Done;
-						branch.pop_front();
-						step = Step::Pop;
-						node = !branch.empty() ? branch.front() : nullptr;
-					}
-				} else if ( node->state == Node::State::Stack ) { // Revisiting node on branch
-					if ( step == Step::Push ) { // Cycle detected
-						std::cerr << "\nVariable dependency cycle present:" << std::endl;
-						bool active( false );
-						for ( typename Branch::const_iterator i = branch.begin(); i != branch.end(); ++i ) {
-							if ( ( !active ) && ( *i == node ) ) active = true;
-							if ( active ) std::cerr << ' ' << (*i)->var->name() << std::endl;
-						}
-						branch.pop_front();
-						step = Step::Pop;
-						node = !branch.empty() ? branch.front() : nullptr;
-					} else { // Moved up from child
-						assert( step == Step::Pop );
-						if ( node->advance_child() ) { // Move down branch to next child
-							node = node->child();
-							branch.push_front( node );
-							step = Step::Push;
-						} else { // No more children: Move up
-							node->state = Node::State::Done;
-							branch.pop_front();
-							step = Step::Pop;
-							node = !branch.empty() ? branch.front() : nullptr;
-						}
-					}
-				} else { // Move up branch
-					assert( node->state == Node::State::Done );
-					branch.pop_front();
-					step = Step::Pop;
-					node = !branch.empty() ? branch.front() : nullptr;
+	Graph const g( n, edges );
+	edges.clear(); edges.shrink_to_fit();
+
+	// Strongly connected components prefilter
+	Indexes comp;
+	if ( ( !self_loop ) && ( scc( g, comp ) == n ) ) return; // No cycles
+
+	// Traverse graph via non-recursive DFS and report the branch at each back edge
+	enum class State : std::uint8_t { None, Stack, Done };
+	std::vector< State > state( n, State::None );
+	struct Frame { Index v; const_iterator e; }; // DFS branch frame: Node and next edge
+	std::vector< Frame > branch;
+	for ( Index root = 0u; root < n; ++root ) {
+		if ( state[ root ] != State::None ) continue;
+		state[ root ] = State::Stack;
+		branch.push_back( Frame{ root, g.begin( root ) } );
+		while ( !branch.empty() ) {
+			Index const v( branch.back().v );
+			if ( branch.back().e != g.end( v ) ) { // Next child
+				Index const w( *branch.back().e++ );
+				if ( state[ w ] == State::None ) { // Move down branch
+					state[ w ] = State::Stack;
+					branch.push_back( Frame{ w, g.begin( w ) } );
+				} else if ( state[ w ] == State::Stack ) { // Cycle detected
+					std::cerr << "\nVariable dependency cycle present:" << std::endl;
+					std::cerr << ' ' << vars[ w ]->name() << std::endl;
+					for ( auto i = branch.rbegin(); i != branch.rend(); ++i ) std::cerr << ' ' << vars[ i->v ]->name() << std::endl;
 				}
+			} else { // No more children: Move up
+				state[ v ] = State::Done;
+				branch.pop_back();
 			}
 		}
 	}
@@ -37,163 +37,96 @@
 #define QSS_dependency_clusters_hh_INCLUDED
 
 // QSS Headers
+#include <QSS/CSR.hh>
 #include <QSS/options.hh>
+#include <QSS/scc.hh>
 
 // C++ Headers
 #include <cassert>
-#include <deque>
+#include <cstdint>
 #include <iostream>
+#include <limits>
+#include <unordered_map>
 #include <vector>
 
 namespace QSS {
 
 // QSS State Dependency Cycle Clusters
+//  Graph is built in CSR form via a variable index map: O( States + Dependencies )
+//  Strongly connected components prefilter the search: Cycles are enumerated only within each multi-variable component
+//  Each variable is clustered with the variables sharing a dependency cycle with it
 template< typename Variable, typename Variable_QSS >
 void
 dependency_clusters( typename Variable_QSS::Variables_QSS & vars )
 {
-
-	// Node
-	struct Node
-	{
-
-	public: // Types
-
-		using Observees = std::vector< Node * >;
-		enum class State { None, Stack };
-
-	public: // Creation
-
-		// Constructor
-		explicit
-		Node( Variable_QSS * var ) :
-		 var( var )
-		{}
-
-	public: // Property
-
-		// Active Child Node
-		Node *
-		child()
-		{
-			return i != observees.end() ? *i : nullptr;
-		}
-
-	public: // Methods
-
-		// Enter Node in DFS Traversal
-		void
-		enter()
-		{
-			state = Node::State::Stack; // Mark node as on active DFS branch
-			i = observees.begin(); // Initialize child iterator
-			entered = true;
-		}
-
-		// Advance Child Iterator in DFS Traversal
-		bool
-		advance_child()
-		{
-			assert( !observees.empty() );
-			return ++i != observees.end();
-		}
-
-		// Leave Node in DFS Traversal
-		void
-		leave()
-		{
-			state = Node::State::None; // Mark node as not on active DFS branch
-		}
-
-	public: // Data
-
-		bool entered{ false };
-		Variable_QSS * var{ nullptr };
-		State state{ State::None };
-		Observees observees;
-		typename Observees::iterator i;
-
-	}; // Node
-
 	// Types
-	using Nodes = std::vector< Node >; //Do Use a set for sufficiently large models
+	using Index = std::uint32_t;
+	using Graph = CSR< Index >;
+	using Indexes = std::vector< Index >;
+	using const_iterator = typename Graph::const_iterator;
 
 	// Create graph
-	Nodes nodes;
+	typename Variable_QSS::Variables_QSS nodes; // State variable nodes
 	for ( Variable_QSS * var : vars ) { // Add nodes
-		if ( var->is_State() ) nodes.emplace_back( var );
+		if ( var->is_State() ) nodes.push_back( var );
 	}
-	for ( Node & node : nodes ) { // Add directed edges
-		for ( Variable * obs : node.var->observees() ) {
+	Index const n( Index( nodes.size() ) );
+	std::unordered_map< Variable const *, Index > var_idx; // Variable node indexes
+	var_idx.reserve( n );
+	for ( Index i = 0u; i < n; ++i ) var_idx.emplace( nodes[ i ], i );
+	typename Graph::Edges edges; // Directed edges
+	for ( Index i = 0u; i < n; ++i ) { // Add directed edges
+		for ( Variable * obs : nodes[ i ]->observees() ) {
 			assert( ( obs->is_State() ) || ( obs->is_Input() ) ); // This should be run after variable observees are changed to computational observees
-			if ( obs->is_State() ) node.observees.push_back( &*std::find_if( nodes.begin(), nodes.end(), [obs]( Node const & n ){ return n.var == obs; } ) );
+			if ( obs->is_State() ) {
+				auto const j( var_idx.find( obs ) );
+				assert( j != var_idx.end() );
+				if ( j != var_idx.end() ) edges.emplace_back( i, j->second );
+			}
 		}
 	}
-
-	// Traverse graph via non-recursive DFS and detect cycles
-	enum class Step { Push, Pop };
-	Step step( Step::Push );
-	using Branch = std::deque< Node * >;
-	Branch branch;
-	for ( Node & root : nodes ) {
-		assert( branch.empty() );
-		if ( root.entered ) continue; // Don't need to search from root that has already been entered
-		branch.push_front( &root );
-		step = Step::Push;
-		Node * node( &root );
+	Graph const g( n, edges );
+	edges.clear(); edges.shrink_to_fit();
+
+	// Strongly connected components
+	Indexes comp;
+	Index const n_comp( scc( g, comp ) );
+	Indexes off, members;
+	scc_members( comp, n_comp, off, members );
+
+	// Enumerate the cycles of each multi-variable component via non-recursive DFS over its simple paths
+	Index const none( std::numeric_limits< Index >::max() );
+	Indexes pos( n, none ); // Node positions on the active branch
+	struct Frame { Index v; const_iterator e; }; // DFS branch frame: Node and next edge
+	std::vector< Frame > branch;
+	for ( Index c = 0u; c < n_comp; ++c ) {
+		if ( off[ c + 1u ] - off[ c ] < 2u ) continue; // Singleton: No cluster
+		Index const root( members[ off[ c ] ] ); // All cycles of the component are reachable from any member
+		pos[ root ] = 0u;
+		branch.push_back( Frame{ root, g.begin( root ) } );
 		while ( !branch.empty() ) {
-			if ( node->state == Node::State::None ) { // Node not on active branch
-				assert( step == Step::Push );
-				node->enter();
-				Node * child( node->child() );
-				if ( child == nullptr ) { // No more children: Move up
-					node->leave();
-					branch.pop_front();
-					step = Step::Pop;
-					node = !branch.empty() ? branch.front() : nullptr;
-				} else { // Move down branch to first child
-					node = child;
-					branch.push_front( node );
-				}
-			} else if ( node->state == Node::State::Stack ) { // Node on active branch
-				if ( step == Step::Push ) { // Cycle detected
+			Index const v( branch.back().v );
+			if ( branch.back().e != g.end( v ) ) { // Next child
+				Index const w( *branch.back().e++ );
+				if ( comp[ w ] != c ) continue; // Cycles stay within the component
+				if ( pos[ w ] == none ) { // Move down branch
+					pos[ w ] = Index( branch.size() );
+					branch.push_back( Frame{ w, g.begin( w ) } );
+				} else { // Cycle detected
 					if ( options::output::d ) std::cout << "\nContinuous state variable dependency cycle (cluster):" << std::endl;
-					bool active( false );
-					typename Branch::reverse_iterator i( branch.rbegin() );
-					while ( !active ) {
-						if ( *i == node ) {
-							active = true;
-						} else {
-							++i;
-						}
-					}
-					typename Branch::reverse_iterator i_active( i );
-					for ( ; i != branch.rend(); ++i ) {
-						if ( options::output::d ) std::cout << ' ' << (*i)->var->name() << std::endl;
-						for ( typename Branch::reverse_iterator j = i_active; j != branch.rend(); ++j ) {
-							(*i)->var->add_to_cluster( (*j)->var );
-						}
-					}
-					branch.pop_front();
-					step = Step::Pop;
-					node = !branch.empty() ? branch.front() : nullptr;
-				} else { // Moved up from child
-					assert( step == Step::Pop );
-					if ( node->advance_child() ) { // Move down branch to next child
-						node = node->child();
-						branch.push_front( node );
-						step = Step::Push;
-					} else { // No more children: Move up
-						node->leave();
-						branch.pop_front();
-						step = Step::Pop;
-						node = !branch.empty() ? branch.front() : nullptr;
+					for ( Index k = pos[ w ], e = Index( branch.size() ); k < e; ++k ) {
+						Variable_QSS * var( nodes[ branch[ k ].v ] );
+						if ( options::output::d ) std::cout << ' ' << var->name() << std::endl;
+						for ( Index l = pos[ w ]; l < e; ++l ) var->add_to_cluster( nodes[ branch[ l ].v ] );
 					}
+					if ( options::output::d ) std::cout << ' ' << nodes[ w ]->name() << std::endl;
 				}
+			} else { // No more children: Move up and leave node for other paths
+				pos[ v ] = none;
+				branch.pop_back();
 			}
 		}
 	}
-
 }
 
 } // QSS
@@ -350,6 +350,42 @@ zc_root_cull_mag( T const root, T const mag, T const zMag = T( 1e-6 ) )
 	return mag >= zMag ? root : inf< T >();
 }
 
+// Quadratic a*t^2 + b*t + c Can't Reach Zero on [0,h]? (Conservative Bernstein Bound)
+template< typename T, class = typename std::enable_if< std::is_arithmetic< T >::value >::type >
+bool
+zc_root_excluded( T const a, T const b, T const c, T const h )
+{
+	assert( h >= T( 0 ) );
+	T const p1( b * h ), p2( a * h * h ); // Power coefficients on [0,1]
+	T const tol( T( 8 ) * std::numeric_limits< T >::epsilon() * ( std::abs( c ) + std::abs( p1 ) + std::abs( p2 ) ) ); // Round-off guard
+	T const B1( c + ( p1 / T( 2 ) ) ), B2( c + p1 + p2 ); // Bernstein coefficients: B0 == c
+	if ( c > tol ) {
+		return ( B1 > tol ) && ( B2 > tol );
+	} else if ( c < -tol ) {
+		return ( B1 < -tol ) && ( B2 < -tol );
+	} else { // Nonfinite or near-zero c
+		return false;
+	}
+}
+
+// Cubic a*t^3 + b*t^2 + c*t + d Can't Reach Zero on [0,h]? (Conservative Bernstein Bound)
+template< typename T, class = typename std::enable_if< std::is_arithmetic< T >::value >::type >
+bool
+zc_root_excluded( T const a, T const b, T const c, T const d, T const h )
+{
+	assert( h >= T( 0 ) );
+	T const p1( c * h ), p2( b * h * h ), p3( a * h * h * h ); // Power coefficients on [0,1]
+	T const tol( T( 8 ) * std::numeric_limits< T >::epsilon() * ( std::abs( d ) + std::abs( p1 ) + std::abs( p2 ) + std::abs( p3 ) ) ); // Round-off guard
+	T const B1( d + ( p1 / T( 3 ) ) ), B2( d + ( ( ( T( 2 ) * p1 ) + p2 ) / T( 3 ) ) ), B3( d + p1 + p2 + p3 ); // Bernstein coefficients: B0 == d
+	if ( d > tol ) {
+		return ( B1 > tol ) && ( B2 > tol ) && ( B3 > tol );
+	} else if ( d < -tol ) {
+		return ( B1 < -tol ) && ( B2 < -tol ) && ( B3 < -tol );
+	} else { // Nonfinite or near-zero d
+		return false;
+	}
+}
+
 // Real-Valued Root
 template< typename T, class = typename std::enable_if< std::is_arithmetic< T >::value >::type >
 struct Root
@@ -1688,6 +1724,39 @@ min_root_cubic_both( T a, T b, T const c, T const dl, T const du, T zTol = T( 1e
 	}
 }
 
+// Bracketed
+
+// Illinois Root of Function f on Bracket [a,b] Given Best Root So Far: Signs of f(a) and f(b) Differ: Up to n_max Evaluations
+template< typename T, typename F, class = typename std::enable_if< std::is_arithmetic< T >::value >::type >
+Root< T >
+illinois_root( F && f, T a, T b, T fa, T fb, Root< T > root, T const zTol, std::size_t const n_max )
+{
+	assert( a < b );
+	assert( signs_differ( fa, fb ) );
+	assert( zTol >= T( 0 ) );
+	int side( 0 ); // Bracket side replaced last: -1 => b, +1 => a
+	for ( std::size_t i = 0u; i < n_max; ++i ) {
+		T x( ( ( a * fb ) - ( b * fa ) ) / ( fb - fa ) ); // Regula falsi
+		if ( !( ( a < x ) && ( x < b ) ) ) x = a + ( T( 0.5 ) * ( b - a ) ); // Bisect if interpolant falls outside the bracket
+		if ( !( ( a < x ) && ( x < b ) ) ) break; // Bracket at resolution limit
+		T const v( f( x ) );
+		if ( std::abs( v ) < std::abs( root.v ) ) root = Root< T >( x, v, zTol );
+		if ( root ) break; // Converged
+		if ( signs_same( v, fb ) ) { // Root in (a,x)
+			b = x;
+			fb = v;
+			if ( side == -1 ) fa *= T( 0.5 ); // Illinois: Halve value at endpoint retained twice
+			side = -1;
+		} else { // Root in (x,b)
+			a = x;
+			fa = v;
+			if ( side == +1 ) fb *= T( 0.5 ); // Illinois: Halve value at endpoint retained twice
+			side = +1;
+		}
+	}
+	return root;
+}
+
 } // QSS
 
 #endif
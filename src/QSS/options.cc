@@ -60,6 +60,10 @@ double aFac( 0.01 ); // Absolute tolerance factor
 double zTol( 1.0e-6 ); // Zero-crossing/root tolerance
 double zMul( 100.0 ); // Zero-crossing tolerance bump multiplier
 double zFac( 1.0 ); // Zero-crossing tolerance factor
+std::size_t zChatter( 0 ); // Zero-crossing chatter detection reversal count (0 => Off)
+double zChatterDt( 1.0e-3 ); // Zero-crossing chatter detection window (s)
+double zChatterMul( 10.0 ); // Zero-crossing chatter hysteresis multiplier
+double zChatterMax( 100.0 ); // Zero-crossing chatter hysteresis cap relative to base hysteresis
 double zrFac( 10.0 ); // Zero-crossing relative tolerance factor
 double zaFac( 0.1 ); // Zero-crossing absolute tolerance factor
 double dtMin( 0.0 ); // Min time step (s)
@@ -69,6 +73,7 @@ double dtInfMax( infinity ); // Max inf time step (s)
 bool dtInfReset{ false }; // Reset inf time step relaxation at zero-crossings?
 double dtZMax( 0.01 ); // Max time step before zero-crossing (s)
 double dtZC( 1.0e-9 ); // FMU zero-crossing time step (s)
+bool zcBumpAll( false ); // Bump all zero-crossing variables at handler events?
 double dtND( 1.0e-6 ); // Numeric differentiation time step (s)
 double dtND_max( 1.0 ); // Numeric differentiation time step max (s)
 bool dtND_optimizer( false ); // Optimize FMU numeric differentiation time step?
@@ -86,6 +91,10 @@ bool clipping( true ); // Trajectory coefficient clip-to-zero level active?
 std::size_t bin_size( 1u ); // Bin size max
 double bin_frac( 0.25 ); // Bin step fraction min
 bool bin_auto( false ); // Bin size automaically optimized?
+bool bin_work( false ); // Bin size optimized by deterministic work metrics?
+bool bin_local( false ); // Bin by observee/cluster locality?
+std::size_t plans( 64u ); // Binned/simultaneous trigger plan cache size
+std::size_t alloc_check( 0u ); // Steady-state allocation check warm-up event passes (0 => Off)
 std::size_t pass( 20 ); // Pass count limit
 bool cycles( false ); // Report dependency cycles?
 bool inflection( false ); // Requantize at inflections?
@@ -93,6 +102,7 @@ double inflectionFrac( 0.001 ); // Derivative inflection step fraction min
 double inflectionFrac2( 0.005 ); // Second derivative inflection step fraction min
 bool cluster( false ); // Clustering with relaxation solver?
 bool refine( false ); // Refine FMU zero-crossing roots?
+std::size_t refineCalls( 6 ); // FMU zero-crossing root refinement evaluation budget per root
 bool perfect( false ); // Perfect FMU-ME connection sync?
 bool active( false ); // Active intermediate variables preferred?
 bool passive( !active ); // Passive intermediate variables preferred?
@@ -103,6 +113,12 @@ InpFxn fxn; // Map from input variables to function specs
 InpOut con; // Map from input variables to output variables
 DepSpecs dep; // Additional forward dependencies
 bool csv( false ); // CSV results file?
+std::size_t outBuf( 64u ); // Output buffer pool budget per simulation thread (MB)
+AggSpecs agg; // Trajectory aggregate specs
+std::size_t shm( 0u ); // Shared-memory output ring capacity (records)  (0 => Off)
+Layout layout( Layout::RCM ); // Variable memory layout
+std::string perf; // perf stat control FIFO and optional ack FIFO: CTL[,ACK]
+std::string timing; // Setup phase timing JSON file  (Empty => Off)
 std::pair< double, double > tLoc( 0.0, 0.0 ); // Local output time range (s)
 std::string clu; // Variable cluster file
 std::string var; // Variable output filter file
@@ -167,6 +183,10 @@ help_display()
 	std::cout << " --zTol=TOL              Zero-crossing/root tolerance  [" << zTol << "|FMU]" << '\n';
 	std::cout << " --zMul=MUL              Zero-crossing tolerance bump multiplier  [" << zMul << ']' << '\n';
 	std::cout << " --zFac=FAC              Zero-crossing tolerance factor  [" << zFac << ']' << '\n';
+	std::cout << " --zChatter=N            Zero-crossing chatter detection reversal count  (0 => Off)  [" << zChatter << ']' << '\n';
+	std::cout << " --zChatterDt=DT         Zero-crossing chatter detection window (s)  [" << zChatterDt << ']' << '\n';
+	std::cout << " --zChatterMul=MUL       Zero-crossing chatter hysteresis multiplier  [" << zChatterMul << ']' << '\n';
+	std::cout << " --zChatterMax=MAX       Zero-crossing chatter hysteresis cap relative to zTol (or aTol if zTol=0)  [" << zChatterMax << ']' << '\n';
 	std::cout << " --zrFac=FAC             Zero-crossing relative tolerance factor  [" << zrFac << ']' << '\n';
 	std::cout << " --zaFac=FAC             Zero-crossing absolute tolerance factor  [" << zaFac << ']' << '\n';
 	std::cout << " --dtMin=STEP            Min time step (s)  [0]" << '\n';
@@ -175,6 +195,7 @@ help_display()
 	std::cout << " --dtInfReset            Reset deactivation control time step at zero-crossings  [Off]" << '\n';
 	std::cout << " --dtZMax=STEP           Max time step before zero-crossing (s)  (0 => Off)  [" << dtZMax << ']' << '\n';
 	std::cout << " --dtZC=STEP             FMU zero-crossing time step (s)  [" << dtZC << ']' << '\n';
+	std::cout << " --zcBumpAll             Bump all zero-crossing variables at handler events (validation)  [Off]" << '\n';
 	std::cout << " --dtND=STEP[:AUTO|MAX]  Numeric differentiation time step  [" << dtND << ']' << '\n';
 	std::cout << "        STEP             Time step (s)  [1e-6]" << '\n';
 	std::cout << "              AUTO       Automatic time step optimization?  (Y|N)  [Y if bare --dtND and N otherwise]" << '\n';
@@ -191,6 +212,7 @@ help_display()
 	std::cout << " --inflectionFrac2=FRAC  Second derivative inflection step fraction min  [" << inflectionFrac2 << ']' << '\n';
 	std::cout << " --cluster               Cluster identification via dependency cycles  [Off]" << '\n';
 	std::cout << " --refine                Refine FMU zero-crossing roots" << '\n';
+	std::cout << " --refineCalls=N         FMU zero-crossing root refinement evaluation budget per root  [" << refineCalls << ']' << '\n';
 	std::cout << " --perfect               Perfect FMU-ME connection sync" << '\n';
 	std::cout << " --active                Active intermediate variables preferred  [" << ( active ? "On" : "Off" ) << "]" << '\n';
 	std::cout << " --passive               Passive intermediate variables preferred  [" << ( passive ? "On" : "Off" ) << "]" << '\n';
@@ -227,7 +249,13 @@ help_display()
 	std::cout << " --bin=SIZE:FRAC:AUTO  FMU requantization binning controls  [1:0.25:N]" << '\n';
 	std::cout << "       SIZE  Bin size  (Size or U for Unlimited)  [U]" << '\n';
 	std::cout << "            FRAC  Min time step fraction  (0-1]  [0.25]" << '\n';
-	std::cout << "                 AUTO  Automatic bin size optimization?  (Y|N)  [N]" << '\n';
+	std::cout << "                 AUTO  Automatic bin size optimization?  (Y|N|W)  [N]" << '\n';
+	std::cout << "                       Y  Optimize by CPU time" << '\n';
+	std::cout << "                       W  Optimize by FMU call and observer update work (reproducible)" << '\n';
+	std::cout << " --binLocal  Prefer binning variables sharing observees/cluster with the front trigger  [Off]" << '\n';
+	std::cout << " --plans=SIZE  Binned/simultaneous trigger plan LRU cache size (0 => No caching)  [" << plans << ']' << '\n';
+	std::cout << " --allocCheck=PASSES  Fail on heap allocation in simulation loop after PASSES warm-up event passes  [Off|1000]" << '\n';
+	std::cout << "                      Requires a QSS_ALLOC_CHECK build (make QSS_ALLOC_CHECK=1): Use with trajectory outputs off" << '\n';
 	std::cout << " --out=OUTPUTS  Outputs  [sROZDX]" << '\n';
 	std::cout << "       d  Diagnostics" << '\n';
 	std::cout << "       s  Statistics" << '\n';
@@ -246,6 +274,21 @@ help_display()
 	std::cout << "       F  Ouput variables" << '\n';
 	std::cout << "       L  Local variables" << '\n';
 	std::cout << " --csv  Output CSV results file" << '\n';
+	std::cout << " --outBuf=MB  Output buffer pool budget per simulation thread (MB)  [" << outBuf << ']' << '\n';
+	std::cout << " --agg=VAR[:THRESH[,THRESH,...]]  QSS variable trajectory aggregates" << '\n';
+	std::cout << "       VAR  Variable (name or glob)" << '\n';
+	std::cout << "            THRESH  Threshold for time-above aggregate" << '\n';
+	std::cout << "       Integral, min, max, and time above thresholds written to <model>.agg" << '\n';
+	std::cout << " --shm[=RECORDS]  Publish QSS variable outputs to shared-memory ring /QSS.<model>  [1048576]" << '\n';
+	std::cout << "       Records are published at R, Z, D, and S output events" << '\n';
+	std::cout << " --layout=LAYOUT  QSS variable memory layout  [RCM]" << '\n';
+	std::cout << "       heap  Individually allocated" << '\n';
+	std::cout << "       FMU   Arena in FMU variable order" << '\n';
+	std::cout << "       RCM   Arena in reverse Cuthill-McKee dependency order" << '\n';
+	std::cout << "       SCC   Arena with dependency cycle clusters contiguous" << '\n';
+	std::cout << " --perf=CTL[,ACK]  perf stat control FIFO(s) enabled only around the simulation loop" << '\n';
+	std::cout << "       Run as: perf stat --delay=-1 --control fifo:CTL[,ACK] -e cache-misses QSS --perf=CTL[,ACK] ..." << '\n';
+	std::cout << " --timing[=FILE]  Setup phase wall/CPU time and peak RSS report, also as JSON to FILE  [timing.json]" << '\n';
 	std::cout << " --dot=GRAPHS  Outputs  [dre]" << '\n';
 	std::cout << "       d  Dependency graph" << '\n';
 	std::cout << "       r  Computational Observer graph" << '\n';
@@ -560,6 +603,22 @@ process_args( Args const & args )
 			refine = true;
 		} else if ( has_option( arg, "no-refine" ) ) {
 			refine = false;
+		} else if ( has_option_value( arg, "refineCalls" ) ) {
+			std::string const refineCalls_str( option_value( arg, "refineCalls" ) );
+			if ( is_size( refineCalls_str ) ) {
+				refineCalls = size_of( refineCalls_str );
+				if ( refineCalls < 1 ) {
+					std::cerr << "\nError: Nonpositive refineCalls option: " << refineCalls_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonintegral refineCalls option: " << refineCalls_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "binLocal" ) ) {
+			bin_local = true;
+		} else if ( has_option( arg, "no-binLocal" ) ) {
+			bin_local = false;
 		} else if ( has_option( arg, "perfect" ) ) {
 			perfect = true;
 		} else if ( has_option( arg, "no-perfect" ) ) {
@@ -687,6 +746,50 @@ process_args( Args const & args )
 				std::cerr << "\nError: Nonnumeric zFac: " << zFac_str << std::endl;
 				fatal = true;
 			}
+		} else if ( has_option_value( arg, "zChatter" ) ) {
+			std::string const zChatter_str( option_value( arg, "zChatter" ) );
+			if ( is_size( zChatter_str ) ) {
+				zChatter = size_of( zChatter_str );
+			} else {
+				std::cerr << "\nError: Nonintegral zChatter option: " << zChatter_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option_value( arg, "zChatterDt" ) ) {
+			std::string const zChatterDt_str( option_value( arg, "zChatterDt" ) );
+			if ( is_double( zChatterDt_str ) ) {
+				zChatterDt = double_of( zChatterDt_str );
+				if ( zChatterDt < 0.0 ) {
+					std::cerr << "\nError: Negative zChatterDt: " << zChatterDt_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonnumeric zChatterDt: " << zChatterDt_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option_value( arg, "zChatterMul" ) ) {
+			std::string const zChatterMul_str( option_value( arg, "zChatterMul" ) );
+			if ( is_double( zChatterMul_str ) ) {
+				zChatterMul = double_of( zChatterMul_str );
+				if ( zChatterMul <= 1.0 ) {
+					std::cerr << "\nError: zChatterMul <= 1.0: " << zChatterMul_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonnumeric zChatterMul: " << zChatterMul_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option_value( arg, "zChatterMax" ) ) {
+			std::string const zChatterMax_str( option_value( arg, "zChatterMax" ) );
+			if ( is_double( zChatterMax_str ) ) {
+				zChatterMax = double_of( zChatterMax_str );
+				if ( zChatterMax < 1.0 ) {
+					std::cerr << "\nError: zChatterMax < 1.0: " << zChatterMax_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonnumeric zChatterMax: " << zChatterMax_str << std::endl;
+				fatal = true;
+			}
 		} else if ( has_option_value( arg, "zrFac" ) ) {
 			std::string const zrFac_str( option_value( arg, "zrFac" ) );
 			if ( is_double( zrFac_str ) ) {
@@ -792,6 +895,10 @@ process_args( Args const & args )
 			dtInfReset = true;
 		} else if ( has_option( arg, "no-dtInfReset" ) ) {
 			dtInfReset = false;
+		} else if ( has_option( arg, "zcBumpAll" ) ) {
+			zcBumpAll = true;
+		} else if ( has_option( arg, "no-zcBumpAll" ) ) {
+			zcBumpAll = false;
 		} else if ( has_option_value( arg, "dtZC" ) ) {
 			specified::dtZC = true;
 			std::string const dtZC_str( option_value( arg, "dtZC" ) );
@@ -948,6 +1055,7 @@ process_args( Args const & args )
 			bin_size = std::numeric_limits< std::size_t >::max();
 			bin_frac = 0.25;
 			bin_auto = false;
+			bin_work = false;
 		} else if ( has_option_value( arg, "bin" ) ) {
 			specified::bin = true;
 			std::string const bin_str( option_value( arg, "bin" ) );
@@ -987,10 +1095,16 @@ process_args( Args const & args )
 					std::string const bin_auto_str( bin_args[ 2 ] );
 					if ( bin_auto_str.empty() ) {
 						bin_auto = false;
+						bin_work = false;
 					} else if ( is_any_of( bin_auto_str[ 0 ], "YyTt1" ) ) {
 						bin_auto = true;
+						bin_work = false;
+					} else if ( is_any_of( bin_auto_str[ 0 ], "Ww" ) ) {
+						bin_auto = true;
+						bin_work = true;
 					} else if ( is_any_of( bin_auto_str[ 0 ], "NnFf0" ) ) {
 						bin_auto = false;
+						bin_work = false;
 					} else {
 						std::cerr << "\nError: Invalid bin auto: " << bin_auto_str << std::endl;
 						fatal = true;
@@ -1007,6 +1121,26 @@ process_args( Args const & args )
 					fatal = true;
 				}
 			}
+		} else if ( has_option( arg, "allocCheck" ) ) {
+			alloc_check = 1000u;
+		} else if ( has_option( arg, "no-allocCheck" ) ) {
+			alloc_check = 0u;
+		} else if ( has_option_value( arg, "allocCheck" ) ) {
+			std::string const alloc_check_str( option_value( arg, "allocCheck" ) );
+			if ( is_size( alloc_check_str ) ) {
+				alloc_check = size_of( alloc_check_str );
+			} else {
+				std::cerr << "\nError: Nonintegral allocCheck option: " << alloc_check_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option_value( arg, "plans" ) ) {
+			std::string const plans_str( option_value( arg, "plans" ) );
+			if ( is_size( plans_str ) ) {
+				plans = size_of( plans_str );
+			} else {
+				std::cerr << "\nError: Nonintegral plans option: " << plans_str << std::endl;
+				fatal = true;
+			}
 		} else if ( has_option_value( arg, "pass" ) ) {
 			std::string const pass_str( option_value( arg, "pass" ) );
 			if ( is_size( pass_str ) ) {
@@ -1153,23 +1287,23 @@ process_args( Args const & args )
 					if ( std::any_of( dep_specs.begin(), dep_specs.end(), []( std::string const & dep_spec ){ return dep_spec == "*"; } ) ) dep.all() = true;
 				}
 			}
-			std::regex var_regex;
+			DepSpecs::Spec var_glob;
 			try {
-				var_regex = DepSpecs::regex( var_spec );
+				var_glob = DepSpecs::regex( var_spec );
 			} catch (...) {
 				std::cerr << "\nError: Dependency variable spec cannot be converted into a regex " << var_spec << std::endl;
 				fatal = true;
 			}
-			std::vector< std::regex > deps_regex;
+			DepSpecs::Deps deps_glob;
 			for ( std::string const & dep_spec : dep_specs ) {
 				try {
-					deps_regex.push_back( DepSpecs::regex( dep_spec ) );
+					deps_glob.push_back( DepSpecs::regex( dep_spec ) );
 				} catch (...) {
 					std::cerr << "\nError: Dependency spec cannot be converted into a regex " << dep_spec << std::endl;
 					fatal = true;
 				}
 			}
-			dep.add( var_regex, deps_regex );
+			dep.add( var_glob, deps_glob );
 		} else if ( has_option_value( arg, "out" ) ) {
 			static std::string const out_flags( "dshROZDSXQTAFLK" );
 			char const sep( option_sep( arg, "out" ) );
@@ -1322,6 +1456,66 @@ process_args( Args const & args )
 			csv = true;
 		} else if ( has_option( arg, "no-csv" ) ) {
 			csv = false;
+		} else if ( has_option_value( arg, "agg" ) ) {
+			std::string const var_thresh( option_value( arg, "agg" ) );
+			AggSpec agg_spec;
+			std::string thresh_spec;
+			if ( var_thresh.empty() ) {
+				std::cerr << "\nError: Empty aggregate spec" << std::endl;
+				fatal = true;
+			} else if ( var_thresh[ 0 ] == '"' ) { // Quoted variable name
+				std::string::size_type const qe( var_thresh.find( '"', 1u ) );
+				if ( qe != std::string::npos ) {
+					agg_spec.var = var_thresh.substr( 1u, qe - 1u );
+					std::string::size_type const isep( var_thresh.find( ':', qe ) );
+					if ( isep != std::string::npos ) thresh_spec = var_thresh.substr( isep + 1u );
+				} else {
+					std::cerr << "\nError: Aggregate spec quoted variable name missing end quote: " << var_thresh << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::string::size_type const isep( var_thresh.find( ':' ) );
+				agg_spec.var = var_thresh.substr( 0u, isep );
+				if ( isep != std::string::npos ) thresh_spec = var_thresh.substr( isep + 1u );
+			}
+			for ( std::string thresh_str : split( thresh_spec, ',' ) ) {
+				if ( is_double( strip( thresh_str ) ) ) {
+					agg_spec.thresholds.push_back( double_of( thresh_str ) );
+				} else if ( !thresh_str.empty() ) {
+					std::cerr << "\nError: Nonnumeric aggregate threshold: " << thresh_str << std::endl;
+					fatal = true;
+				}
+			}
+			if ( agg_spec.var.empty() ) agg_spec.var = '*'; // Implied all
+			agg.push_back( agg_spec );
+		} else if ( has_option( arg, "shm" ) ) {
+			shm = 1048576u;
+		} else if ( has_option_value( arg, "shm" ) ) {
+			std::string const shm_str( option_value( arg, "shm" ) );
+			if ( is_size( shm_str ) ) {
+				shm = size_of( shm_str );
+				if ( shm < 1 ) {
+					std::cerr << "\nError: Nonpositive shm option: " << shm_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonintegral shm option: " << shm_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "no-shm" ) ) {
+			shm = 0u;
+		} else if ( has_option_value( arg, "outBuf" ) ) {
+			std::string const outBuf_str( option_value( arg, "outBuf" ) );
+			if ( is_size( outBuf_str ) ) {
+				outBuf = size_of( outBuf_str );
+				if ( outBuf < 1 ) {
+					std::cerr << "\nError: Nonpositive outBuf option: " << outBuf_str << std::endl;
+					fatal = true;
+				}
+			} else {
+				std::cerr << "\nError: Nonintegral outBuf option: " << outBuf_str << std::endl;
+				fatal = true;
+			}
 		} else if ( has_option_value( arg, "dot" ) ) {
 			static std::string const dot_flags( "dre" );
 			std::string const dot( option_value( arg, "dot" ) );
@@ -1387,6 +1581,36 @@ process_args( Args const & args )
 				std::cerr << "\nError: tLoc not in TIME1:TIME2 format: " << tLoc_str << std::endl;
 				fatal = true;
 			}
+		} else if ( has_option_value( arg, "layout" ) ) {
+			std::string const layout_str( uppercased( option_value( arg, "layout" ) ) );
+			if ( layout_str == "HEAP" ) {
+				layout = Layout::heap;
+			} else if ( layout_str == "FMU" ) {
+				layout = Layout::FMU;
+			} else if ( layout_str == "RCM" ) {
+				layout = Layout::RCM;
+			} else if ( layout_str == "SCC" ) {
+				layout = Layout::SCC;
+			} else {
+				std::cerr << "\nError: Unrecognized layout: " << layout_str << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option_value( arg, "perf" ) ) {
+			perf = option_value( arg, "perf" );
+			if ( perf.empty() ) {
+				std::cerr << "\nError: Empty perf option" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "timing" ) ) {
+			timing = "timing.json";
+		} else if ( has_option_value( arg, "timing" ) ) {
+			timing = option_value( arg, "timing" );
+			if ( timing.empty() ) {
+				std::cerr << "\nError: Empty timing option" << std::endl;
+				fatal = true;
+			}
+		} else if ( has_option( arg, "no-timing" ) ) {
+			timing.clear();
 		} else if ( has_option_value( arg, "clu" ) ) {
 			clu = option_value( arg, "clu" );
 			if ( !path::is_file( clu ) ) {
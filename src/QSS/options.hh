@@ -36,10 +36,12 @@
 #ifndef QSS_options_hh_INCLUDED
 #define QSS_options_hh_INCLUDED
 
+// QSS Headers
+#include <QSS/Glob.hh>
+
 // C++ Headers
 #include <algorithm>
 #include <cstddef>
-#include <regex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -106,13 +108,30 @@ enum class LogLevel {
  all
 };
 
+// Variable Memory Layout Enumerator
+enum class Layout {
+ heap, // Individually heap allocated
+ FMU, // Arena in FMU variable order
+ RCM, // Arena in reverse Cuthill-McKee order of the dependency graph
+ SCC // Arena with dependency cycle clusters contiguous
+};
+
+// Aggregate Spec
+struct AggSpec final
+{
+	std::string var; // Variable name or glob
+	std::vector< double > thresholds; // Time-above thresholds
+}; // AggSpec
+
+using AggSpecs = std::vector< AggSpec >;
+
 // Dependency Specs Class
 class DepSpecs final
 {
 
 public: // Types
 
-	using Spec = std::regex;
+	using Spec = Glob;
 	using Deps = std::vector< Spec >;
 	using size_type = Deps::size_type;
 
@@ -121,20 +140,20 @@ public: // Types
 
 		// Variable Spec Constructor
 		explicit
-		Dependency( std::regex const & var_regex ) :
-		 spec( var_regex )
+		Dependency( Spec const & var_spec ) :
+		 spec( var_spec )
 		{}
 
 		// Variable and Dependency Spec Constructor
-		Dependency( std::regex const & var_regex, std::regex const & dep_regex ) :
-		 spec( var_regex ),
-		 deps( 1u, std::regex( dep_regex ) )
+		Dependency( Spec const & var_spec, Spec const & dep_spec ) :
+		 spec( var_spec ),
+		 deps( 1u, dep_spec )
 		{}
 
 		// Variable and Dependency Specs Constructor
-		Dependency( std::regex const & var_regex, std::vector< std::regex > const & dep_regexs ) :
-		 spec( var_regex ),
-		 deps( dep_regexs )
+		Dependency( Spec const & var_spec, Deps const & dep_specs ) :
+		 spec( var_spec ),
+		 deps( dep_specs )
 		{}
 
 		// Empty?
@@ -202,7 +221,7 @@ public: // Predicate
 		if ( all_ ) return true;
 		return std::any_of( dependencies_.begin(), dependencies_.end(),
 		 [ &var_name ]( Dependency const & dependency ){
-		 	return std::regex_match( regex_string( var_name ), dependency.spec );
+		 	return dependency.spec( var_name );
 		 }
 		);
 	}
@@ -214,10 +233,10 @@ public: // Predicate
 		if ( all_ ) return true;
 		return std::any_of( dependencies_.begin(), dependencies_.end(), [ &var_name,  &dep_name ]( Dependency const & dependency )
 		{
-			return std::regex_match( regex_string( var_name ), dependency.spec ) &&
+			return dependency.spec( var_name ) &&
 			 std::any_of( dependency.deps.begin(), dependency.deps.end(), [ &dep_name ]( Spec const & spec )
 			{
-					return std::regex_match( regex_string( dep_name ), spec );
+					return spec( dep_name );
 			} );
 		} );
 	}
@@ -240,9 +259,9 @@ public: // Property
 
 	// Add a Variable and Dependencies
 	void
-	add( std::regex const & var_regex, std::vector< std::regex > const & dep_regexs )
+	add( Spec const & var_spec, Deps const & dep_specs )
 	{
-		dependencies_.emplace_back( var_regex, dep_regexs );
+		dependencies_.emplace_back( var_spec, dep_specs );
 	}
 
 public: // Static Methods
@@ -252,32 +271,15 @@ public: // Static Methods
 	std::string
 	regex_string( std::string const & spec )
 	{
-		// Convert glob usage to regex (imperfect)
-		std::string re_spec;
-		for ( char const c : spec ) {
-			if ( c == '?' ) {
-				re_spec.push_back( '.' );
-			} else if ( c == '*' ) {
-				re_spec.append( ".*" );
-			} else if ( c == '.' ) {
-				re_spec.append( "\\." );
-			} else if ( c == '[' ) {
-				re_spec.append( "\\[" );
-			} else if ( c == ']' ) {
-				re_spec.append( "\\]" );
-			} else {
-				re_spec.push_back( c );
-			}
-		}
-		return re_spec;
+		return Glob::regex_string( spec );
 	}
 
-	// Regex of a Variable Spec
+	// Compiled Matcher of a Variable Spec
 	static
-	std::regex
+	Spec
 	regex( std::string const & spec )
 	{
-		return std::regex( regex_string( spec ) ); // Can throw exception if resulting string is not a valid regex
+		return Spec( spec ); // Can throw exception if spec uses regex syntax and is not a valid regex
 	}
 
 private: // Data
@@ -299,6 +301,10 @@ extern double aFac; // Absolute tolerance factor
 extern double zTol; // Zero-crossing tolerance
 extern double zMul; // Zero-crossing tolerance bump multiplier
 extern double zFac; // Zero-crossing tolerance factor
+extern std::size_t zChatter; // Zero-crossing chatter detection reversal count (0 => Off)
+extern double zChatterDt; // Zero-crossing chatter detection window (s)
+extern double zChatterMul; // Zero-crossing chatter hysteresis multiplier
+extern double zChatterMax; // Zero-crossing chatter hysteresis cap relative to base hysteresis
 extern double zrFac; // Zero-crossing relative tolerance factor
 extern double zaFac; // Zero-crossing absolute tolerance factor
 extern double dtMin; // Min time step (s)
@@ -308,6 +314,7 @@ extern double dtInfMax; // Max inf time step (s)
 extern bool dtInfReset; // Reset inf time step relaxation at zero-crossings?
 extern double dtZMax; // Max time step before zero-crossing (s)
 extern double dtZC; // FMU zero-crossing time step (s)
+extern bool zcBumpAll; // Bump all zero-crossing variables at handler events?
 extern double dtND; // Numeric differentiation time step (s)
 extern double dtND_max; // Numeric differentiation time step max (s)
 extern bool dtND_optimizer; // Optimize FMU numeric differentiation time step?
@@ -325,6 +332,10 @@ extern bool clipping; // Trajectory coefficient clip-to-zero level active?
 extern std::size_t bin_size; // Bin size max
 extern double bin_frac; // Bin step fraction min
 extern bool bin_auto; // Bin size automaically optimized?
+extern bool bin_work; // Bin size optimized by deterministic work metrics?
+extern bool bin_local; // Bin by observee/cluster locality?
+extern std::size_t plans; // Binned/simultaneous trigger plan cache size
+extern std::size_t alloc_check; // Steady-state allocation check warm-up event passes (0 => Off)
 extern std::size_t pass; // Pass count limit
 extern bool cycles; // Report dependency cycles?
 extern bool inflection; // Requantize at inflections?
@@ -332,6 +343,7 @@ extern double inflectionFrac; // Derivative inflection step fraction min
 extern double inflectionFrac2; // Second derivative inflection step fraction min
 extern bool cluster; // Clustering with relaxation solver?
 extern bool refine; // Refine FMU zero-crossing roots?
+extern std::size_t refineCalls; // FMU zero-crossing root refinement evaluation budget per root
 extern bool perfect; // Perfect FMU-ME connection sync?
 extern bool active; // Active intermediate variables preferred?
 extern bool passive; // Passive intermediate variables preferred?
@@ -342,6 +354,12 @@ extern InpFxn fxn; // Map from input variables to function specs
 extern InpOut con; // Map from input variables to output variables
 extern DepSpecs dep; // Additional forward dependencies
 extern bool csv; // CSV results file?
+extern std::size_t outBuf; // Output buffer pool budget per simulation thread (MB)
+extern AggSpecs agg; // Trajectory aggregate specs
+extern std::size_t shm; // Shared-memory output ring capacity (records)  (0 => Off)
+extern Layout layout; // Variable memory layout
+extern std::string perf; // perf stat control FIFO and optional ack FIFO: CTL[,ACK]
+extern std::string timing; // Setup phase timing JSON file  (Empty => Off)
 extern std::pair< double, double > tLoc; // Local output time range (s)
 extern std::string clu; // Variable cluster spec file
 extern std::string var; // Variable output spec file
@@ -0,0 +1,129 @@
+// perf stat Control Markers
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// QSS Headers
+#include <QSS/perf_ctl.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <cerrno>
+#include <cstring>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <string>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace QSS {
+
+namespace {
+
+#ifndef _WIN32
+
+// Control and Ack FIFO File Descriptors
+int ctl_fd( -1 );
+int ack_fd( -1 );
+std::once_flag open_flag; // FIFOs opened once by the first model thread
+std::mutex command_mutex; // Serializes commands and enable counts of concurrent model runs
+std::size_t n_enabled( 0u ); // Model runs with counters enabled
+
+// Open the FIFOs on First Use
+bool
+perf_open()
+{
+	std::call_once( open_flag, [](){
+		std::string::size_type const isep( options::perf.find( ',' ) );
+		std::string const ctl( options::perf.substr( 0u, isep ) );
+		std::string const ack( isep == std::string::npos ? std::string() : options::perf.substr( isep + 1u ) );
+		ctl_fd = ::open( ctl.c_str(), O_WRONLY ); // Blocks until perf opens the FIFO for reading
+		if ( ctl_fd < 0 ) {
+			std::cerr << "\nWarning: perf control FIFO open failed: " << ctl << ": " << std::strerror( errno ) << std::endl;
+			return;
+		}
+		if ( !ack.empty() ) {
+			ack_fd = ::open( ack.c_str(), O_RDONLY );
+			if ( ack_fd < 0 ) std::cerr << "\nWarning: perf ack FIFO open failed: " << ack << ": " << std::strerror( errno ) << std::endl;
+		}
+	} );
+	return ctl_fd >= 0;
+}
+
+// Send a Command and Wait for the Ack if There is an Ack FIFO
+void
+perf_command( char const * cmd )
+{
+	std::size_t const len( std::strlen( cmd ) );
+	if ( ::write( ctl_fd, cmd, len ) != static_cast< ssize_t >( len ) ) {
+		std::cerr << "\nWarning: perf control FIFO write failed: " << std::strerror( errno ) << std::endl;
+		return;
+	}
+	if ( ack_fd >= 0 ) {
+		char ack[ 5 ];
+		if ( ::read( ack_fd, ack, sizeof( ack ) ) <= 0 ) std::cerr << "\nWarning: perf ack FIFO read failed" << std::endl;
+	}
+}
+
+#endif
+
+} // Unnamed
+
+// Enable perf stat Counters via the --perf Control FIFO
+//  Concurrent model runs nest: Counters are enabled by the first enable and stay on until the last disable
+void
+perf_enable()
+{
+#ifndef _WIN32
+	if ( options::perf.empty() || !perf_open() ) return;
+	std::lock_guard< std::mutex > const lock( command_mutex );
+	if ( n_enabled++ == 0u ) perf_command( "enable\n" );
+#endif
+}
+
+// Disable perf stat Counters via the --perf Control FIFO
+void
+perf_disable()
+{
+#ifndef _WIN32
+	if ( options::perf.empty() || !perf_open() ) return;
+	std::lock_guard< std::mutex > const lock( command_mutex );
+	if ( ( n_enabled > 0u ) && ( --n_enabled == 0u ) ) perf_command( "disable\n" );
+#endif
+}
+
+} // QSS
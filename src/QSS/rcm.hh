@@ -0,0 +1,138 @@
+// Reverse Cuthill-McKee Ordering of CSR Graphs
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_rcm_hh_INCLUDED
+#define QSS_rcm_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/CSR.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+namespace QSS {
+
+// Undirected Version of a CSR Graph: Edges in Both Directions with Self-Edges and Duplicates Removed
+template< typename Index >
+CSR< Index >
+undirected( CSR< Index > const & g )
+{
+	using Edges = typename CSR< Index >::Edges;
+	Index const n( g.n() );
+	Edges edges;
+	edges.reserve( 2u * g.n_edges() );
+	for ( Index v = 0u; v < n; ++v ) {
+		for ( auto i = g.begin( v ), e = g.end( v ); i != e; ++i ) {
+			if ( *i != v ) {
+				edges.emplace_back( v, *i );
+				edges.emplace_back( *i, v );
+			}
+		}
+	}
+	CSR< Index > u( n, edges );
+	u.sort_and_uniquify();
+	return u;
+}
+
+// Reverse Cuthill-McKee Ordering of an Undirected CSR Graph: O( Nodes + Edges log Degree )
+//  Each component is traversed breadth-first from its lowest degree node with neighbors visited in ascending degree order
+//  Ties are broken by node index so the ordering is deterministic
+template< typename Index >
+void
+rcm(
+ CSR< Index > const & g,
+ std::vector< Index > & order
+)
+{
+	Index const n( g.n() );
+	order.clear();
+	order.reserve( n );
+	auto const degree_less( [ &g ]( Index const a, Index const b ){ return g.degree( a ) < g.degree( b ); } );
+	std::vector< Index > starts( n ); // Nodes in ascending degree order
+	std::iota( starts.begin(), starts.end(), Index( 0u ) );
+	std::stable_sort( starts.begin(), starts.end(), degree_less );
+	std::vector< bool > visited( n, false );
+	std::vector< Index > nbrs; // Unvisited neighbors of a node
+	for ( Index const s : starts ) {
+		if ( visited[ s ] ) continue;
+		visited[ s ] = true;
+		std::size_t head( order.size() );
+		order.push_back( s );
+		while ( head < order.size() ) { // Breadth-first traversal of the component
+			Index const v( order[ head++ ] );
+			nbrs.clear();
+			for ( auto i = g.begin( v ), e = g.end( v ); i != e; ++i ) {
+				if ( !visited[ *i ] ) {
+					visited[ *i ] = true;
+					nbrs.push_back( *i );
+				}
+			}
+			std::stable_sort( nbrs.begin(), nbrs.end(), degree_less );
+			order.insert( order.end(), nbrs.begin(), nbrs.end() );
+		}
+	}
+	std::reverse( order.begin(), order.end() );
+	assert( order.size() == n );
+}
+
+// Bandwidth of a CSR Graph Under a Node Ordering: Max Position Distance Across an Edge
+template< typename Index >
+std::size_t
+bandwidth(
+ CSR< Index > const & g,
+ std::vector< Index > const & order
+)
+{
+	Index const n( g.n() );
+	assert( order.size() == n );
+	std::vector< std::size_t > pos( n );
+	for ( std::size_t k = 0u; k < n; ++k ) pos[ order[ k ] ] = k;
+	std::size_t b( 0u );
+	for ( Index v = 0u; v < n; ++v ) {
+		for ( auto i = g.begin( v ), e = g.end( v ); i != e; ++i ) {
+			b = std::max( b, pos[ v ] < pos[ *i ] ? pos[ *i ] - pos[ v ] : pos[ v ] - pos[ *i ] );
+		}
+	}
+	return b;
+}
+
+} // QSS
+
+#endif
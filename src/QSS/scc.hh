@@ -0,0 +1,130 @@
+// QSS Strongly Connected Components
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef QSS_scc_hh_INCLUDED
+#define QSS_scc_hh_INCLUDED
+
+// QSS Headers
+#include <QSS/CSR.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace QSS {
+
+// Strongly Connected Components of a CSR Graph: Iterative Tarjan Algorithm: O( Nodes + Edges )
+//  Sets the component number of each node and returns the number of components
+//  Components are numbered in reverse topological order: Edges only go to the same or lower numbered components
+template< typename Index >
+Index
+scc(
+ CSR< Index > const & g,
+ std::vector< Index > & comp
+)
+{
+	using const_iterator = typename CSR< Index >::const_iterator;
+	Index const none( std::numeric_limits< Index >::max() );
+	Index const n( g.n() );
+	comp.assign( n, none );
+	std::vector< Index > num( n, none ); // DFS visit number
+	std::vector< Index > low( n ); // Lowest visit number reachable
+	std::vector< Index > stack; // Tarjan stack
+	struct Frame { Index v; const_iterator e; }; // DFS call frame: Node and next edge
+	std::vector< Frame > call; // DFS call stack
+	Index n_num( 0u );
+	Index n_comp( 0u );
+	for ( Index root = 0u; root < n; ++root ) {
+		if ( num[ root ] != none ) continue;
+		num[ root ] = low[ root ] = n_num++;
+		stack.push_back( root );
+		call.push_back( Frame{ root, g.begin( root ) } );
+		while ( !call.empty() ) {
+			Index const v( call.back().v );
+			if ( call.back().e != g.end( v ) ) { // Next edge
+				Index const w( *call.back().e++ );
+				if ( num[ w ] == none ) { // Descend
+					num[ w ] = low[ w ] = n_num++;
+					stack.push_back( w );
+					call.push_back( Frame{ w, g.begin( w ) } );
+				} else if ( comp[ w ] == none ) { // w is on the stack
+					low[ v ] = std::min( low[ v ], num[ w ] );
+				}
+			} else { // Done with v
+				call.pop_back();
+				if ( low[ v ] == num[ v ] ) { // v is a component root: Pop its component
+					Index w;
+					do {
+						w = stack.back();
+						stack.pop_back();
+						comp[ w ] = n_comp;
+					} while ( w != v );
+					++n_comp;
+				}
+				if ( !call.empty() ) {
+					Index const u( call.back().v );
+					low[ u ] = std::min( low[ u ], low[ v ] );
+				}
+			}
+		}
+	}
+	assert( stack.empty() );
+	return n_comp;
+}
+
+// Component Member Lists as CSR-Style Offsets and Members: Members in Ascending Node Order
+template< typename Index >
+void
+scc_members(
+ std::vector< Index > const & comp,
+ Index const n_comp,
+ std::vector< Index > & off,
+ std::vector< Index > & members
+)
+{
+	off.assign( std::size_t( n_comp ) + 1u, 0u );
+	for ( Index const c : comp ) ++off[ c + 1u ];
+	for ( Index c = 0u; c < n_comp; ++c ) off[ c + 1u ] += off[ c ];
+	members.resize( comp.size() );
+	std::vector< Index > pos( off.begin(), off.end() - 1 );
+	for ( Index i = 0u, n = Index( comp.size() ); i < n; ++i ) members[ pos[ comp[ i ] ]++ ] = i;
+}
+
+} // QSS
+
+#endif
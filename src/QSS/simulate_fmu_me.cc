@@ -37,6 +37,7 @@
 #include <QSS/cpu_time.hh>
 #include <QSS/simulate_fmu_me.hh>
 #include <QSS/FMU_ME.hh>
+#include <QSS/perf_ctl.hh>
 
 // OpenMP Headers
 #ifdef _OPENMP
@@ -61,7 +62,9 @@ double const wall_time_beg( omp_get_wtime() );
 #ifdef _OPENMP
 	std::cerr << "Setup wall time: " << omp_get_wtime() - wall_time_beg << std::endl;
 #endif
+	perf_enable();
 	fmu_me.simulate();
+	perf_disable();
 	fmu_me.post_simulate();
 }
 
@@ -38,7 +38,9 @@
 #include <QSS/FMU_ME.hh>
 #include <QSS/Variable_Con.hh>
 #include <QSS/options.hh>
+#include <QSS/perf_ctl.hh>
 #include <QSS/string.hh>
+#include <QSS/Timing.hh>
 
 // C++ Headers
 #include <algorithm>
@@ -96,6 +98,7 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 	}
 
 	// Connect model inputs to outputs
+	Timing::Phase connection_timing( "models", "connection setup" );
 	std::cout << "\nConnection Setup =====" << std::endl;
 	using ModelRef = std::pair< size_type, Variable * >;
 	for ( auto j = options::con.begin(), ej = options::con.end(); j != ej; ++j ) {
@@ -110,8 +113,8 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 			std::string const & model( fmu_me.name );
 			if ( has_prefix( inp, model + '.' ) ) {
 				std::string const var_name( inp.substr( model.length() + 1u ) );
-				auto const ivr( fmu_me.var_name_var.find( var_name ) );
-				if ( ivr == fmu_me.var_name_var.end() ) {
+				Variable * const var( fmu_me.var_named( var_name ) );
+				if ( var == nullptr ) {
 					std::cerr << "\nError: Connection input variable not found: " << inp << std::endl;
 					std::exit( EXIT_FAILURE );
 				} else if ( inp_found ) {
@@ -119,13 +122,13 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 					std::exit( EXIT_FAILURE );
 				} else {
 					inp_found = true;
-					inp_ref = ModelRef( i, ivr->second );
+					inp_ref = ModelRef( i, var );
 				}
 			}
 			if ( has_prefix( out, model + '.' ) ) {
 				std::string const var_name( out.substr( model.length() + 1u ) );
-				auto const ivr( fmu_me.var_name_var.find( var_name ) );
-				if ( ivr == fmu_me.var_name_var.end() ) {
+				Variable * const var( fmu_me.var_named( var_name ) );
+				if ( var == nullptr ) {
 					std::cerr << "\nError: Connection output variable not found: " << out << std::endl;
 					std::exit( EXIT_FAILURE );
 				} else if ( out_found ) {
@@ -133,8 +136,8 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 					std::exit( EXIT_FAILURE );
 				} else {
 					out_found = true;
-					out_ref = ModelRef( i, ivr->second );
-					ivr->second->connected_output = true;
+					out_ref = ModelRef( i, var );
+					var->connected_output = true;
 				}
 			}
 		}
@@ -160,43 +163,59 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 		}
 	}
 
+	connection_timing.end();
+
 	// Initialize models
+	Timing::Phase init_timing( "models", "init" );
+	init_timing.sub( "0.0" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_0_0();
 	}
+	init_timing.sub( "0.1" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_0_1();
 	}
+	init_timing.sub( "0.2" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_0_2();
 	}
+	init_timing.sub( "1.1" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_1_1();
 	}
+	init_timing.sub( "1.2" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_1_2();
 	}
+	init_timing.sub( "2.1" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_2_1();
 	}
+	init_timing.sub( "2.2" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_2_2();
 	}
+	init_timing.sub( "3.1" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_3_1();
 	}
+	init_timing.sub( "ZC" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_ZC();
 	}
+	init_timing.sub( "F" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_F();
 	}
+	init_timing.sub( "t0" );
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_t0();
 	}
+	init_timing.sub_end();
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->init_pre_simulate();
 	}
+	init_timing.end();
 
 	// EventInfo setup
 	std::vector< fmi2_event_info_t > eventInfos;
@@ -224,6 +243,7 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 	}
 
 	// Simulation loop
+	perf_enable();
 	Time time( tStart );
 	while ( time <= tStop ) {
 		fmi2_event_info_t & eventInfo( eventInfos[ top_model ] );
@@ -244,6 +264,8 @@ simulate_fmu_me_con_perfect( std::vector< std::string > const & paths )
 		time = top_time;
 	}
 
+	perf_disable();
+
 	// Post-simulate
 	for ( size_type i = 0u; i < n_models; ++i ) {
 		fmu_mes[ i ]->post_simulate();
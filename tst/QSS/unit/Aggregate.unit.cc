@@ -0,0 +1,92 @@
+// QSS::Aggregate Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Aggregate.hh>
+
+using namespace QSS;
+
+TEST( AggregateTest, Linear )
+{
+	Aggregate agg;
+	EXPECT_FALSE( agg.started() );
+	agg.update( 0.0, 0.0, 1.0 ); // x = t
+	EXPECT_TRUE( agg.started() );
+	agg.accumulate( 2.0 );
+	EXPECT_DOUBLE_EQ( 2.0, agg.integral() );
+	EXPECT_DOUBLE_EQ( 0.0, agg.min() );
+	EXPECT_DOUBLE_EQ( 2.0, agg.max() );
+	EXPECT_DOUBLE_EQ( 0.0, agg.tB() );
+	EXPECT_DOUBLE_EQ( 2.0, agg.tA() );
+}
+
+TEST( AggregateTest, Quadratic )
+{
+	Aggregate agg( { 0.75, 2.0, -1.0 } );
+	agg.update( 0.0, 0.0, 2.0, -1.0 ); // x = 2 t - t^2
+	agg.accumulate( 2.0 );
+	EXPECT_DOUBLE_EQ( 4.0 / 3.0, agg.integral() );
+	EXPECT_DOUBLE_EQ( 0.0, agg.min() );
+	EXPECT_DOUBLE_EQ( 1.0, agg.max() ); // Interior max
+	EXPECT_NEAR( 1.0, agg.t_above( 0 ), 1.0e-14 );
+	EXPECT_DOUBLE_EQ( 0.0, agg.t_above( 1 ) );
+	EXPECT_DOUBLE_EQ( 2.0, agg.t_above( 2 ) );
+}
+
+TEST( AggregateTest, Segments )
+{
+	Aggregate agg( { 0.5 } );
+	agg.update( 0.0, 1.0 ); // x = 1
+	agg.update( 1.0, 1.0, -1.0 ); // x = 1 - ( t - 1 )
+	agg.update( 3.0, 0.0, 0.0, 0.0, 1.0 ); // x = ( t - 3 )^3
+	agg.accumulate( 4.0 );
+	EXPECT_DOUBLE_EQ( 1.0 + 0.0 + 0.25, agg.integral() );
+	EXPECT_DOUBLE_EQ( -1.0, agg.min() );
+	EXPECT_DOUBLE_EQ( 1.0, agg.max() );
+	EXPECT_NEAR( 1.0 + 0.5 + ( 1.0 - std::cbrt( 0.5 ) ), agg.t_above( 0 ), 1.0e-14 );
+}
+
+TEST( AggregateTest, Rebase )
+{
+	Aggregate agg;
+	agg.update( 0.0, 0.0, 0.0, 0.0, 1.0 ); // x = t^3
+	agg.accumulate( 1.0 ); // Partial accumulation rebases the segment
+	agg.accumulate( 2.0 );
+	EXPECT_DOUBLE_EQ( 4.0, agg.integral() );
+	EXPECT_DOUBLE_EQ( 8.0, agg.max() );
+}
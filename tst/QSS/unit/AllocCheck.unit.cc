@@ -0,0 +1,89 @@
+// QSS::AllocCheck Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/AllocCheck.hh>
+#ifndef QSS_ALLOC_CHECK // Library doesn't provide the hook
+#include <QSS/AllocCheck.hook.hh>
+#endif
+#include <QSS/EventQueue.hh>
+
+// C++ Headers
+#include <memory>
+#include <vector>
+
+using namespace QSS;
+
+// Variable Mock
+class V final {};
+
+TEST( AllocCheckTest, Basic )
+{
+	EXPECT_TRUE( AllocCheck::hooked() );
+	std::vector< int > v;
+	v.reserve( 10u );
+	AllocCheck::arm();
+	EXPECT_TRUE( AllocCheck::armed() );
+	for ( int i = 0; i < 10; ++i ) v.push_back( i ); // Within capacity
+	EXPECT_EQ( 0u, AllocCheck::count() );
+	std::unique_ptr< int > p( new int( 1 ) );
+	EXPECT_EQ( 1u, AllocCheck::count() );
+	AllocCheck::disarm();
+	EXPECT_FALSE( AllocCheck::armed() );
+	std::unique_ptr< int > q( new int( 2 ) );
+	EXPECT_EQ( 1u, AllocCheck::count() );
+}
+
+TEST( AllocCheckTest, EventQueueShift )
+{
+	std::vector< V > vars( 10u );
+	EventQueue< V > events;
+	std::vector< EventQueue< V >::iterator > its;
+	its.reserve( vars.size() );
+	for ( std::size_t i = 0u; i < vars.size(); ++i ) its.push_back( events.add_QSS( double( i ), &vars[ i ] ) );
+	events.set_active_time();
+	AllocCheck::arm();
+	for ( int pass = 0; pass < 100; ++pass ) { // Steady-state requantization event shifts
+		its[ 0 ] = events.shift_QSS( events.top_time() + 10.0, its[ 0 ] );
+		std::rotate( its.begin(), its.begin() + 1, its.end() );
+		events.set_active_time();
+	}
+	AllocCheck::disarm();
+	EXPECT_EQ( 0u, AllocCheck::count() );
+}
@@ -0,0 +1,110 @@
+// QSS::Arena Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Arena.hh>
+
+// C++ Headers
+#include <cstdint>
+
+using namespace QSS;
+
+namespace {
+
+struct Base
+{
+	virtual ~Base() { ++destroyed; }
+	static int destroyed;
+};
+
+int Base::destroyed( 0 );
+
+struct Small final : Base
+{
+	explicit Small( int v ) : v( v ) {}
+	int v;
+};
+
+struct Big final : Base
+{
+	Big( double a, double b ) : a( a ), b( b ) {}
+	double a, b, c[ 8 ]{};
+};
+
+} // Unnamed
+
+TEST( ArenaTest, Slots )
+{
+	Arena arena( 3u, sizeof( Big ) );
+	EXPECT_EQ( 3u, arena.n() );
+	EXPECT_EQ( 0u, arena.stride() % Arena::line );
+	EXPECT_LE( sizeof( Big ), arena.stride() );
+
+	// Construction order differs from slot order
+	Base * s( arena.make< Small >( 2u, 7 ) );
+	Base * b( arena.make< Big >( 0u, 1.0, 2.0 ) );
+	EXPECT_TRUE( arena.owns( s ) );
+	EXPECT_TRUE( arena.owns( b ) );
+	EXPECT_EQ( 2u, arena.slot( s ) );
+	EXPECT_EQ( 0u, arena.slot( b ) );
+	EXPECT_LT( static_cast< void * >( b ), static_cast< void * >( s ) );
+	EXPECT_EQ( 0u, reinterpret_cast< std::uintptr_t >( s ) % Arena::line );
+	EXPECT_EQ( 7, static_cast< Small * >( s )->v );
+	EXPECT_EQ( 2.0, static_cast< Big * >( b )->b );
+
+	// Heap objects are deleted and arena objects destroyed
+	Base * h( new Small( 3 ) );
+	EXPECT_FALSE( arena.owns( h ) );
+	Base::destroyed = 0;
+	arena.destroy( s );
+	arena.destroy( b );
+	arena.destroy( h );
+	EXPECT_EQ( 3, Base::destroyed );
+}
+
+TEST( ArenaTest, Empty )
+{
+	Arena arena;
+	EXPECT_TRUE( arena.empty() );
+	int i( 0 );
+	EXPECT_FALSE( arena.owns( &i ) );
+	arena.assign( 0u, 64u );
+	EXPECT_TRUE( arena.empty() );
+	EXPECT_EQ( 0u, arena.bytes() );
+}
@@ -117,3 +117,27 @@ TEST( BinOptimizerTest, Basic )
 	EXPECT_EQ( 12u, optimizer.rec_bin_size() );
 	}
 }
+
+TEST( BinOptimizerTest, Work )
+{
+	BinWork meter( 1.0 );
+	EXPECT_EQ( 1.0, meter.tb() );
+	EXPECT_EQ( 0u, meter.work() );
+	EXPECT_EQ( 0.0, meter( 1.0 ) );
+	meter += 100u;
+	meter += 300u;
+	EXPECT_EQ( 400u, meter.work() );
+	EXPECT_DOUBLE_EQ( 0.005, meter( 3.0 ) );
+	meter.start( 3.0 );
+	EXPECT_EQ( 3.0, meter.tb() );
+	EXPECT_EQ( 0u, meter.work() );
+
+	// Same work samples => Same recommendations
+	BinOptimizer optimizer1( 100u ), optimizer2( 100u );
+	BinWork meter1( 0.0 ), meter2( 0.0 );
+	meter1 += 2000u;
+	meter2 += 2000u;
+	optimizer1.add( 4u, meter1( 1.0 ) );
+	optimizer2.add( 4u, meter2( 1.0 ) );
+	EXPECT_EQ( optimizer1.rec_bin_size(), optimizer2.rec_bin_size() );
+}
@@ -0,0 +1,188 @@
+// QSS Zero-Crossing Bump Peers Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/BumpPeers.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Observee/Handler Variable Mock
+struct V
+{};
+
+// Zero-Crossing Variable Mock
+struct Z
+{
+	using Zs = std::vector< Z * >;
+	using Vs = std::vector< V const * >;
+
+	explicit
+	Z( std::size_t const ei_index_ ) :
+	 ei_index( ei_index_ )
+	{}
+
+	Vs const &
+	observees() const
+	{
+		return obs;
+	}
+
+	Zs const &
+	bump_peers() const
+	{
+		return peers;
+	}
+
+	Zs &
+	bump_peers()
+	{
+		return peers;
+	}
+
+	std::size_t ei_index{ 0u };
+	Vs obs; // Observees
+	Vs hdl; // Handlers
+	Zs peers; // Bump peers
+};
+
+using Zs = Z::Zs;
+
+// Set Bump Peers of Mock Zero-Crossing Variables
+void
+set_peers( Zs const & zs )
+{
+	set_bump_peers( zs, []( Z const * z ) -> Z::Vs const & { return z->hdl; } );
+}
+
+} // namespace
+
+TEST( BumpPeersTest, Peers )
+{
+	V a, b, c, h;
+	Z z0( 0u ), z1( 1u ), z2( 2u ), z3( 3u );
+	z0.obs = { &a };
+	z1.obs = { &b, &a }; // Shares observee a with z0
+	z2.obs = { &c };
+	z2.hdl = { &h }; // Handler h is observed by z3
+	z3.obs = { &h };
+	Zs const zs{ &z3, &z2, &z1, &z0 };
+	set_peers( zs );
+	EXPECT_EQ( Zs( { &z0, &z1 } ), z0.bump_peers() );
+	EXPECT_EQ( Zs( { &z0, &z1 } ), z1.bump_peers() );
+	EXPECT_EQ( Zs( { &z2, &z3 } ), z2.bump_peers() );
+	EXPECT_EQ( Zs( { &z3 } ), z3.bump_peers() ); // Handler dependency is one-way
+
+	// Re-setting is idempotent
+	set_peers( zs );
+	EXPECT_EQ( Zs( { &z0, &z1 } ), z0.bump_peers() );
+	EXPECT_EQ( Zs( { &z3 } ), z3.bump_peers() );
+}
+
+TEST( BumpPeersTest, Isolated )
+{
+	V a, b;
+	Z z0( 0u ), z1( 1u );
+	z0.obs = { &a };
+	z1.obs = { &b };
+	Zs const zs{ &z0, &z1 };
+	set_peers( zs );
+	EXPECT_EQ( Zs( { &z0 } ), z0.bump_peers() );
+	EXPECT_EQ( Zs( { &z1 } ), z1.bump_peers() );
+}
+
+TEST( BumpPeersTest, Merge )
+{
+	V a, b, c, h;
+	Z z0( 0u ), z1( 1u ), z2( 2u ), z3( 3u ), z4( 4u );
+	z0.obs = { &a };
+	z1.obs = { &a, &b };
+	z2.obs = { &c };
+	z2.hdl = { &h };
+	z3.obs = { &h };
+	z4.obs = { &b }; // Shares observee b with z1 but not a with z0
+	Zs const zs{ &z0, &z1, &z2, &z3, &z4 };
+	set_peers( zs );
+	EXPECT_EQ( Zs( { &z0, &z1, &z4 } ), z1.bump_peers() );
+
+	Zs bump{ &z4 }; // Stale contents are replaced
+	merge_bump_peers( Zs( { &z0 } ), bump );
+	EXPECT_EQ( Zs( { &z0, &z1 } ), bump );
+
+	merge_bump_peers( Zs( { &z0, &z2 } ), bump );
+	EXPECT_EQ( Zs( { &z0, &z1, &z2, &z3 } ), bump );
+
+	merge_bump_peers( Zs( { &z1, &z3 } ), bump );
+	EXPECT_EQ( Zs( { &z0, &z1, &z3, &z4 } ), bump );
+
+	merge_bump_peers( Zs(), bump );
+	EXPECT_TRUE( bump.empty() );
+}
+
+TEST( BumpPeersTest, BumpAllEquivalence )
+{
+	// Localized bumping matches --zcBumpAll when every zero-crossing variable is triggered
+	V a, b, c, h;
+	Z z0( 0u ), z1( 1u ), z2( 2u ), z3( 3u );
+	z0.obs = { &a };
+	z1.obs = { &b };
+	z2.obs = { &c };
+	z2.hdl = { &h };
+	z3.obs = { &h };
+	Zs const zs{ &z0, &z1, &z2, &z3 };
+	set_peers( zs );
+	Zs bump;
+	merge_bump_peers( zs, bump );
+	EXPECT_EQ( zs, bump );
+
+	// Localized bumping matches --zcBumpAll for any trigger when all zero-crossing variables share an observee
+	V s;
+	for ( Z * z : zs ) z->obs.push_back( &s );
+	set_peers( zs );
+	for ( Z * z : zs ) {
+		EXPECT_EQ( zs, z->bump_peers() );
+		merge_bump_peers( Zs( { z } ), bump );
+		EXPECT_EQ( zs, bump );
+	}
+}
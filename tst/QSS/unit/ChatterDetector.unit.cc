@@ -0,0 +1,84 @@
+// QSS::ChatterDetector Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/ChatterDetector.hh>
+
+using namespace QSS;
+
+TEST( ChatterDetectorTest, Off )
+{
+	ChatterDetector c;
+	EXPECT_FALSE( c.on() );
+	for ( int i = 0; i < 100; ++i ) {
+		EXPECT_FALSE( c.crossing( 1.0e-9 * i, i % 2 == 0 ? +1 : -1 ) );
+	}
+}
+
+TEST( ChatterDetectorTest, Chattering )
+{
+	ChatterDetector c( 4u, 1.0e-3 );
+	EXPECT_TRUE( c.on() );
+	EXPECT_EQ( 4u, c.n() );
+	EXPECT_DOUBLE_EQ( 1.0e-3, c.dt() );
+	EXPECT_FALSE( c.crossing( 0.0, +1 ) ); // First crossing is not a reversal
+	EXPECT_FALSE( c.crossing( 1.0e-4, -1 ) );
+	EXPECT_FALSE( c.crossing( 2.0e-4, +1 ) );
+	EXPECT_FALSE( c.crossing( 3.0e-4, -1 ) );
+	EXPECT_TRUE( c.crossing( 4.0e-4, +1 ) ); // 4 reversals within window
+	EXPECT_FALSE( c.crossing( 5.0e-4, -1 ) ); // History reset after detection
+	EXPECT_FALSE( c.crossing( 6.0e-4, +1 ) );
+	EXPECT_FALSE( c.crossing( 7.0e-4, -1 ) );
+	EXPECT_TRUE( c.crossing( 8.0e-4, +1 ) );
+}
+
+TEST( ChatterDetectorTest, NotChattering )
+{
+	ChatterDetector c( 4u, 1.0e-3 );
+	double t( 0.0 );
+	int dir( +1 );
+	for ( int i = 0; i < 100; ++i, t += 1.0e-2, dir = -dir ) { // Reversals slower than window
+		EXPECT_FALSE( c.crossing( t, dir ) );
+	}
+	for ( int i = 0; i < 100; ++i, t += 1.0e-6 ) { // Fast crossings in same direction are not reversals
+		EXPECT_FALSE( c.crossing( t, +1 ) );
+		EXPECT_FALSE( c.crossing( t, 0 ) );
+	}
+}
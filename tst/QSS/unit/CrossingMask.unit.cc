@@ -0,0 +1,115 @@
+// QSS Event Indicator Crossing Bitmask Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/CrossingMask.hh>
+
+// C++ Headers
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using namespace QSS;
+
+TEST( CrossingMaskTest, Basic )
+{
+	CrossingMask mask( 130u );
+	EXPECT_EQ( 130u, mask.size() );
+	EXPECT_FALSE( mask.any() );
+	mask.set( 0u );
+	mask.set( 64u );
+	mask.set( 129u );
+	EXPECT_TRUE( mask.any() );
+	EXPECT_EQ( 3u, mask.count() );
+	EXPECT_TRUE( mask.test( 64u ) );
+	EXPECT_FALSE( mask.test( 63u ) );
+	std::vector< std::size_t > ks;
+	mask.for_each( [&]( std::size_t const k ){ ks.push_back( k ); } );
+	EXPECT_EQ( std::vector< std::size_t >( { 0u, 64u, 129u } ), ks );
+	mask.clear();
+	EXPECT_FALSE( mask.any() );
+}
+
+TEST( CrossingMaskTest, Scan )
+{
+	for ( std::size_t const n : { 0u, 1u, 3u, 64u, 65u, 130u } ) {
+		std::vector< double > v( n ), v_last( n );
+		for ( std::size_t k = 0u; k < n; ++k ) {
+			v_last[ k ] = std::sin( 0.7 * k );
+			v[ k ] = ( k % 5u == 0u ? 0.0 : std::sin( 0.7 * k + 0.9 ) );
+		}
+		if ( n > 2u ) v[ 2 ] = std::numeric_limits< double >::quiet_NaN();
+		CrossingMask mask( n );
+		bool const any( mask.scan( v.data(), v_last.data() ) );
+		std::size_t n_crossings( 0u );
+		for ( std::size_t k = 0u; k < n; ++k ) {
+			bool const crossed( ( v[ k ] >= 0.0 ) != ( v_last[ k ] > 0.0 ) );
+			EXPECT_EQ( crossed, mask.test( k ) );
+			if ( crossed ) ++n_crossings;
+		}
+		EXPECT_EQ( n_crossings, mask.count() );
+		EXPECT_EQ( n_crossings > 0u, any );
+	}
+}
+
+TEST( CrossingMaskTest, Accumulate )
+{
+	std::vector< double > v_last( 70u, -1.0 ), v( 70u, -1.0 );
+	v[ 3 ] = 1.0;
+	v[ 68 ] = 0.0;
+	CrossingMask crossings( 70u ), detected( 70u );
+	EXPECT_TRUE( crossings.scan( v.data(), v_last.data() ) );
+	detected |= crossings;
+	v_last = v;
+	v[ 3 ] = -1.0; // Crossing back
+	v[ 10 ] = 2.0;
+	EXPECT_TRUE( crossings.scan( v.data(), v_last.data() ) );
+	EXPECT_EQ( 3u, crossings.count() ); // Zero at both scans also crosses: >= 0 now but not > 0 last
+	detected |= crossings;
+	std::vector< std::size_t > ks;
+	detected.for_each( [&]( std::size_t const k ){ ks.push_back( k ); } );
+	EXPECT_EQ( std::vector< std::size_t >( { 3u, 10u, 68u } ), ks );
+	EXPECT_TRUE( crossings.scan( v_last.data(), v_last.data() ) ); // Only a zero value crosses against itself
+	EXPECT_EQ( 1u, crossings.count() );
+	EXPECT_TRUE( crossings.test( 68u ) );
+	std::vector< double > const u( 70u, 1.0 );
+	EXPECT_FALSE( crossings.scan( u.data(), u.data() ) );
+	EXPECT_FALSE( crossings.any() );
+}
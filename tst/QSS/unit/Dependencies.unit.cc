@@ -0,0 +1,78 @@
+// QSS FMU Dependencies Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Dependencies.hh>
+
+// C++ Headers
+#include <vector>
+
+using namespace QSS;
+
+TEST( DependenciesTest, DepGraph )
+{
+	FMU_Dependencies deps( nullptr );
+	dep::Variable v2( 2u );
+	v2.add_observee( 3u );
+	v2.add_observee( 1u );
+	v2.add_observee( 3u );
+	deps.add( v2 );
+	deps.add( 4u ); // Entry with no observees
+	FMU_DepGraph g;
+	EXPECT_TRUE( g.empty() );
+	g.assign( deps, 5u );
+	EXPECT_FALSE( g.empty() );
+	EXPECT_EQ( 5u, g.n() );
+	EXPECT_FALSE( g.has( 1u ) );
+	EXPECT_TRUE( g.has( 2u ) );
+	EXPECT_TRUE( g.has( 4u ) );
+	EXPECT_FALSE( g.has( 6u ) );
+	EXPECT_EQ( 3u, g.n_edges() );
+	g.finalize();
+	EXPECT_EQ( 2u, g.n_edges() );
+	EXPECT_EQ( std::vector< FMU_DepGraph::Index >( { 1u, 3u } ), std::vector< FMU_DepGraph::Index >( g.begin( 2u ), g.end( 2u ) ) );
+	EXPECT_TRUE( g.begin( 4u ) == g.end( 4u ) );
+
+	// Rebuild edges: Entries are unchanged
+	g.assign( FMU_DepGraph::Edges{ { 4u, 5u }, { 2u, 5u } } );
+	EXPECT_TRUE( g.has( 2u ) );
+	EXPECT_TRUE( g.has( 4u ) );
+	EXPECT_EQ( std::vector< FMU_DepGraph::Index >( { 5u } ), std::vector< FMU_DepGraph::Index >( g.begin( 2u ), g.end( 2u ) ) );
+	EXPECT_EQ( std::vector< FMU_DepGraph::Index >( { 5u } ), std::vector< FMU_DepGraph::Index >( g.begin( 4u ), g.end( 4u ) ) );
+}
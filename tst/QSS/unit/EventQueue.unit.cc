@@ -40,6 +40,7 @@
 #include <QSS/EventQueue.hh>
 
 // C++ Headers
+#include <cstdint>
 #include <iterator>
 #include <vector>
 
@@ -91,3 +92,37 @@ TEST( EventQueueTest, Basic )
 	events.clear();
 	EXPECT_TRUE( events.empty() );
 }
+
+// Binning Variable Mock
+class B final
+{
+public:
+	B( Time const tE_, std::uint64_t const loc ) :
+	 tE( tE_ ),
+	 loc_( loc )
+	{}
+	std::uint64_t locality() const { return loc_; }
+	Time tQ{ 0.0 };
+	Time tE{ 0.0 };
+private:
+	std::uint64_t loc_{ 0u };
+};
+
+TEST( EventQueueTest, BinLocal )
+{
+	std::vector< B > vars;
+	vars.emplace_back( Time( 1.0 ), 1u );
+	vars.emplace_back( Time( 1.1 ), 2u );
+	vars.emplace_back( Time( 1.2 ), 1u );
+	vars.emplace_back( Time( 1.3 ), 3u );
+	EventQueue< B > events;
+	for ( B & var : vars ) events.add_QSS( var.tE, &var );
+
+	std::vector< B * > subs;
+	events.bin_QSS< B >( 3u, 0.25, subs ); // Time order
+	EXPECT_EQ( std::vector< B * >( { &vars[ 0 ], &vars[ 1 ], &vars[ 2 ] } ), subs );
+	events.bin_QSS< B >( 3u, 0.25, subs, true ); // Locality order
+	EXPECT_EQ( std::vector< B * >( { &vars[ 0 ], &vars[ 2 ], &vars[ 3 ] } ), subs );
+	events.bin_QSS< B >( 4u, 0.25, subs, true ); // Others fill remaining space
+	EXPECT_EQ( std::vector< B * >( { &vars[ 0 ], &vars[ 2 ], &vars[ 3 ], &vars[ 1 ] } ), subs );
+}
@@ -0,0 +1,135 @@
+// QSS::Glob Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Glob.hh>
+
+// C++ Headers
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace QSS;
+
+TEST( GlobTest, Literal )
+{
+	Glob const glob( "vol[3].T" );
+	EXPECT_TRUE( glob.is_literal() );
+	EXPECT_FALSE( glob.is_regex() );
+	EXPECT_TRUE( glob( "vol[3].T" ) );
+	EXPECT_FALSE( glob( "vol[3]xT" ) );
+	EXPECT_FALSE( glob( "vol[3].TT" ) );
+}
+
+TEST( GlobTest, Wildcards )
+{
+	Glob const prefix( "mass*" );
+	EXPECT_TRUE( prefix.is_prefix() );
+	EXPECT_TRUE( prefix( "mass" ) );
+	EXPECT_TRUE( prefix( "mass_duct_3" ) );
+	EXPECT_FALSE( prefix( "mas" ) );
+
+	Glob const glob( "vol*.?" );
+	EXPECT_FALSE( glob.is_literal() );
+	EXPECT_FALSE( glob.is_prefix() );
+	EXPECT_TRUE( glob( "vol.T" ) );
+	EXPECT_TRUE( glob( "vol[53].U" ) );
+	EXPECT_TRUE( glob( "vol.x.y.T" ) );
+	EXPECT_FALSE( glob( "vol[53].UU" ) );
+	EXPECT_FALSE( glob( "vol[53]U" ) );
+
+	Glob const star( "*a*b*" );
+	EXPECT_TRUE( star( "ab" ) );
+	EXPECT_TRUE( star( "xaxxbx" ) );
+	EXPECT_FALSE( star( "ba" ) );
+}
+
+TEST( GlobTest, RegexFallback )
+{
+	Glob const glob( "der(x*)" );
+	EXPECT_TRUE( glob.is_regex() );
+	EXPECT_TRUE( glob( "derx" ) ); // Parentheses are regex grouping as before
+	EXPECT_TRUE( glob( "derx12" ) );
+	Glob const alt( "a|b.c" );
+	EXPECT_TRUE( alt( "a" ) );
+	EXPECT_TRUE( alt( "b.c" ) );
+	EXPECT_FALSE( alt( "bxc" ) );
+	EXPECT_THROW( Glob( "x(" ), std::regex_error );
+}
+
+TEST( GlobTest, RegexEquivalence )
+{
+	std::vector< std::string > const specs{ "*", "a*", "*a", "a?c", "a*c*", "?*?", "[a]*.b", "a**b" };
+	std::vector< std::string > const names{ "", "a", "ab", "abc", "aXc", "ac", "cab", "acbc", "[a]x.b", "[a].b", "aab", "ba" };
+	for ( std::string const & spec : specs ) {
+		Glob const glob( spec );
+		std::regex const re( Glob::regex_string( spec ) );
+		for ( std::string const & name : names ) {
+			EXPECT_EQ( std::regex_match( name, re ), glob( name ) ) << spec << ' ' << name;
+		}
+	}
+}
+
+TEST( GlobsTest, OnePass )
+{
+	Globs globs;
+	globs.add( "vol*.T" );
+	globs.add( "mass*" );
+	globs.add( "floor.T" );
+	globs.add( "m*" );
+	globs.add( "ma|mb" );
+	EXPECT_EQ( 5u, globs.size() );
+
+	EXPECT_TRUE( globs.any( "floor.T" ) );
+	EXPECT_TRUE( globs.any( "vol3.T" ) );
+	EXPECT_FALSE( globs.any( "wall.T" ) );
+
+	EXPECT_EQ( 2u, globs.first( "floor.T" ) );
+	EXPECT_EQ( 1u, globs.first( "mass3" ) );
+	EXPECT_EQ( 3u, globs.first( "mb" ) );
+	EXPECT_EQ( Globs::npos, globs.first( "wall.T" ) );
+
+	Globs::Indexes idxs;
+	globs.matches( "mass", idxs );
+	EXPECT_EQ( Globs::Indexes( { 1u, 3u } ), idxs );
+	globs.matches( "ma", idxs );
+	EXPECT_EQ( Globs::Indexes( { 3u, 4u } ), idxs );
+	globs.matches( "x", idxs );
+	EXPECT_TRUE( idxs.empty() );
+}
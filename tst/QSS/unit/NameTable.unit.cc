@@ -0,0 +1,96 @@
+// QSS::NameTable Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/NameTable.hh>
+
+// C++ Headers
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QSS;
+
+TEST( NameTableTest, Intern )
+{
+	static int run( 0 ); // Table is a process singleton so names are made unique to each run of this test
+	std::string const prefix( "NameTableTest.Intern." + std::to_string( ++run ) + '.' );
+	NameTable & names( NameTable::instance() );
+	EXPECT_EQ( std::string(), names[ 0u ] );
+	std::string const long_name( prefix + "model.subsystem.component.port.variable_name_that_is_long_enough_to_need_heap_storage" );
+	EXPECT_EQ( NameTable::none, names.find( long_name ) );
+	NameTable::Id const id( names.intern( long_name ) );
+	EXPECT_NE( 0u, id );
+	EXPECT_EQ( long_name, names[ id ] );
+	EXPECT_EQ( long_name, names.name( id ) );
+	EXPECT_EQ( id, names.find( long_name ) );
+	NameTable::size_type const n( names.size() );
+	EXPECT_EQ( id, names.intern( long_name ) ); // Interned once
+	EXPECT_EQ( n, names.size() );
+	std::string const & stored( names[ id ] );
+	for ( int i = 0; i < 1000; ++i ) names.intern( prefix + 'x' + std::to_string( i ) );
+	EXPECT_EQ( &stored, &names[ id ] ); // Stored names don't move
+	EXPECT_EQ( n + 1000u, names.size() );
+	EXPECT_EQ( prefix + "x7", names[ names.find( prefix + "x7" ) ] );
+}
+
+TEST( NameTableTest, Concurrent )
+{
+	static int run( 0 );
+	std::string const prefix( "NameTableTest.Concurrent." + std::to_string( ++run ) + '.' );
+	NameTable & names( NameTable::instance() );
+	int const n_threads( 4 ), n_names( 2000 );
+	auto const name( [&]( int const t, int const i ){ return prefix + std::to_string( ( i + ( t * n_names / 2 ) ) % ( 2 * n_names ) ); } ); // Overlapping names across threads
+	std::vector< std::vector< NameTable::Id > > ids( n_threads );
+	std::vector< std::thread > threads;
+	for ( int t = 0; t < n_threads; ++t ) {
+		threads.emplace_back( [&,t](){ // Intern and look up while other threads insert
+			for ( int i = 0; i < n_names; ++i ) {
+				ids[ t ].push_back( names.intern( name( t, i ) ) );
+				EXPECT_EQ( name( t, i ), names[ ids[ t ].back() ] );
+			}
+		} );
+	}
+	for ( std::thread & thread : threads ) thread.join();
+	for ( int t = 0; t < n_threads; ++t ) {
+		for ( int i = 0; i < n_names; ++i ) {
+			EXPECT_EQ( ids[ t ][ i ], names.find( name( t, i ) ) ); // Each name interned once
+		}
+	}
+}
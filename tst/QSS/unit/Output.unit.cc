@@ -0,0 +1,136 @@
+// QSS::Output Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output.hh>
+#include <QSS/path.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+using namespace QSS;
+
+namespace {
+
+// File Exists?
+bool
+exists( std::string const & file )
+{
+	return std::ifstream( file ).good();
+}
+
+// File Contents
+std::string
+contents( std::string const & file )
+{
+	std::ifstream s( file, std::ios_base::binary );
+	return std::string( std::istreambuf_iterator< char >( s ), std::istreambuf_iterator< char >() );
+}
+
+} // namespace
+
+TEST( OutputTest, LazyCreation )
+{
+	std::string file;
+	{
+		Output<> out( path::tmp, "QSS_Output_Lazy", 'x' );
+		file = out.file();
+		std::remove( file.c_str() );
+		EXPECT_TRUE( out.pending() );
+		out.header( "Real", "K" );
+		out.append( 0.0, 1.0 );
+		EXPECT_FALSE( exists( file ) ); // Not created until flushed
+		out.flush();
+		EXPECT_FALSE( out.pending() );
+		EXPECT_TRUE( exists( file ) );
+		std::string const text( contents( file ) );
+		EXPECT_EQ( 0u, text.find( "Time Real\ns K\n" ) ); // Header written on creation
+		EXPECT_EQ( 3, std::count( text.begin(), text.end(), '\n' ) );
+		out.append( 1.0, 2.0 );
+	}
+	std::string const text( contents( file ) );
+	EXPECT_EQ( 4, std::count( text.begin(), text.end(), '\n' ) ); // Appended on destruction
+	std::remove( file.c_str() );
+}
+
+TEST( OutputTest, LazyNoEntries )
+{
+	std::string file;
+	{
+		Output<> out( path::tmp, "QSS_Output_Empty", 'x' );
+		file = out.file();
+		std::remove( file.c_str() );
+		out.header( "Real" );
+		EXPECT_FALSE( exists( file ) );
+	}
+	EXPECT_FALSE( exists( file ) ); // Never flushed and no entries: Not created
+	{
+		Output<> out( path::tmp, "QSS_Output_Empty", 'x' );
+		out.header( "Real" );
+		out.flush(); // End of run flush
+		EXPECT_TRUE( exists( file ) );
+	}
+	EXPECT_EQ( "Time Real\ns \n", contents( file ) ); // Created with its header by the flush
+	std::remove( file.c_str() );
+}
+
+TEST( OutputTest, DirRemoved )
+{
+	std::string const dir( path::tmp + path::sep + "QSS_Output_Dir" );
+	std::string file;
+	for ( int run = 0; run < 2; ++run ) { // Directory removed between runs is made again
+		Output<> out( dir, "QSS_Output_Dir", 'x' );
+		file = out.file();
+		out.append( 0.0, 1.0 );
+		out.flush();
+		EXPECT_TRUE( exists( file ) );
+		std::remove( file.c_str() );
+		std::remove( dir.c_str() );
+	}
+}
+
+TEST( OutputTest, NoInit )
+{
+	Output<> out( "QSS_Output_NoInit", 'x', false );
+	EXPECT_FALSE( out.pending() ); // Not an output file: Never created
+}
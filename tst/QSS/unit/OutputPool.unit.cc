@@ -0,0 +1,163 @@
+// QSS::OutputPool Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Output.hh>
+#include <QSS/OutputPool.hh>
+#include <QSS/path.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <future>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Number of Lines in a File
+std::size_t
+n_lines( std::string const & file )
+{
+	std::ifstream s( file );
+	std::size_t n( 0u );
+	std::string line;
+	while ( std::getline( s, line ) ) ++n;
+	return n;
+}
+
+} // namespace
+
+TEST( OutputPoolTest, Chunks )
+{
+	OutputPool & pool( OutputPool::instance() );
+	std::size_t const n_used( pool.n_used() );
+	{
+		Output<> out( path::tmp, "QSS_OutputPool_Chunks", 'x' );
+		EXPECT_EQ( n_used, pool.n_used() ); // No buffer until data is appended
+		out.append( 0.0, 1.0 );
+		EXPECT_EQ( n_used + 1u, pool.n_used() );
+		EXPECT_EQ( 1u, out.pooled() );
+		out.flush();
+		EXPECT_EQ( n_used, pool.n_used() ); // Chunk returned on flush
+		EXPECT_EQ( 0u, out.pooled() );
+		EXPECT_EQ( 1u, n_lines( out.file() ) );
+		std::remove( out.file().c_str() );
+	}
+	EXPECT_EQ( n_used, pool.n_used() );
+}
+
+TEST( OutputPoolTest, Budget )
+{
+	OutputPool::size_type const budget( OutputPool::budget() );
+	OutputPool & pool( OutputPool::instance() );
+	std::size_t const n_chunk_entries( OutputPool::chunk_bytes / ( 2u * sizeof( double ) ) );
+	{
+		std::vector< Output<> > outs;
+		outs.reserve( pool.n_chunks() + 2u );
+		outs.emplace_back( path::tmp, "QSS_OutputPool_Budget_0", 'x' );
+		for ( std::size_t i = 0; i < n_chunk_entries; ++i ) outs[ 0 ].append( double( i ), 2.0 * i ); // Fullest client
+		OutputPool::budget( pool.allocated() ); // No more allocation
+		std::size_t const n_free( pool.n_chunks() - pool.n_used() );
+		for ( std::size_t i = 1; i <= n_free; ++i ) { // Use all free chunks
+			outs.emplace_back( path::tmp, "QSS_OutputPool_Budget_" + std::to_string( i ), 'x' );
+			outs.back().append( 0.0, 1.0 );
+		}
+		EXPECT_EQ( pool.n_chunks(), pool.n_used() );
+		std::size_t const n_spills( pool.n_spills() );
+		outs.emplace_back( path::tmp, "QSS_OutputPool_Budget_" + std::to_string( n_free + 1u ), 'x' );
+		outs.back().append( 0.0, 3.0 ); // Forces spill of fullest clients
+		EXPECT_LT( n_spills, pool.n_spills() );
+		EXPECT_LE( pool.allocated(), OutputPool::budget() ); // Budget held
+		EXPECT_EQ( 0u, outs[ 0 ].pooled() );
+		EXPECT_EQ( n_chunk_entries, n_lines( outs[ 0 ].file() ) );
+		EXPECT_EQ( 1u, outs.back().pooled() );
+		for ( Output<> & out : outs ) out.flush();
+		EXPECT_EQ( 1u, n_lines( outs.back().file() ) );
+		for ( Output<> const & out : outs ) std::remove( out.file().c_str() );
+	}
+	OutputPool::budget( budget );
+}
+
+TEST( OutputPoolTest, Move )
+{
+	OutputPool & pool( OutputPool::instance() );
+	std::size_t const n_clients( pool.n_clients() );
+	std::vector< Output<> > outs;
+	outs.emplace_back( path::tmp, "QSS_OutputPool_Move_1", 'x' );
+	outs[ 0 ].append( 0.0, 1.0 );
+	EXPECT_EQ( n_clients + 1u, pool.n_clients() );
+	for ( int i = 2; i <= 8; ++i ) outs.emplace_back( path::tmp, "QSS_OutputPool_Move_" + std::to_string( i ), 'x' ); // Reallocation moves outs[ 0 ]
+	EXPECT_EQ( n_clients + 1u, pool.n_clients() );
+	EXPECT_EQ( 1u, outs[ 0 ].pooled() );
+	outs[ 0 ].flush();
+	EXPECT_EQ( n_clients, pool.n_clients() );
+	EXPECT_EQ( 1u, n_lines( outs[ 0 ].file() ) );
+	for ( Output<> & out : outs ) out.flush(); // Create pending files before removing them
+	for ( Output<> const & out : outs ) std::remove( out.file().c_str() );
+}
+
+TEST( OutputPoolTest, Owner )
+{
+	OutputPool & pool( OutputPool::instance() );
+	std::size_t const n_used( pool.n_used() );
+	Output<> out( path::tmp, "QSS_OutputPool_Owner", 'x' );
+	std::promise< void > appended, flushed;
+	std::size_t n_used_worker_appended( 0u ), n_used_worker_flushed( 0u );
+	std::thread worker( [&](){
+		OutputPool & pool_worker( OutputPool::instance() );
+		out.append( 0.0, 1.0 ); // Chunk from worker thread's pool
+		n_used_worker_appended = pool_worker.n_used();
+		appended.set_value();
+		flushed.get_future().wait();
+		n_used_worker_flushed = pool_worker.n_used();
+	} );
+	appended.get_future().wait();
+	EXPECT_EQ( n_used, pool.n_used() );
+	out.flush(); // Chunk returns to the worker thread's pool
+	flushed.set_value();
+	worker.join();
+	EXPECT_EQ( n_used, pool.n_used() );
+	EXPECT_EQ( 1u, n_used_worker_appended );
+	EXPECT_EQ( 0u, n_used_worker_flushed );
+	EXPECT_EQ( 1u, n_lines( out.file() ) );
+	std::remove( out.file().c_str() );
+}
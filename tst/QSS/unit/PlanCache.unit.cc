@@ -0,0 +1,105 @@
+// QSS::PlanCache Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/PlanCache.hh>
+
+// C++ Headers
+#include <vector>
+
+using namespace QSS;
+
+// Variable Mock
+class V final {};
+
+// Plan Mock
+class P final
+{
+public:
+	using Variables = std::vector< V * >;
+	explicit P( int * n_assign ) : n_assign_( n_assign ) {}
+	void assign( Variables const & triggers ) { ++*n_assign_; vars = triggers; }
+	Variables vars;
+private:
+	int * n_assign_{ nullptr };
+};
+
+TEST( PlanCacheTest, Basic )
+{
+	int n_assign( 0 );
+	PlanCache< P, int > plans( &n_assign, 2u );
+	EXPECT_TRUE( plans.on() );
+	std::vector< V > vars( 4u );
+	P::Variables ab( { &vars[ 0 ], &vars[ 1 ] } );
+	P::Variables ba( { &vars[ 1 ], &vars[ 0 ] } );
+	P::Variables cd( { &vars[ 2 ], &vars[ 3 ] } );
+	P::Variables ac( { &vars[ 0 ], &vars[ 2 ] } );
+
+	P & p_ab( plans( ab ) ); // Miss
+	EXPECT_EQ( 1, n_assign );
+	EXPECT_EQ( ab, p_ab.vars );
+	EXPECT_EQ( &p_ab, &plans( ba ) ); // Hit: Same set in another order
+	EXPECT_EQ( 1, n_assign );
+	EXPECT_EQ( ab, ba ); // Triggers reordered to plan order
+	plans( cd ); // Miss
+	EXPECT_EQ( 2, n_assign );
+	plans( ab ); // Hit
+	plans( ac ); // Miss: Evicts least recently used cd
+	EXPECT_EQ( 3, n_assign );
+	EXPECT_EQ( 2u, plans.size() );
+	plans( ab ); // Hit
+	plans( cd ); // Miss
+	EXPECT_EQ( 4, n_assign );
+	EXPECT_EQ( 3u, plans.n_hits() );
+	EXPECT_EQ( 4u, plans.n_misses() );
+}
+
+TEST( PlanCacheTest, Off )
+{
+	int n_assign( 0 );
+	PlanCache< P, int > plans( &n_assign, 0u );
+	EXPECT_FALSE( plans.on() );
+	std::vector< V > vars( 2u );
+	P::Variables ab( { &vars[ 0 ], &vars[ 1 ] } );
+	P & p1( plans( ab ) );
+	P & p2( plans( ab ) );
+	EXPECT_EQ( &p1, &p2 );
+	EXPECT_EQ( 2, n_assign );
+	EXPECT_EQ( 0u, plans.size() );
+}
@@ -0,0 +1,160 @@
+// QSS::Pooled Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Pooled.hh>
+#include <QSS/container.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <vector>
+
+using namespace QSS;
+
+TEST( PooledTest, Basic )
+{
+	Pooled< int > a;
+	EXPECT_TRUE( a.empty() );
+	EXPECT_FALSE( a.pooled() );
+	for ( int i = 5; i > 0; --i ) a.push_back( i );
+	a.push_back( 3 );
+	EXPECT_EQ( 6u, a.size() );
+	EXPECT_EQ( 5, a.front() );
+	EXPECT_EQ( 3, a.back() );
+	uniquify( a, true );
+	EXPECT_EQ( ( std::vector< int >{ 1, 2, 3, 4, 5 } ), std::vector< int >( a.begin(), a.end() ) );
+	EXPECT_EQ( 5u, a.capacity() );
+	a.erase( a.begin() + 1 );
+	EXPECT_EQ( ( std::vector< int >{ 1, 3, 4, 5 } ), std::vector< int >( a.begin(), a.end() ) );
+	a.resize( 6, 7 );
+	EXPECT_EQ( ( std::vector< int >{ 1, 3, 4, 5, 7, 7 } ), std::vector< int >( a.begin(), a.end() ) );
+	Pooled< int > b( a );
+	EXPECT_EQ( 6u, b.size() );
+	EXPECT_NE( a.data(), b.data() );
+	a.clear();
+	EXPECT_TRUE( a.empty() );
+	EXPECT_EQ( 7, b[ 5 ] );
+}
+
+TEST( PooledTest, Pool )
+{
+	Pool< double > pool;
+	pool.reserve( 5u );
+	Pooled< double > a, b, e;
+	std::vector< double > const v{ 1.0, 2.0, 3.0 };
+	a.assign( v.begin(), v.end() );
+	b.resize( 2, 4.0 );
+	a.pool( pool );
+	b.pool( pool );
+	e.pool( pool );
+	EXPECT_TRUE( a.pooled() );
+	EXPECT_TRUE( b.pooled() );
+	EXPECT_FALSE( e.pooled() );
+	EXPECT_EQ( 1u, pool.blocks() );
+	EXPECT_EQ( 5u, pool.size() );
+	EXPECT_EQ( a.data() + 3, b.data() ); // Contiguous in pool order
+	EXPECT_EQ( 3u, a.size() );
+	EXPECT_EQ( 2.0, a[ 1 ] );
+	EXPECT_EQ( 4.0, b[ 1 ] );
+
+	// In-place changes stay in the pool
+	double * const p( a.data() );
+	a[ 0 ] = 9.0;
+	std::sort( a.begin(), a.end() );
+	EXPECT_EQ( p, a.data() );
+	EXPECT_EQ( 9.0, a.back() );
+	a.erase( a.begin() );
+	EXPECT_TRUE( a.pooled() );
+	EXPECT_EQ( 2u, a.size() );
+
+	// Growth moves to an owned buffer
+	b.push_back( 5.0 );
+	EXPECT_FALSE( b.pooled() );
+	EXPECT_EQ( ( std::vector< double >{ 4.0, 4.0, 5.0 } ), std::vector< double >( b.begin(), b.end() ) );
+
+	// Clear drops the pooled segment
+	a.clear();
+	EXPECT_FALSE( a.pooled() );
+	EXPECT_EQ( nullptr, a.data() );
+
+	// Pool grows by blocks without moving existing segments
+	Pooled< double > c;
+	c.resize( 10u, 1.0 );
+	c.pool( pool );
+	EXPECT_EQ( 2u, pool.blocks() );
+	EXPECT_EQ( 15u, pool.size() );
+}
+
+TEST( PooledTest, ReservePool )
+{
+	Pool< int > pool;
+	pool.reserve( 8u );
+	Pooled< int > a, b;
+	a.push_back( 9 ); // Owned buffer is released
+	a.reserve( pool, 3u );
+	b.reserve( pool, 2u );
+	EXPECT_TRUE( a.pooled() );
+	EXPECT_TRUE( a.empty() );
+	EXPECT_EQ( 3u, a.capacity() );
+	EXPECT_EQ( 5u, pool.size() );
+
+	// Built in place within the reserved segments
+	a.push_back( 1 );
+	a.push_back( 2 );
+	a.push_back( 3 );
+	b.resize( 2u, 7 );
+	EXPECT_TRUE( a.pooled() );
+	EXPECT_TRUE( b.pooled() );
+	EXPECT_EQ( a.data() + 3, b.data() ); // Contiguous in setup order
+	EXPECT_EQ( 3, a[ 2 ] );
+	EXPECT_EQ( 7, b[ 1 ] );
+	EXPECT_EQ( 1u, pool.blocks() );
+
+	// Growth past the segment moves to an owned buffer
+	a.push_back( 4 );
+	EXPECT_FALSE( a.pooled() );
+	EXPECT_EQ( 4u, a.size() );
+	EXPECT_EQ( 4, a.back() );
+
+	// Empty reservation takes nothing
+	Pooled< int > e;
+	e.reserve( pool, 0u );
+	EXPECT_FALSE( e.pooled() );
+	EXPECT_EQ( 5u, pool.size() );
+}
@@ -0,0 +1,112 @@
+// QSS CSV Results Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Results_CSV.hh>
+
+// C++ Headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+using namespace QSS;
+
+TEST( Results_CSVTest, Values )
+{
+	std::string const nam( "Results_CSV.unit" );
+	{
+		Results_CSV<> csv( nam );
+		csv.labels( { "time", "x", "y" } );
+		csv.values( { 0.0, 1.5, -2.0 } );
+		csv.values( { 1.0, 1.0e-120, 3.0e100 } );
+	} // Buffered values written at destruction
+	std::ifstream csv_stream( nam + ".csv", std::ios_base::binary | std::ios_base::in );
+	ASSERT_TRUE( csv_stream.is_open() );
+	std::string line;
+	std::getline( csv_stream, line );
+	EXPECT_EQ( "\"time\",\"x\",\"y\"", line );
+	std::getline( csv_stream, line );
+	EXPECT_EQ( 3u * Results_CSV<>::column_bytes - 1u, line.length() ); // Fixed-width columns
+	std::istringstream line_stream( line );
+	double v;
+	char c;
+	line_stream >> v >> c;
+	EXPECT_DOUBLE_EQ( 0.0, v );
+	line_stream >> v >> c;
+	EXPECT_DOUBLE_EQ( 1.5, v );
+	line_stream >> v;
+	EXPECT_DOUBLE_EQ( -2.0, v );
+	std::getline( csv_stream, line );
+	EXPECT_EQ( 3u * Results_CSV<>::column_bytes - 1u, line.length() );
+	line_stream.clear();
+	line_stream.str( line );
+	line_stream >> v >> c;
+	EXPECT_DOUBLE_EQ( 1.0, v );
+	line_stream >> v >> c;
+	EXPECT_DOUBLE_EQ( 1.0e-120, v );
+	line_stream >> v;
+	EXPECT_DOUBLE_EQ( 3.0e100, v );
+	EXPECT_FALSE( std::getline( csv_stream, line ) );
+	csv_stream.close();
+	std::remove( ( nam + ".csv" ).c_str() );
+}
+
+TEST( Results_CSVTest, WideRows )
+{
+	std::string const nam( "Results_CSV.wide.unit" );
+	Results_CSV<>::size_type const n( 50000u ); // Row larger than a block
+	Results_CSV<>::Values vals( n );
+	for ( Results_CSV<>::size_type i = 0; i < n; ++i ) vals[ i ] = double( i );
+	{
+		Results_CSV<> csv( nam );
+		csv.values( vals );
+		csv.values( vals );
+	}
+	std::ifstream csv_stream( nam + ".csv", std::ios_base::binary | std::ios_base::in );
+	ASSERT_TRUE( csv_stream.is_open() );
+	std::string line;
+	for ( int r = 0; r < 2; ++r ) {
+		std::getline( csv_stream, line );
+		ASSERT_EQ( n * Results_CSV<>::column_bytes - 1u, line.length() );
+		EXPECT_DOUBLE_EQ( double( n - 1u ), std::stod( line.substr( ( n - 1u ) * Results_CSV<>::column_bytes ) ) );
+	}
+	csv_stream.close();
+	std::remove( ( nam + ".csv" ).c_str() );
+}
@@ -0,0 +1,135 @@
+// QSS Batched Root Solvers Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/RootBatch.hh>
+#include <QSS/math.hh>
+
+// C++ Headers
+#include <cstddef>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Scalar QSS2 Requantization Boundary Root Selection
+double
+min_root_quadratic_bounds_scalar( double const a, double const b, double const cl, double const cu )
+{
+	if ( ( b >= 0.0 ) && ( a >= 0.0 ) ) { // Upper boundary crossing
+		return min_root_quadratic_upper( a, b, cu );
+	} else if ( ( b <= 0.0 ) && ( a <= 0.0 ) ) { // Lower boundary crossing
+		return min_root_quadratic_lower( a, b, cl );
+	} else { // Both boundaries can have crossings
+		return min_root_quadratic_both( a, b, cl, cu );
+	}
+}
+
+// Problem Set
+struct Problems
+{
+	Problems()
+	{
+		for ( double const a_ : { -3.0, -1.0, -1.0e-9, 0.0, 1.0e-9, 0.25, 2.0 } ) {
+			for ( double const b_ : { -5.0, -0.5, -1.0e-7, 0.0, 1.0e-7, 0.75, 4.0 } ) {
+				for ( double const d_0 : { -0.2, -1.0e-4, 0.0, 3.0e-4, 0.15 } ) {
+					for ( double const qTol : { 1.0e-3, 0.1, 0.5 } ) {
+						a.push_back( a_ );
+						b.push_back( b_ );
+						cl.push_back( d_0 + qTol );
+						cu.push_back( d_0 - qTol );
+					}
+				}
+			}
+		}
+		a.push_back( 1.0 ); b.push_back( 1.0 ); cl.push_back( 0.0 ); cu.push_back( -1.0 ); // Precision loss
+		a.push_back( -1.0 ); b.push_back( 1.0 ); cl.push_back( 1.0 ); cu.push_back( 0.0 ); // Precision loss
+		a.push_back( 1.0 ); b.push_back( -2.0 ); cl.push_back( 1.0 ); cu.push_back( -1.0 ); // Double root on lower boundary
+	}
+
+	std::size_t
+	size() const
+	{
+		return a.size();
+	}
+
+	std::vector< double > a, b, cl, cu;
+};
+
+} // namespace
+
+TEST( RootBatchTest, Bounds )
+{
+	Problems const p;
+	std::vector< double > root( p.size() );
+	min_root_quadratic_bounds( p.size(), p.a.data(), p.b.data(), p.cl.data(), p.cu.data(), root.data() );
+	for ( std::size_t i = 0u; i < p.size(); ++i ) {
+		EXPECT_DOUBLE_EQ( min_root_quadratic_bounds_scalar( p.a[ i ], p.b[ i ], p.cl[ i ], p.cu[ i ] ), root[ i ] ) << i;
+		EXPECT_DOUBLE_EQ( root[ i ], min_root_quadratic_bounds_lane( p.a[ i ], p.b[ i ], p.cl[ i ], p.cu[ i ] ) ) << i;
+	}
+}
+
+TEST( RootBatchTest, Both )
+{
+	Problems const p;
+	std::vector< double > root( p.size() );
+	min_root_quadratic_both( p.size(), p.a.data(), p.b.data(), p.cl.data(), p.cu.data(), root.data() );
+	for ( std::size_t i = 0u; i < p.size(); ++i ) {
+		EXPECT_DOUBLE_EQ( min_root_quadratic_both( p.a[ i ], p.b[ i ], p.cl[ i ], p.cu[ i ] ), root[ i ] ) << i;
+	}
+}
+
+TEST( RootBatchTest, Batch )
+{
+	Problems const p;
+	RootBatch batch;
+	EXPECT_TRUE( batch.empty() );
+	for ( int pass = 0; pass < 2; ++pass ) { // Reuse after clear
+		batch.clear();
+		for ( std::size_t i = 0u; i < p.size(); ++i ) {
+			batch.add( p.a[ i ], p.b[ i ], p.cl[ i ], p.cu[ i ] );
+		}
+		EXPECT_EQ( p.size(), batch.size() );
+		batch.solve();
+		for ( std::size_t i = 0u; i < p.size(); ++i ) {
+			EXPECT_DOUBLE_EQ( min_root_quadratic_bounds_scalar( p.a[ i ], p.b[ i ], p.cl[ i ], p.cu[ i ] ), batch[ i ] ) << i;
+		}
+	}
+}
@@ -0,0 +1,105 @@
+// QSS Shared-Memory Ring Buffer Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/ShmRing.hh>
+
+#ifndef _WIN32
+
+// C Headers
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// C++ Headers
+#include <cstring>
+
+using namespace QSS;
+
+TEST( ShmRingTest, PublishRead )
+{
+	std::string const name( ShmRing::object_name( "ShmRingTest/PublishRead" ) );
+	EXPECT_EQ( "/QSS.ShmRingTest_PublishRead", name );
+	ShmRing ring( name, 5u, ShmRing::Vars{ { 3u, "x" }, { 7u, "y" } } );
+	ASSERT_TRUE( ring.is_open() );
+	EXPECT_EQ( 8u, ring.capacity() ); // Rounded up to power of 2
+
+	// Reader mapping
+	int const fd( ::shm_open( name.c_str(), O_RDONLY, 0 ) );
+	ASSERT_GE( fd, 0 );
+	struct stat st;
+	ASSERT_EQ( 0, ::fstat( fd, &st ) );
+	void * const p( ::mmap( nullptr, static_cast< std::size_t >( st.st_size ), PROT_READ, MAP_SHARED, fd, 0 ) );
+	::close( fd );
+	ASSERT_NE( MAP_FAILED, p );
+	ShmRing::Header const * header( static_cast< ShmRing::Header const * >( p ) );
+	EXPECT_EQ( 0, std::strncmp( header->magic, "QSSRING", 8 ) );
+	EXPECT_EQ( 8u, header->capacity );
+	EXPECT_EQ( 2u, header->n_vars );
+	EXPECT_EQ( 0u, header->head.load() );
+
+	// Publish and read back
+	for ( std::uint32_t i = 0; i < 3u; ++i ) ring.append( 3u, double( i ), 10.0 * i );
+	EXPECT_EQ( 3u, header->head.load() );
+	ShmRing::Record rec;
+	ASSERT_TRUE( ShmRing::read( header, 2u, rec ) );
+	EXPECT_EQ( 3u, rec.id );
+	EXPECT_DOUBLE_EQ( 2.0, rec.t );
+	EXPECT_DOUBLE_EQ( 20.0, rec.v );
+	EXPECT_FALSE( ShmRing::read( header, 3u, rec ) ); // Not yet published
+
+	// Overwrite: Records older than capacity fail validation
+	for ( std::uint32_t i = 3u; i < 12u; ++i ) ring.append( 7u, double( i ), 10.0 * i, ShmRing::Kind::q );
+	EXPECT_EQ( 12u, header->head.load() );
+	EXPECT_FALSE( ShmRing::read( header, 2u, rec ) );
+	ASSERT_TRUE( ShmRing::read( header, 11u, rec ) );
+	EXPECT_EQ( 7u, rec.id );
+	EXPECT_EQ( std::uint32_t( ShmRing::Kind::q ), rec.kind );
+	EXPECT_DOUBLE_EQ( 110.0, rec.v );
+
+	EXPECT_EQ( 0u, header->done.load() );
+	ring.finish();
+	EXPECT_EQ( 1u, header->done.load() );
+
+	::munmap( p, static_cast< std::size_t >( st.st_size ) );
+	::shm_unlink( name.c_str() );
+}
+
+#endif
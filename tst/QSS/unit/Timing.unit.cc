@@ -0,0 +1,167 @@
+// QSS::Timing Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/Timing.hh>
+#include <QSS/options.hh>
+
+// C++ Headers
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QSS;
+
+TEST( TimingTest, Off )
+{
+	Timing & timing( Timing::instance() );
+	timing.clear();
+	options::timing.clear();
+	{
+		Timing::Phase phase( "model", "setup" );
+		phase.sub( "stage" );
+	}
+	EXPECT_TRUE( timing.records().empty() );
+}
+
+TEST( TimingTest, Phases )
+{
+	Timing & timing( Timing::instance() );
+	timing.clear();
+	options::timing = "timing.json";
+	{
+		Timing::Phase phase( "model", "pre_simulate" );
+		phase.sub( "variables" );
+		{
+			Timing::Phase nested( "model", "layout" );
+		}
+		phase.sub( "dependencies" );
+	}
+	{
+		Timing::Phase phase( "model", "init" );
+		phase.sub( "0.0" );
+		phase.end();
+		phase.end(); // Idempotent
+	}
+	options::timing.clear();
+	Timing::Records const & records( timing.records() );
+	ASSERT_EQ( 6u, records.size() );
+	EXPECT_EQ( "pre_simulate", records[ 0 ].phase );
+	EXPECT_EQ( 0u, records[ 0 ].depth );
+	EXPECT_EQ( "pre_simulate/variables", records[ 1 ].phase );
+	EXPECT_EQ( 1u, records[ 1 ].depth );
+	EXPECT_EQ( "pre_simulate/variables/layout", records[ 2 ].phase );
+	EXPECT_EQ( 2u, records[ 2 ].depth );
+	EXPECT_EQ( "pre_simulate/dependencies", records[ 3 ].phase );
+	EXPECT_EQ( "init", records[ 4 ].phase );
+	EXPECT_EQ( "init/0.0", records[ 5 ].phase );
+	for ( Timing::Record const & record : records ) {
+		EXPECT_EQ( "model", record.model );
+		EXPECT_GE( record.wall, 0.0 );
+		EXPECT_GE( record.cpu, 0.0 );
+	}
+	EXPECT_GE( records[ 0 ].wall, records[ 1 ].wall + records[ 3 ].wall );
+	EXPECT_GT( Timing::peak_rss(), 0u );
+
+	std::ostringstream json;
+	timing.json( json );
+	EXPECT_NE( std::string::npos, json.str().find( "\"phase\": \"pre_simulate/variables/layout\", \"depth\": 2" ) );
+	std::ostringstream report;
+	timing.report( report );
+	EXPECT_NE( std::string::npos, report.str().find( "model:     layout" ) );
+	timing.clear();
+}
+
+TEST( TimingTest, StreamState )
+{
+	Timing & timing( Timing::instance() );
+	timing.clear();
+	options::timing = "timing.json";
+	{
+		Timing::Phase phase( "model", "setup" );
+	}
+	options::timing.clear();
+	std::ostringstream report;
+	report << std::setprecision( 9 );
+	timing.report( report );
+	EXPECT_EQ( 9, report.precision() ); // Caller's format state restored
+	EXPECT_FALSE( report.flags() & std::ios_base::fixed );
+	std::ostringstream json;
+	json << std::scientific;
+	timing.json( json );
+	EXPECT_EQ( 6, json.precision() );
+	EXPECT_TRUE( json.flags() & std::ios_base::scientific );
+	timing.clear();
+}
+
+TEST( TimingTest, Threads )
+{
+	Timing & timing( Timing::instance() );
+	timing.clear();
+	options::timing = "timing.json";
+	int const n_threads( 4 );
+	std::vector< std::thread > threads;
+	for ( int t = 0; t < n_threads; ++t ) {
+		threads.emplace_back( [t](){ // Concurrent models with nested phases
+			std::string const model( "model" + std::to_string( t ) );
+			for ( int i = 0; i < 50; ++i ) {
+				Timing::Phase phase( model, "setup" );
+				phase.sub( "stage" );
+				Timing::Phase nested( model, "nested" );
+			}
+		} );
+	}
+	for ( std::thread & thread : threads ) thread.join();
+	options::timing.clear();
+	Timing::Records const & records( timing.records() );
+	ASSERT_EQ( n_threads * 50u * 3u, records.size() );
+	for ( Timing::Record const & record : records ) { // Sub-phases nest only within their own thread's phases
+		if ( record.depth == 0u ) {
+			EXPECT_EQ( "setup", record.phase );
+		} else if ( record.depth == 1u ) {
+			EXPECT_EQ( "setup/stage", record.phase );
+		} else {
+			EXPECT_EQ( 2u, record.depth );
+			EXPECT_EQ( "setup/stage/nested", record.phase );
+		}
+	}
+	timing.clear();
+}
@@ -148,3 +148,25 @@ TEST( Variable_QSS1Test, Achilles )
 	EXPECT_EQ( 2.0, x2->q( x2->tQ ) );
 	EXPECT_DOUBLE_EQ( -1.0, x2->x1( x2->tX ) );
 }
+
+TEST( Variable_QSS1Test, Layout )
+{
+	FMU_ME fmu;
+
+	Variable_QSS1 x1( &fmu, "x1", 1.0e-4, 1.0e-6, 0.0, 42.0 );
+	char const * hot_beg( reinterpret_cast< char const * >( &x1.tQ ) );
+	char const * hot_end( reinterpret_cast< char const * >( &x1.dt_max ) + sizeof( x1.dt_max ) );
+	EXPECT_LE( hot_end - hot_beg, 128 ); // Hot integration state fits in two cache lines
+	char const * obj_beg( reinterpret_cast< char const * >( &x1 ) );
+	char const * obj_end( obj_beg + sizeof( Variable_QSS1 ) );
+	auto const in_object = [=]( void const * p ){ char const * c( static_cast< char const * >( p ) ); return ( obj_beg <= c ) && ( c < obj_end ); };
+	EXPECT_TRUE( in_object( &x1.tQ ) ); // Hot integration state is in the object
+	EXPECT_TRUE( in_object( &x1.observers() ) ); // Observers are advanced at every requantization
+	EXPECT_FALSE( in_object( &x1.var() ) ); // FMU specs are cold
+	EXPECT_FALSE( in_object( &x1.connections() ) ); // Connections are cold
+	EXPECT_EQ( "x1", x1.name() );
+	EXPECT_EQ( &NameTable::instance()[ x1.name_id() ], &x1.name() ); // Name refers to the table's stored name
+	EXPECT_TRUE( x1.decoration().empty() );
+	EXPECT_FALSE( x1.observed() );
+	EXPECT_TRUE( x1.connections().empty() );
+}
@@ -68,6 +68,38 @@ TEST( Variable_ZC1Test, Basic )
 	EXPECT_EQ( 0.0, z.q1( 1.0 ) );
 }
 
+TEST( Variable_ZC1Test, ChatterBump )
+{
+	FMU_ME fmu;
+
+	std::size_t const zChatter( options::zChatter );
+	options::zChatter = 2u;
+	Variable_ZC1 z( &fmu, "z", 1.0e-4, 1.0e-6, 1.0e-4 );
+	Variable_ZC1 y( &fmu, "y", 1.0e-4, 1.0e-6, 0.0 ); // No zTol
+	options::zChatter = zChatter;
+
+	for ( Variable_ZC1 * v : { &z, &y } ) {
+		double const zTol( v->zTol );
+		v->advance_observer_1( 0.0, 0.0, 2.0 );
+		double const t_bump( v->tZC_bump( 0.0 ) );
+		for ( int i = 0; i < 4; ++i ) { // Rapid reversals
+			v->tZ = 1.0e-6 * i;
+			v->crossing = ( i % 2 == 0 ? Variable::Crossing::Up : Variable::Crossing::Dn );
+			v->chatter_check();
+		}
+		EXPECT_EQ( 1u, v->n_chatter() );
+		EXPECT_GT( v->zHys(), zTol ); // Hysteresis widened
+		EXPECT_EQ( zTol, v->zTol ); // Tolerance unchanged
+		EXPECT_EQ( t_bump, v->tZC_bump( 0.0 ) ); // FMU detection bump unchanged
+
+		v->tZ = 1.0; // Quiet: Relax back to zTol
+		v->crossing = Variable::Crossing::Up;
+		v->chatter_check();
+		EXPECT_EQ( zTol, v->zHys() );
+		EXPECT_EQ( t_bump, v->tZC_bump( 0.0 ) );
+	}
+}
+
 TEST( Variable_ZC1Test, BouncingBall )
 {
 	std::string const model( "BouncingBall.fmu" );
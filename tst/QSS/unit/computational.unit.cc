@@ -0,0 +1,243 @@
+// QSS Computational Observers and Observees Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/computational.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Mock Variable
+struct Var
+{
+	using Variables = std::vector< Var * >;
+
+	// Observers Collection
+	struct Observers
+	{
+		Variables const & observers() const { return observers_; }
+		Variables observers_;
+	};
+
+	enum class Kind { State, Passive, Active, ZC, Input };
+
+	explicit Var( Kind const kind ) : kind_( kind ) {}
+
+	bool is_state() const { return kind_ == Kind::State; }
+	bool is_Input() const { return kind_ == Kind::Input; }
+	bool is_Active() const { return ( kind_ == Kind::State ) || ( kind_ == Kind::Active ) || ( kind_ == Kind::ZC ); }
+	bool is_QSS() const { return kind_ == Kind::State; }
+	bool not_QSS() const { return !is_QSS(); }
+	bool not_ZC() const { return kind_ != Kind::ZC; }
+	bool not_State() const { return kind_ != Kind::State; }
+	Variables const & observees() const { return observees_; }
+	Observers const & observers() const { return observers_; }
+
+	void observe( Var * v ) { observees_.push_back( v ); v->observers_.observers_.push_back( this ); }
+
+	Kind kind_;
+	Variables observees_;
+	Observers observers_;
+};
+
+bool
+same( Var::Variables a, Var::Variables b )
+{
+	std::sort( a.begin(), a.end() );
+	std::sort( b.begin(), b.end() );
+	return a == b;
+}
+
+// Reference Computational Observees: Recursive Finder of Variable
+void
+observees_reference( Var::Variables const & observees, std::set< Var * > & checked, std::set< Var * > & found )
+{
+	for ( Var * observee : observees ) {
+		if ( checked.insert( observee ).second ) {
+			if ( observee->is_state() || observee->is_Input() ) {
+				found.insert( observee );
+			} else {
+				observees_reference( observee->observees_, checked, found );
+			}
+		}
+	}
+}
+
+// Reference Computational X-Based Observers: Recursive Finder of Observers
+void
+x_observers_reference( Var const * trigger, Var::Variables const & observers, std::set< Var * > & checked, std::set< Var * > & found )
+{
+	for ( Var * observer : observers ) {
+		if ( observer->not_State() ) {
+			if ( checked.insert( observer ).second ) {
+				if ( observer == trigger ) continue;
+				if ( observer->is_Active() ) found.insert( observer );
+				x_observers_reference( trigger, observer->observers().observers(), checked, found );
+			}
+		}
+	}
+}
+
+// Reference Computational Observers: Recursive Finder of Observers
+void
+observers_reference( Var const * trigger, Var::Variables const & observers, std::set< Var * > & checked, std::set< Var * > & found )
+{
+	for ( Var * observer : observers ) {
+		if ( checked.insert( observer ).second ) {
+			if ( observer == trigger ) continue;
+			if ( observer->is_Active() ) found.insert( observer );
+			if ( observer->is_QSS() ) {
+				x_observers_reference( trigger, observer->observers().observers(), checked, found );
+			} else if ( observer->not_ZC() ) {
+				observers_reference( trigger, observer->observers().observers(), checked, found );
+			}
+		}
+	}
+}
+
+// Compare with Reference Finders for All Variables
+void
+expect_reference( Var::Variables const & vars )
+{
+	std::vector< Var::Variables > observees;
+	computational_observees< Var >( vars, observees );
+	std::vector< Var::Variables > observers;
+	computational_observers< Var >( vars, vars, observers );
+	for ( std::size_t i = 0u; i < vars.size(); ++i ) {
+		std::set< Var * > checked, found;
+		observees_reference( vars[ i ]->observees_, checked, found );
+		EXPECT_TRUE( same( Var::Variables( found.begin(), found.end() ), observees[ i ] ) ) << "observees of " << i;
+		checked.clear(); found.clear();
+		observers_reference( vars[ i ], vars[ i ]->observers().observers(), checked, found );
+		EXPECT_TRUE( same( Var::Variables( found.begin(), found.end() ), observers[ i ] ) ) << "observers of " << i;
+	}
+}
+
+} // namespace
+
+TEST( computationalTest, PassiveLoop )
+{
+	// x1, x2 states; p1 <-> p2 passive algebraic loop observing x1; x2 and active r observe p2; z observes p1 and x2
+	Var x1( Var::Kind::State ), x2( Var::Kind::State ), p1( Var::Kind::Passive ), p2( Var::Kind::Passive ), r( Var::Kind::Active ), z( Var::Kind::ZC ), u( Var::Kind::Input );
+	p1.observe( &x1 );
+	p1.observe( &p2 );
+	p2.observe( &p1 );
+	p2.observe( &u );
+	x2.observe( &p2 );
+	r.observe( &p2 );
+	z.observe( &p1 );
+	z.observe( &x2 );
+	Var::Variables const vars{ &x1, &x2, &p1, &p2, &r, &z, &u };
+
+	std::vector< Var::Variables > observees;
+	computational_observees< Var >( vars, observees );
+	EXPECT_TRUE( observees[ 0 ].empty() );
+	EXPECT_TRUE( same( { &x1, &u }, observees[ 1 ] ) ); // x2
+	EXPECT_TRUE( same( { &x1, &u }, observees[ 2 ] ) ); // p1
+	EXPECT_TRUE( same( { &x1, &u }, observees[ 4 ] ) ); // r
+	EXPECT_TRUE( same( { &x1, &x2, &u }, observees[ 5 ] ) ); // z
+
+	std::vector< Var::Variables > observers;
+	computational_observers< Var >( vars, { &x1, &x2, &u }, observers );
+	EXPECT_TRUE( same( { &x2, &r, &z }, observers[ 0 ] ) ); // x1: Through passive loop
+	EXPECT_TRUE( same( { &z }, observers[ 1 ] ) ); // x2
+	EXPECT_TRUE( same( { &x2, &r, &z }, observers[ 2 ] ) ); // u
+}
+
+TEST( computationalTest, XBased )
+{
+	// State x observed by state y and passive p: y's observers are only extended through non-state (x-based) observers
+	Var x( Var::Kind::State ), y( Var::Kind::State ), w( Var::Kind::State ), p( Var::Kind::Passive ), a( Var::Kind::Active );
+	y.observe( &x );
+	w.observe( &y ); // State observer of state y: Not x-based
+	p.observe( &y ); // Passive observer of state y
+	a.observe( &p );
+	Var::Variables const vars{ &x, &y, &w, &p, &a };
+	std::vector< Var::Variables > observers;
+	computational_observers< Var >( vars, { &x, &y }, observers );
+	EXPECT_TRUE( same( { &y, &a }, observers[ 0 ] ) ); // x: y and a via y's x-based passive observer p
+	EXPECT_TRUE( same( { &w, &a }, observers[ 1 ] ) ); // y
+}
+
+TEST( computationalTest, TriggerOnCycle )
+{
+	// Passive trigger t on cycle t -> y -> p -> t: y is QSS so p is reached x-based and p's state observer s is only reached from p in full mode
+	Var t( Var::Kind::Passive ), y( Var::Kind::State ), p( Var::Kind::Passive ), s( Var::Kind::State ), a( Var::Kind::Active ), z( Var::Kind::ZC );
+	y.observe( &t );
+	p.observe( &y );
+	p.observe( &t );
+	t.observe( &p );
+	s.observe( &p );
+	a.observe( &p );
+	z.observe( &t );
+	Var::Variables const vars{ &t, &y, &p, &s, &a, &z };
+	std::vector< Var::Variables > observers;
+	computational_observers< Var >( vars, { &t }, observers );
+	EXPECT_TRUE( same( { &y, &a, &z }, observers[ 0 ] ) ); // p is checked x-based through y first: Traversal stops at t and s isn't reached
+	expect_reference( vars );
+}
+
+TEST( computationalTest, RandomGraphs )
+{
+	std::mt19937 gen( 20171 ); // Fixed seed for reproducibility
+	std::uniform_int_distribution< int > kind_dist( 0, 4 );
+	for ( int g = 0; g < 50; ++g ) {
+		std::size_t const n( 4u + std::size_t( g % 12 ) );
+		std::vector< Var > nodes;
+		nodes.reserve( n );
+		for ( std::size_t i = 0u; i < n; ++i ) nodes.emplace_back( Var::Kind( kind_dist( gen ) ) );
+		std::uniform_int_distribution< std::size_t > node_dist( 0u, n - 1u );
+		for ( std::size_t e = 0u, m = 2u * n; e < m; ++e ) {
+			Var & v( nodes[ node_dist( gen ) ] );
+			Var * w( &nodes[ node_dist( gen ) ] );
+			if ( std::find( v.observees_.begin(), v.observees_.end(), w ) == v.observees_.end() ) v.observe( w );
+		}
+		Var::Variables vars;
+		for ( Var & v : nodes ) vars.push_back( &v );
+		expect_reference( vars );
+	}
+}
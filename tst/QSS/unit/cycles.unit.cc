@@ -0,0 +1,262 @@
+// QSS Dependency Cycle Detection Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/cycles.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+struct Conditional;
+
+// Variable Mock
+struct V
+{
+	using Variables = std::vector< V * >;
+
+	explicit
+	V( std::string const & nam_ ) :
+	 nam( nam_ )
+	{}
+
+	std::string const &
+	name() const
+	{
+		return nam;
+	}
+
+	Variables const &
+	observers() const
+	{
+		return obs;
+	}
+
+	bool
+	is_ZC() const
+	{
+		return conditional != nullptr;
+	}
+
+	bool
+	in_conditional() const
+	{
+		return conditional != nullptr;
+	}
+
+	std::string nam;
+	Variables obs; // Observers
+	Conditional * conditional{ nullptr };
+};
+
+// Conditional Mock
+struct Conditional
+{
+	V::Variables const &
+	observers() const
+	{
+		return obs;
+	}
+
+	V::Variables obs; // Handler variables
+};
+
+// Reference Cycle Detection: Depth-First Search over Node Objects
+template< typename Variable, typename Variable_ZC >
+void
+cycles_reference( typename Variable::Variables const & vars )
+{
+	struct Node
+	{
+		using Observers = std::vector< Node * >;
+		enum class State { None, Stack, Done };
+
+		explicit
+		Node( Variable const * var ) :
+		 var( var )
+		{}
+
+		Node *
+		child()
+		{
+			return i != observers.end() ? *i : nullptr;
+		}
+
+		void
+		enter()
+		{
+			state = Node::State::Stack;
+			i = observers.begin();
+		}
+
+		bool
+		advance_child()
+		{
+			assert( !observers.empty() );
+			return ++i != observers.end();
+		}
+
+		Variable const * var{ nullptr };
+		State state{ State::None };
+		Observers observers;
+		typename Observers::const_iterator i;
+	};
+
+	using Nodes = std::vector< Node >;
+	Nodes nodes;
+	for ( Variable const * var : vars ) nodes.emplace_back( var );
+	for ( Node & node : nodes ) {
+		for ( Variable const * obs : node.var->observers() ) {
+			node.observers.push_back( &*std::find_if( nodes.begin(), nodes.end(), [obs]( Node const & n ){ return n.var == obs; } ) );
+		}
+		if ( node.var->is_ZC() ) {
+			Variable_ZC const * zc( static_cast< Variable_ZC const * >( node.var ) );
+			if ( zc->in_conditional() ) {
+				for ( Variable const * mod : zc->conditional->observers() ) {
+					node.observers.push_back( &*std::find_if( nodes.begin(), nodes.end(), [mod]( Node const & n ){ return n.var == mod; } ) );
+				}
+			}
+		}
+	}
+
+	enum class Step { Push, Pop };
+	Step step( Step::Push );
+	using Branch = std::deque< Node * >;
+	Branch branch;
+	for ( Node & root : nodes ) {
+		if ( root.state != Node::State::None ) continue;
+		branch.push_front( &root );
+		step = Step::Push;
+		Node * node( &root );
+		while ( !branch.empty() ) {
+			if ( node->state == Node::State::None ) {
+				node->enter();
+				Node * child( node->child() );
+				if ( child != nullptr ) {
+					node = child;
+					branch.push_front( node );
+				} else {
+					node->state = Node::State::Done;
+					branch.pop_front();
+					step = Step::Pop;
+					node = !branch.empty() ? branch.front() : nullptr;
+				}
+			} else if ( node->state == Node::State::Stack ) {
+				if ( step == Step::Push ) {
+					std::cerr << "\nVariable dependency cycle present:" << std::endl;
+					bool active( false );
+					for ( typename Branch::const_iterator i = branch.begin(); i != branch.end(); ++i ) {
+						if ( ( !active ) && ( *i == node ) ) active = true;
+						if ( active ) std::cerr << ' ' << (*i)->var->name() << std::endl;
+					}
+					branch.pop_front();
+					step = Step::Pop;
+					node = !branch.empty() ? branch.front() : nullptr;
+				} else {
+					if ( node->advance_child() ) {
+						node = node->child();
+						branch.push_front( node );
+						step = Step::Push;
+					} else {
+						node->state = Node::State::Done;
+						branch.pop_front();
+						step = Step::Pop;
+						node = !branch.empty() ? branch.front() : nullptr;
+					}
+				}
+			} else {
+				branch.pop_front();
+				step = Step::Pop;
+				node = !branch.empty() ? branch.front() : nullptr;
+			}
+		}
+	}
+}
+
+// Captured Cycle Report
+template< typename F >
+std::string
+report( F f )
+{
+	std::ostringstream err;
+	std::streambuf * const buf( std::cerr.rdbuf( err.rdbuf() ) );
+	f();
+	std::cerr.rdbuf( buf );
+	return err.str();
+}
+
+} // namespace
+
+TEST( cyclesTest, Acyclic )
+{
+	V a( "a" ), b( "b" ), c( "c" );
+	a.obs = { &b, &c };
+	b.obs = { &c };
+	V::Variables const vars{ &a, &b, &c };
+	EXPECT_EQ( "", report( [&](){ cycles< V, V >( vars ); } ) );
+}
+
+TEST( cyclesTest, OverlappingCycles )
+{
+	// a <-> b <-> c figure eight, c -> d -> e -> c, e -> a via a zero-crossing conditional handler, f self loop, g feeds in
+	V a( "a" ), b( "b" ), c( "c" ), d( "d" ), e( "e" ), f( "f" ), g( "g" );
+	Conditional cond;
+	cond.obs = { &a };
+	a.obs = { &b };
+	b.obs = { &a, &c };
+	c.obs = { &b, &d };
+	d.obs = { &e };
+	e.conditional = &cond;
+	f.obs = { &f };
+	g.obs = { &d, &b };
+	for ( V::Variables const & vars : { V::Variables{ &a, &b, &c, &d, &e, &f, &g }, V::Variables{ &g, &f, &e, &d, &c, &b, &a } } ) {
+		std::string const reference( report( [&](){ cycles_reference< V, V >( vars ); } ) );
+		EXPECT_NE( "", reference );
+		EXPECT_EQ( reference, report( [&](){ cycles< V, V >( vars ); } ) );
+	}
+}
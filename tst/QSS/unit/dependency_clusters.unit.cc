@@ -0,0 +1,268 @@
+// QSS State Dependency Cycle Clusters Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/dependency_clusters.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace QSS;
+
+namespace {
+
+// Variable Mock
+struct Q
+{
+	using Variables = std::vector< Q * >;
+	using Variables_QSS = std::vector< Q * >;
+
+	explicit
+	Q( std::string const & nam_ ) :
+	 nam( nam_ )
+	{}
+
+	std::string const &
+	name() const
+	{
+		return nam;
+	}
+
+	bool
+	is_State() const
+	{
+		return true;
+	}
+
+	bool
+	is_Input() const
+	{
+		return false;
+	}
+
+	Variables const &
+	observees() const
+	{
+		return obs;
+	}
+
+	void
+	add_to_cluster( Q * var )
+	{
+		if ( var != this ) cluster.push_back( var );
+	}
+
+	std::string nam;
+	Variables obs; // Observees
+	Variables cluster;
+};
+
+// Reference Clusters: Depth-First Search over All Simple Paths of Node Objects
+template< typename Variable, typename Variable_QSS >
+void
+dependency_clusters_reference( typename Variable_QSS::Variables_QSS & vars )
+{
+	struct Node
+	{
+		using Observees = std::vector< Node * >;
+		enum class State { None, Stack };
+
+		explicit
+		Node( Variable_QSS * var ) :
+		 var( var )
+		{}
+
+		Node *
+		child()
+		{
+			return i != observees.end() ? *i : nullptr;
+		}
+
+		void
+		enter()
+		{
+			state = Node::State::Stack;
+			i = observees.begin();
+			entered = true;
+		}
+
+		bool
+		advance_child()
+		{
+			assert( !observees.empty() );
+			return ++i != observees.end();
+		}
+
+		void
+		leave()
+		{
+			state = Node::State::None;
+		}
+
+		bool entered{ false };
+		Variable_QSS * var{ nullptr };
+		State state{ State::None };
+		Observees observees;
+		typename Observees::iterator i;
+	};
+
+	using Nodes = std::vector< Node >;
+	Nodes nodes;
+	for ( Variable_QSS * var : vars ) {
+		if ( var->is_State() ) nodes.emplace_back( var );
+	}
+	for ( Node & node : nodes ) {
+		for ( Variable * obs : node.var->observees() ) {
+			if ( obs->is_State() ) node.observees.push_back( &*std::find_if( nodes.begin(), nodes.end(), [obs]( Node const & n ){ return n.var == obs; } ) );
+		}
+	}
+
+	enum class Step { Push, Pop };
+	Step step( Step::Push );
+	using Branch = std::deque< Node * >;
+	Branch branch;
+	for ( Node & root : nodes ) {
+		if ( root.entered ) continue;
+		branch.push_front( &root );
+		step = Step::Push;
+		Node * node( &root );
+		while ( !branch.empty() ) {
+			if ( node->state == Node::State::None ) {
+				node->enter();
+				Node * child( node->child() );
+				if ( child == nullptr ) {
+					node->leave();
+					branch.pop_front();
+					step = Step::Pop;
+					node = !branch.empty() ? branch.front() : nullptr;
+				} else {
+					node = child;
+					branch.push_front( node );
+				}
+			} else if ( node->state == Node::State::Stack ) {
+				if ( step == Step::Push ) {
+					typename Branch::reverse_iterator i( branch.rbegin() );
+					while ( *i != node ) ++i;
+					typename Branch::reverse_iterator i_active( i );
+					for ( ; i != branch.rend(); ++i ) {
+						for ( typename Branch::reverse_iterator j = i_active; j != branch.rend(); ++j ) {
+							(*i)->var->add_to_cluster( (*j)->var );
+						}
+					}
+					branch.pop_front();
+					step = Step::Pop;
+					node = !branch.empty() ? branch.front() : nullptr;
+				} else {
+					if ( node->advance_child() ) {
+						node = node->child();
+						branch.push_front( node );
+						step = Step::Push;
+					} else {
+						node->leave();
+						branch.pop_front();
+						step = Step::Pop;
+						node = !branch.empty() ? branch.front() : nullptr;
+					}
+				}
+			}
+		}
+	}
+}
+
+// Graph of n Variables with Observee Edges
+struct Graph
+{
+	Graph( std::size_t const n, std::vector< std::pair< std::size_t, std::size_t > > const & edges )
+	{
+		for ( std::size_t i = 0u; i < n; ++i ) qs.emplace_back( std::string( 1u, char( 'a' + i ) ) );
+		for ( Q & q : qs ) vars.push_back( &q );
+		for ( auto const & edge : edges ) qs[ edge.first ].obs.push_back( &qs[ edge.second ] );
+	}
+
+	// Sorted Cluster Names of Each Variable
+	std::vector< std::string >
+	clusters() const
+	{
+		std::vector< std::string > names;
+		for ( Q const & q : qs ) {
+			std::string s;
+			for ( Q const * c : q.cluster ) s += c->name();
+			std::sort( s.begin(), s.end() );
+			s.erase( std::unique( s.begin(), s.end() ), s.end() );
+			names.push_back( s );
+		}
+		return names;
+	}
+
+	std::deque< Q > qs;
+	Q::Variables_QSS vars;
+};
+
+} // namespace
+
+TEST( dependency_clustersTest, FigureEight )
+{
+	// a <-> b <-> c: a and c share no cycle
+	std::vector< std::pair< std::size_t, std::size_t > > const edges{ { 0u, 1u }, { 1u, 0u }, { 1u, 2u }, { 2u, 1u }, { 3u, 0u } };
+	Graph g( 4u, edges );
+	dependency_clusters< Q, Q >( g.vars );
+	EXPECT_EQ( std::vector< std::string >( { "b", "ac", "b", "" } ), g.clusters() );
+}
+
+TEST( dependency_clustersTest, OverlappingCycles )
+{
+	std::vector< std::vector< std::pair< std::size_t, std::size_t > > > const graphs{
+	 { { 0u, 1u }, { 1u, 0u }, { 1u, 2u }, { 2u, 1u }, { 2u, 3u }, { 3u, 4u }, { 4u, 2u }, { 5u, 5u }, { 6u, 3u }, { 4u, 6u } },
+	 { { 0u, 1u }, { 1u, 2u }, { 2u, 0u }, { 2u, 3u }, { 3u, 1u }, { 3u, 4u }, { 4u, 5u }, { 5u, 4u }, { 6u, 0u } },
+	 { { 6u, 5u }, { 5u, 4u }, { 4u, 6u }, { 4u, 3u }, { 3u, 4u }, { 2u, 1u }, { 1u, 2u }, { 1u, 0u }, { 0u, 2u }, { 3u, 2u } }
+	};
+	for ( auto const & edges : graphs ) {
+		Graph r( 7u, edges );
+		dependency_clusters_reference< Q, Q >( r.vars );
+		Graph g( 7u, edges );
+		dependency_clusters< Q, Q >( g.vars );
+		EXPECT_EQ( r.clusters(), g.clusters() );
+	}
+}
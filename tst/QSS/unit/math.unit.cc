@@ -451,6 +451,37 @@ TEST( MathTest, ZCRootCubic )
 	EXPECT_DOUBLE_EQ( 0.04650293690494123, zc_root_cubic( 1.0, 2000.0, -50.0, -2.0 ) ); // Near quadratic
 }
 
+TEST( MathTest, ZCRootExcluded )
+{
+	EXPECT_TRUE( zc_root_excluded( 1.0, -2.0, 1.0, 0.5 ) ); // Double root at 1
+	EXPECT_FALSE( zc_root_excluded( 1.0, -2.0, 1.0, 2.0 ) );
+	EXPECT_TRUE( zc_root_excluded( 1.0, 0.0, 1.0, 10.0 ) ); // No real roots
+	EXPECT_TRUE( zc_root_excluded( -1.0, 0.0, 1.0, 0.9 ) ); // Root at 1
+	EXPECT_FALSE( zc_root_excluded( -1.0, 0.0, 1.0, 1.0 ) );
+	EXPECT_FALSE( zc_root_excluded( 1.0, -2.0, 1.01, 2.0 ) ); // No real roots but bound is conservative
+	EXPECT_FALSE( zc_root_excluded( 1.0, 1.0, 0.0, 1.0 ) ); // Zero at start
+
+	EXPECT_TRUE( zc_root_excluded( -2.25, -6.5, -7.0, 9.0, 0.7 ) ); // Root at 0.7073498763104491
+	EXPECT_FALSE( zc_root_excluded( -2.25, -6.5, -7.0, 9.0, 0.71 ) );
+	EXPECT_TRUE( zc_root_excluded( 2.25, 6.5, 7.0, -9.0, 0.7 ) );
+	EXPECT_FALSE( zc_root_excluded( 2.25, 6.5, 7.0, -9.0, 0.71 ) );
+	EXPECT_FALSE( zc_root_excluded( 1.0, 2.0, 3.0, 0.0, 1.0 ) ); // Zero at start
+
+	for ( int i = -4; i <= 4; ++i ) { // Culling never hides a root on [0,h]
+		for ( int j = -4; j <= 4; ++j ) {
+			double const a( 0.5 * i ), b( 1.5 * j ), c( -3.0 ), d( 2.0 );
+			for ( double const h : { 0.1, 0.5, 1.0, 3.0 } ) {
+				if ( zc_root_excluded( b, c, d, h ) ) {
+					EXPECT_LT( h, zc_root_quadratic( b, c, d, 0.0 ) );
+				}
+				if ( zc_root_excluded( a, b, c, d, h ) ) {
+					EXPECT_LT( h, zc_root_cubic( a, b, c, d, 0.0 ) );
+				}
+			}
+		}
+	}
+}
+
 TEST( MathTest, MinRootCubicMonicAnalytical )
 {
 	EXPECT_DOUBLE_EQ( 0.15417149518144127, min_root_cubic_monic_boundary_analytical( 3.0, 6.0, -1.0 ) );
@@ -474,3 +505,20 @@ TEST( MathTest, MinRootCubic )
 	EXPECT_DOUBLE_EQ( 2.4141969797051361, min_root_cubic_both( 0.00001, 3.0, -6.0, 6.0, -3.0 ) ); // Near quadratic
 	EXPECT_DOUBLE_EQ( 2.4142301455300395, min_root_cubic_both( -0.00001, 3.0, -6.0, 6.0, -3.0 ) ); // Near quadratic
 }
+
+TEST( MathTest, IllinoisRoot )
+{
+	std::size_t n( 0u );
+	auto const f( [&n]( double const x ){ ++n; return ( x * x * x ) - 2.0; } ); // Root at cbrt(2)
+	Root< double > const root( illinois_root( f, 1.0, 2.0, -1.0, 6.0, Root< double >( 2.0, 6.0 ), 1.0e-12, 50u ) );
+	EXPECT_TRUE( root.valid );
+	EXPECT_NEAR( std::cbrt( 2.0 ), root.x, 1.0e-12 );
+	EXPECT_LT( n, 20u ); // Superlinear: Plain regula falsi stalls on this convex function
+
+	n = 0u;
+	Root< double > const root_budget( illinois_root( f, 1.0, 2.0, -1.0, 6.0, Root< double >( 2.0, 6.0 ), 1.0e-12, 3u ) );
+	EXPECT_EQ( 3u, n ); // Budget respected
+	EXPECT_FALSE( root_budget.valid );
+	EXPECT_LT( std::abs( root_budget.v ), 6.0 ); // Best evaluated point returned
+	EXPECT_NEAR( root_budget.v, f( root_budget.x ), 1.0e-15 );
+}
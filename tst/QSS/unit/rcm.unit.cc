@@ -0,0 +1,97 @@
+// QSS::rcm Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/rcm.hh>
+
+// C++ Headers
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace QSS;
+
+TEST( rcmTest, Undirected )
+{
+	using Graph = CSR< std::uint32_t >;
+	Graph const g( 3u, Graph::Edges{ { 0u, 1u }, { 1u, 0u }, { 1u, 1u }, { 2u, 1u } } );
+	Graph const u( undirected( g ) );
+	EXPECT_EQ( 4u, u.n_edges() );
+	EXPECT_EQ( std::vector< std::uint32_t >( { 1u } ), std::vector< std::uint32_t >( u.begin( 0u ), u.end( 0u ) ) );
+	EXPECT_EQ( std::vector< std::uint32_t >( { 0u, 2u } ), std::vector< std::uint32_t >( u.begin( 1u ), u.end( 1u ) ) ); // Self-edge removed
+	EXPECT_EQ( std::vector< std::uint32_t >( { 1u } ), std::vector< std::uint32_t >( u.begin( 2u ), u.end( 2u ) ) );
+}
+
+TEST( rcmTest, Path )
+{
+	using Graph = CSR< std::uint32_t >;
+	using Indexes = std::vector< std::uint32_t >;
+	// Path 0-5-1-4-2-3 numbered badly plus isolated node 6
+	Graph const g( undirected( Graph( 7u, Graph::Edges{ { 0u, 5u }, { 5u, 1u }, { 1u, 4u }, { 4u, 2u }, { 2u, 3u } } ) ) );
+	Indexes identity( 7u );
+	for ( std::uint32_t i = 0u; i < 7u; ++i ) identity[ i ] = i;
+	EXPECT_EQ( 5u, bandwidth( g, identity ) );
+
+	Indexes order;
+	rcm( g, order );
+	ASSERT_EQ( 7u, order.size() );
+	Indexes sorted( order );
+	std::sort( sorted.begin(), sorted.end() );
+	EXPECT_EQ( identity, sorted ); // Permutation
+	EXPECT_EQ( 1u, bandwidth( g, order ) );
+
+	Indexes again;
+	rcm( g, again );
+	EXPECT_EQ( order, again ); // Deterministic
+}
+
+TEST( rcmTest, Components )
+{
+	using Graph = CSR< std::uint32_t >;
+	using Indexes = std::vector< std::uint32_t >;
+	// Two stars interleaved in numbering: Hubs 0 and 1
+	Graph const g( undirected( Graph( 6u, Graph::Edges{ { 0u, 2u }, { 0u, 4u }, { 1u, 3u }, { 1u, 5u } } ) ) );
+	Indexes order;
+	rcm( g, order );
+	std::vector< std::size_t > pos( 6u );
+	for ( std::size_t k = 0u; k < 6u; ++k ) pos[ order[ k ] ] = k;
+	auto const span( [ &pos ]( std::uint32_t a, std::uint32_t b, std::uint32_t c ){ return std::max( { pos[ a ], pos[ b ], pos[ c ] } ) - std::min( { pos[ a ], pos[ b ], pos[ c ] } ); } );
+	EXPECT_EQ( 2u, span( 0u, 2u, 4u ) ); // Each component is contiguous
+	EXPECT_EQ( 2u, span( 1u, 3u, 5u ) );
+}
@@ -0,0 +1,100 @@
+// QSS Strongly Connected Components Unit Tests
+//
+// Project: QSS Solver
+//
+// Developed by Objexx Engineering, Inc. (https://objexx.com) under contract to
+// the National Renewable Energy Laboratory of the U.S. Department of Energy
+//
+// Copyright (c) 2017-2025 Objexx Engineering, Inc. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// (1) Redistributions of source code must retain the above copyright notice,
+//     this list of conditions and the following disclaimer.
+//
+// (2) Redistributions in binary form must reproduce the above copyright notice,
+//     this list of conditions and the following disclaimer in the documentation
+//     and/or other materials provided with the distribution.
+//
+// (3) Neither the name of the copyright holder nor the names of its
+//     contributors may be used to endorse or promote products derived from this
+//     software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES
+// GOVERNMENT, OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+// Google Test Headers
+#include <gtest/gtest.h>
+
+// QSS Headers
+#include <QSS/scc.hh>
+
+// C++ Headers
+#include <cstdint>
+#include <vector>
+
+using namespace QSS;
+
+TEST( sccTest, CSR )
+{
+	using Graph = CSR< std::uint32_t >;
+	Graph const g( 4u, Graph::Edges{ { 2u, 0u }, { 0u, 1u }, { 2u, 3u }, { 0u, 2u } } );
+	EXPECT_EQ( 4u, g.n() );
+	EXPECT_EQ( 4u, g.n_edges() );
+	EXPECT_EQ( 2u, g.degree( 0u ) );
+	EXPECT_EQ( 0u, g.degree( 1u ) );
+	EXPECT_EQ( 2u, g.degree( 2u ) );
+	EXPECT_EQ( 0u, g.degree( 3u ) );
+	EXPECT_EQ( std::vector< std::uint32_t >( { 1u, 2u } ), std::vector< std::uint32_t >( g.begin( 0u ), g.end( 0u ) ) ); // Insertion order
+	EXPECT_EQ( std::vector< std::uint32_t >( { 0u, 3u } ), std::vector< std::uint32_t >( g.begin( 2u ), g.end( 2u ) ) );
+}
+
+TEST( sccTest, Components )
+{
+	using Graph = CSR< std::uint32_t >;
+	// 0 -> 1 -> 2 -> 0 cycle, 2 -> 3, 3 -> 4 -> 3 cycle, 5 self loop, 6 isolated
+	Graph const g( 7u, Graph::Edges{ { 0u, 1u }, { 1u, 2u }, { 2u, 0u }, { 2u, 3u }, { 3u, 4u }, { 4u, 3u }, { 5u, 5u } } );
+	std::vector< std::uint32_t > comp;
+	std::uint32_t const n_comp( scc( g, comp ) );
+	EXPECT_EQ( 4u, n_comp );
+	EXPECT_EQ( comp[ 0 ], comp[ 1 ] );
+	EXPECT_EQ( comp[ 0 ], comp[ 2 ] );
+	EXPECT_EQ( comp[ 3 ], comp[ 4 ] );
+	EXPECT_NE( comp[ 0 ], comp[ 3 ] );
+	EXPECT_NE( comp[ 5 ], comp[ 6 ] );
+	EXPECT_LT( comp[ 3 ], comp[ 0 ] ); // Reverse topological order
+	std::vector< std::uint32_t > off, members;
+	scc_members( comp, n_comp, off, members );
+	ASSERT_EQ( 5u, off.size() );
+	EXPECT_EQ( 7u, off.back() );
+	std::uint32_t const c( comp[ 0 ] );
+	EXPECT_EQ( 3u, off[ c + 1u ] - off[ c ] );
+	EXPECT_EQ( 0u, members[ off[ c ] ] );
+	EXPECT_EQ( 2u, members[ off[ c ] + 2u ] );
+}
+
+TEST( sccTest, LongChain )
+{
+	using Graph = CSR< std::uint32_t >;
+	std::uint32_t const n( 200000u ); // Deep DFS must not recurse
+	Graph::Edges edges;
+	for ( std::uint32_t i = 0u; i + 1u < n; ++i ) edges.emplace_back( i, i + 1u );
+	edges.emplace_back( n - 1u, 0u ); // Close the ring
+	Graph const g( n, edges );
+	std::vector< std::uint32_t > comp;
+	EXPECT_EQ( 1u, scc( g, comp ) );
+	edges.pop_back(); // Open the ring
+	Graph const h( n, edges );
+	EXPECT_EQ( n, scc( h, comp ) );
+}